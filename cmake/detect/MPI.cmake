@@ -182,6 +182,38 @@ set(MPIX_IALLGATHER_CODE
      }")
 El_check_c_source_compiles("${MPIX_IALLGATHER_CODE}" 
   EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
+set(MPI_RMA_CODE
+    "#include \"mpi.h\"
+     int main( int argc, char* argv[] )
+     {
+       MPI_Init( &argc, &argv );
+       double a, b;
+       MPI_Aint displ = 0;
+       MPI_Datatype type;
+       MPI_Win win;
+       MPI_Type_create_hindexed_block( 1, 1, &displ, MPI_DOUBLE, &type );
+       MPI_Win_create
+       ( &a, sizeof(double), sizeof(double), MPI_INFO_NULL, MPI_COMM_WORLD,
+         &win );
+       MPI_Win_lock_all( 0, win );
+       MPI_Accumulate( &b, 1, MPI_DOUBLE, 0, 0, 1, type, MPI_SUM, win );
+       MPI_Win_flush_local( 0, win );
+       MPI_Win_flush_all( win );
+       MPI_Win_sync( win );
+       MPI_Win_unlock_all( win );
+       MPI_Win_free( &win );
+       double* shared;
+       MPI_Aint size;
+       int dispUnit;
+       MPI_Win_allocate_shared
+       ( sizeof(double), sizeof(double), MPI_INFO_NULL, MPI_COMM_SELF,
+         &shared, &win );
+       MPI_Win_shared_query( win, 0, &size, &dispUnit, &shared );
+       MPI_Win_free( &win );
+       MPI_Finalize();
+       return 0;
+     }")
+El_check_c_source_compiles("${MPI_RMA_CODE}" EL_HAVE_MPI3_RMA)
 set(MPI_INIT_THREAD_CODE
     "#include \"mpi.h\"
      int main( int argc, char* argv[] )
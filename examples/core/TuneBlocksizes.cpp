@@ -0,0 +1,130 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// A calibration run which sweeps the algorithmic blocksize of each of the
+// tunable routines over the given grid and writes the fastest choices to a
+// tuning file which can be loaded via --blocksize-tuning <file>
+template<typename F>
+void TuneRoutines
+( const Grid& g, Int n, const vector<Int>& candidates, Int numReps )
+{
+    const string typeName = TypeName<F>();
+    mpi::Comm comm = g.Comm();
+    const bool root = ( g.Rank() == 0 );
+    auto report = [&]( const string& routine, Int blocksize )
+    {
+        if( root )
+            Output(routine," (",typeName,"): ",blocksize);
+    };
+
+    DistMatrix<F> A(g), B(g), C(g), AOrig(g), BOrig(g);
+    Uniform( AOrig, n, n );
+    Uniform( BOrig, n, n );
+
+    auto tune = [&]( const string& routine, function<void()> run )
+    {
+        const Int blocksize = TuneBlocksize<F>
+          ( routine, g.Height(), g.Width(), candidates, run, comm, numReps );
+        report( routine, blocksize );
+    };
+
+    tune( "Gemm", [&]()
+      { Gemm( NORMAL, NORMAL, F(1), AOrig, BOrig, C ); } );
+
+    // Make a well-conditioned lower-triangular matrix and an HPD matrix
+    DistMatrix<F> L(g), HPD(g);
+    HermitianUniformSpectrum( HPD, n, 1, 10 );
+    L = HPD;
+    Cholesky( LOWER, L );
+    MakeTrapezoidal( LOWER, L );
+
+    tune( "Trsm", [&]()
+      {
+          B = BOrig;
+          Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), L, B );
+      } );
+    tune( "Cholesky", [&]()
+      {
+          A = HPD;
+          Cholesky( LOWER, A );
+      } );
+    tune( "LU", [&]()
+      {
+          A = AOrig;
+          DistPermutation P(g);
+          El::LU( A, P );
+      } );
+    tune( "QR", [&]()
+      {
+          A = AOrig;
+          DistMatrix<F,MD,STAR> t(g);
+          DistMatrix<Base<F>,MD,STAR> d(g);
+          El::QR( A, t, d );
+      } );
+    tune( "HermitianTridiag", [&]()
+      {
+          A = HPD;
+          DistMatrix<F,STAR,STAR> t(g);
+          HermitianTridiag( LOWER, A, t );
+      } );
+}
+
+int main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--size","size of the test matrices",1000);
+        const Int minBsize = Input("--minBsize","smallest candidate",32);
+        const Int maxBsize = Input("--maxBsize","largest candidate",256);
+        const Int numReps = Input("--numReps","timings per candidate",3);
+        const bool complex = Input("--complex","also tune complex?",false);
+        Int gridHeight = Input("--gridHeight","grid height",0);
+        const string filename =
+          Input("--file","output tuning file",string("blocksizes.txt"));
+        ProcessInput();
+        PrintInputReport();
+
+        // Candidates of the form 2^k and 3*2^(k-1)
+        vector<Int> candidates;
+        for( Int bsize=minBsize; bsize<=maxBsize; bsize*=2 )
+        {
+            candidates.push_back( bsize );
+            if( 3*bsize/2 <= maxBsize )
+                candidates.push_back( 3*bsize/2 );
+        }
+        if( candidates.empty() )
+            LogicError("No candidate blocksizes in [",minBsize,",",maxBsize,"]");
+
+        if( gridHeight == 0 )
+            gridHeight = Grid::FindFactor( commSize );
+        const Grid g( comm, gridHeight );
+        if( commRank == 0 )
+            Output("Grid is: ",g.Height()," x ",g.Width());
+
+        // Tune from scratch rather than building upon a loaded table
+        ClearTunedBlocksizes();
+        TuneRoutines<double>( g, n, candidates, numReps );
+        if( complex )
+            TuneRoutines<Complex<double>>( g, n, candidates, numReps );
+
+        SaveBlocksizeTuning( filename, comm );
+        if( commRank == 0 )
+            Output("Wrote ",filename);
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_AXPBY_HPP
+#define EL_BLAS_AXPBY_HPP
+
+// Y := alpha X + beta Y in a single pass over memory
+
+namespace El {
+
+template<typename T,typename S>
+void Axpby( S alphaS, const Matrix<T>& X, S betaS, Matrix<T>& Y )
+{
+    DEBUG_ONLY(CSE cse("Axpby"))
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        LogicError("Nonconformal Axpby");
+    const T alpha = T(alphaS);
+    const T beta = T(betaS);
+    const Int height = X.Height();
+    const Int width = X.Width();
+    const T* XBuf = X.LockedBuffer();
+          T* YBuf = Y.Buffer();
+    const Int XLDim = X.LDim();
+    const Int YLDim = Y.LDim();
+
+    // As in the BLAS, Y is not read when beta is zero
+    if( beta == T(0) )
+    {
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                YBuf[i+j*YLDim] = alpha*XBuf[i+j*XLDim];
+    }
+    else
+    {
+        for( Int j=0; j<width; ++j )
+            for( Int i=0; i<height; ++i )
+                YBuf[i+j*YLDim] = alpha*XBuf[i+j*XLDim] + beta*YBuf[i+j*YLDim];
+    }
+}
+
+template<typename T,typename S>
+void Axpby
+( S alpha, const ElementalMatrix<T>& X, S beta, ElementalMatrix<T>& Y )
+{
+    DEBUG_ONLY(CSE cse("Axpby"))
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        LogicError("Nonconformal Axpby");
+    AssertSameGrids( X, Y );
+    const ElementalData XDistData = X.DistData();
+    const ElementalData YDistData = Y.DistData();
+    if( XDistData.colDist == YDistData.colDist &&
+        XDistData.rowDist == YDistData.rowDist &&
+        X.ColAlign() == Y.ColAlign() && X.RowAlign() == Y.RowAlign() &&
+        X.Root() == Y.Root() )
+    {
+        Axpby( alpha, X.LockedMatrix(), beta, Y.Matrix() );
+    }
+    else
+    {
+        // Fall back to separate passes, which redistribute X if necessary
+        Scale( beta, Y );
+        Axpy( alpha, X, Y );
+    }
+}
+
+template<typename T,typename S>
+void Axpby( S alpha, const DistMultiVec<T>& X, S beta, DistMultiVec<T>& Y )
+{
+    DEBUG_ONLY(
+      CSE cse("Axpby");
+      if( !mpi::Congruent( X.Comm(), Y.Comm() ) )
+          LogicError("X and Y must have congruent communicators");
+    )
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        LogicError("Nonconformal Axpby");
+    Axpby( alpha, X.LockedMatrix(), beta, Y.Matrix() );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template void Axpby \
+  ( T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ); \
+  EL_EXTERN template void Axpby \
+  ( T alpha, const ElementalMatrix<T>& X, T beta, ElementalMatrix<T>& Y ); \
+  EL_EXTERN template void Axpby \
+  ( T alpha, const DistMultiVec<T>& X, T beta, DistMultiVec<T>& Y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_AXPBY_HPP
@@ -0,0 +1,136 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_AXPYDOT_HPP
+#define EL_BLAS_AXPYDOT_HPP
+
+// Return (X + alpha dX)^H (Y + beta dY) without forming either update, e.g.,
+// the complementarity of a trial step of an Interior Point Method
+
+namespace El {
+
+template<typename T,typename S>
+T AxpyDot
+( S alphaS, const Matrix<T>& dX, const Matrix<T>& X,
+  S betaS,  const Matrix<T>& dY, const Matrix<T>& Y )
+{
+    DEBUG_ONLY(CSE cse("AxpyDot"))
+    const Int height = X.Height();
+    const Int width = X.Width();
+    if( dX.Height() != height || dX.Width() != width ||
+        dY.Height() != height || dY.Width() != width ||
+         Y.Height() != height ||  Y.Width() != width )
+        LogicError("Matrices must be the same size");
+    const T alpha = T(alphaS);
+    const T beta = T(betaS);
+    const T* dXBuf = dX.LockedBuffer();
+    const T*  XBuf =  X.LockedBuffer();
+    const T* dYBuf = dY.LockedBuffer();
+    const T*  YBuf =  Y.LockedBuffer();
+    const Int dXLDim = dX.LDim();
+    const Int  XLDim =  X.LDim();
+    const Int dYLDim = dY.LDim();
+    const Int  YLDim =  Y.LDim();
+
+    T innerProd(0);
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            innerProd +=
+              Conj(XBuf[i+j*XLDim]+alpha*dXBuf[i+j*dXLDim])*
+                  (YBuf[i+j*YLDim]+beta*dYBuf[i+j*dYLDim]);
+    return innerProd;
+}
+
+template<typename T,typename S>
+T AxpyDot
+( S alpha, const ElementalMatrix<T>& dX, const ElementalMatrix<T>& X,
+  S beta,  const ElementalMatrix<T>& dY, const ElementalMatrix<T>& Y )
+{
+    DEBUG_ONLY(CSE cse("AxpyDot"))
+    AssertSameGrids( dX, X, dY, Y );
+    const ElementalData XDistData = X.DistData();
+    bool fusable = true;
+    for( const ElementalMatrix<T>* A : { &dX, &dY, &Y } )
+    {
+        const ElementalData ADistData = A->DistData();
+        if( ADistData.colDist != XDistData.colDist ||
+            ADistData.rowDist != XDistData.rowDist ||
+            A->ColAlign() != X.ColAlign() || A->RowAlign() != X.RowAlign() ||
+            A->Root() != X.Root() )
+            fusable = false;
+    }
+    if( !fusable )
+    {
+        // Fall back to explicitly forming the updated matrices
+        unique_ptr<ElementalMatrix<T>> XNew( X.Copy() ), YNew( Y.Copy() );
+        Axpy( alpha, dX, *XNew );
+        Axpy( beta, dY, *YNew );
+        return Dot( *XNew, *YNew );
+    }
+
+    T innerProd;
+    if( X.Participating() )
+    {
+        const T localInnerProd =
+          AxpyDot
+          ( alpha, dX.LockedMatrix(), X.LockedMatrix(),
+            beta,  dY.LockedMatrix(), Y.LockedMatrix() );
+        innerProd = mpi::AllReduce( localInnerProd, X.DistComm() );
+    }
+    mpi::Broadcast( innerProd, X.Root(), X.CrossComm() );
+    return innerProd;
+}
+
+template<typename T,typename S>
+T AxpyDot
+( S alpha, const DistMultiVec<T>& dX, const DistMultiVec<T>& X,
+  S beta,  const DistMultiVec<T>& dY, const DistMultiVec<T>& Y )
+{
+    DEBUG_ONLY(
+      CSE cse("AxpyDot");
+      if( !mpi::Congruent( dX.Comm(), X.Comm() ) ||
+          !mpi::Congruent( dY.Comm(), X.Comm() ) ||
+          !mpi::Congruent(  Y.Comm(), X.Comm() ) )
+          LogicError("Multivectors must have congruent communicators");
+    )
+    const T localInnerProd =
+      AxpyDot
+      ( alpha, dX.LockedMatrix(), X.LockedMatrix(),
+        beta,  dY.LockedMatrix(), Y.LockedMatrix() );
+    return mpi::AllReduce( localInnerProd, X.Comm() );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template T AxpyDot \
+  ( T alpha, const Matrix<T>& dX, const Matrix<T>& X, \
+    T beta,  const Matrix<T>& dY, const Matrix<T>& Y ); \
+  EL_EXTERN template T AxpyDot \
+  ( T alpha, const ElementalMatrix<T>& dX, const ElementalMatrix<T>& X, \
+    T beta,  const ElementalMatrix<T>& dY, const ElementalMatrix<T>& Y ); \
+  EL_EXTERN template T AxpyDot \
+  ( T alpha, const DistMultiVec<T>& dX, const DistMultiVec<T>& X, \
+    T beta,  const DistMultiVec<T>& dY, const DistMultiVec<T>& Y );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_AXPYDOT_HPP
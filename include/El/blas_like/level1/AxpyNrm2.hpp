@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_AXPYNRM2_HPP
+#define EL_BLAS_AXPYNRM2_HPP
+
+// Y := Y + alpha X and return the Frobenius norm of the result, which is
+// accumulated (in the scaled form used by FrobeniusNorm) during the update
+
+namespace El {
+
+namespace axpy_nrm2 {
+
+template<typename F,typename S>
+void LocalUpdate
+( S alphaS, const Matrix<F>& X, Matrix<F>& Y,
+  Base<F>& scale, Base<F>& scaledSquare )
+{
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        LogicError("Nonconformal AxpyNrm2");
+    const F alpha = F(alphaS);
+    const Int height = X.Height();
+    const Int width = X.Width();
+    const F* XBuf = X.LockedBuffer();
+          F* YBuf = Y.Buffer();
+    const Int XLDim = X.LDim();
+    const Int YLDim = Y.LDim();
+    for( Int j=0; j<width; ++j )
+    {
+        for( Int i=0; i<height; ++i )
+        {
+            F& upsilon = YBuf[i+j*YLDim];
+            upsilon += alpha*XBuf[i+j*XLDim];
+            UpdateScaledSquare( upsilon, scale, scaledSquare );
+        }
+    }
+}
+
+template<typename Real>
+Real ReduceNorm( Real locScale, Real locScaledSquare, mpi::Comm comm )
+{
+    // Find the maximum relative scale
+    const Real scale = mpi::AllReduce( locScale, mpi::MAX, comm );
+    if( scale == Real(0) )
+        return Real(0);
+
+    // Equilibrate our local scaled sum to the maximum scale
+    const Real relScale = locScale/scale;
+    locScaledSquare *= relScale*relScale;
+
+    // The scaled square is now the sum of the local contributions
+    const Real scaledSquare = mpi::AllReduce( locScaledSquare, comm );
+    return scale*Sqrt(scaledSquare);
+}
+
+} // namespace axpy_nrm2
+
+template<typename F,typename S>
+Base<F> AxpyNrm2( S alpha, const Matrix<F>& X, Matrix<F>& Y )
+{
+    DEBUG_ONLY(CSE cse("AxpyNrm2"))
+    typedef Base<F> Real;
+    Real scale=0, scaledSquare=1;
+    axpy_nrm2::LocalUpdate( alpha, X, Y, scale, scaledSquare );
+    return scale*Sqrt(scaledSquare);
+}
+
+template<typename F,typename S>
+Base<F> AxpyNrm2( S alpha, const ElementalMatrix<F>& X, ElementalMatrix<F>& Y )
+{
+    DEBUG_ONLY(CSE cse("AxpyNrm2"))
+    typedef Base<F> Real;
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        LogicError("Nonconformal AxpyNrm2");
+    AssertSameGrids( X, Y );
+    const ElementalData XDistData = X.DistData();
+    const ElementalData YDistData = Y.DistData();
+    if( XDistData.colDist != YDistData.colDist ||
+        XDistData.rowDist != YDistData.rowDist ||
+        X.ColAlign() != Y.ColAlign() || X.RowAlign() != Y.RowAlign() ||
+        X.Root() != Y.Root() )
+    {
+        // Fall back to separate passes, which redistribute X if necessary
+        Axpy( alpha, X, Y );
+        return FrobeniusNorm( Y );
+    }
+
+    Real norm;
+    if( Y.Participating() )
+    {
+        Real locScale=0, locScaledSquare=1;
+        axpy_nrm2::LocalUpdate
+        ( alpha, X.LockedMatrix(), Y.Matrix(), locScale, locScaledSquare );
+        norm = axpy_nrm2::ReduceNorm( locScale, locScaledSquare, Y.DistComm() );
+    }
+    mpi::Broadcast( norm, Y.Root(), Y.CrossComm() );
+    return norm;
+}
+
+template<typename F,typename S>
+Base<F> AxpyNrm2( S alpha, const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+{
+    DEBUG_ONLY(
+      CSE cse("AxpyNrm2");
+      if( !mpi::Congruent( X.Comm(), Y.Comm() ) )
+          LogicError("X and Y must have congruent communicators");
+    )
+    typedef Base<F> Real;
+    Real locScale=0, locScaledSquare=1;
+    axpy_nrm2::LocalUpdate
+    ( alpha, X.LockedMatrix(), Y.Matrix(), locScale, locScaledSquare );
+    return axpy_nrm2::ReduceNorm( locScale, locScaledSquare, Y.Comm() );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(F) \
+  EL_EXTERN template Base<F> AxpyNrm2 \
+  ( F alpha, const Matrix<F>& X, Matrix<F>& Y ); \
+  EL_EXTERN template Base<F> AxpyNrm2 \
+  ( F alpha, const ElementalMatrix<F>& X, ElementalMatrix<F>& Y ); \
+  EL_EXTERN template Base<F> AxpyNrm2 \
+  ( F alpha, const DistMultiVec<F>& X, DistMultiVec<F>& Y );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_AXPYNRM2_HPP
@@ -23,6 +23,18 @@ void Copy( const Matrix<T>& A, Matrix<T>& B )
     const Int width = A.Width();
     B.Resize( height, width ); 
 
+#ifdef EL_HYBRID
+    // Copy each column with the thread that owns it under NUMA_FIRST_TOUCH
+    // (forking is only worthwhile for large copies)
+    if( B.NumaPolicy() != NUMA_DEFAULT )
+    {
+        const Int numThreads = copy::util::PackThreads( height*width );
+        EL_PARALLEL_FOR_THREADS(numThreads)
+        for( Int j=0; j<width; ++j )
+            MemCopy( B.Buffer(0,j), A.LockedBuffer(0,j), height );
+        return;
+    }
+#endif
     lapack::Copy
     ( 'F', A.Height(), A.Width(),
       A.LockedBuffer(), A.LDim(), B.Buffer(), B.LDim() );
@@ -64,6 +76,20 @@ void Copy( const ElementalMatrix<S>& A, DistMatrix<T,U,V>& B )
             return;
         }
     }
+    if( sizeof(T) < sizeof(S) )
+    {
+        // Convert before redistributing so that the smaller type is sent
+        #define GUARD(CDIST,RDIST) \
+          A.ColDist() == CDIST && A.RowDist() == RDIST
+        #define PAYLOAD(CDIST,RDIST) \
+          DistMatrix<T,CDIST,RDIST> AConv(A.Grid(),A.Root()); \
+          AConv.AlignAndResize \
+          ( A.ColAlign(), A.RowAlign(), A.Height(), A.Width(), true ); \
+          Copy( A.LockedMatrix(), AConv.Matrix() ); \
+          B = AConv;
+        #include "El/macros/GuardAndPayload.h"
+        return;
+    }
     DistMatrix<S,U,V> BOrig(A.Grid());
     BOrig.AlignWith( B );
     BOrig = A;
@@ -103,6 +129,21 @@ void Copy( const BlockMatrix<S>& A, DistMatrix<T,U,V,BLOCK>& B )
             return;
         }
     }
+    if( sizeof(T) < sizeof(S) )
+    {
+        // Convert before redistributing so that the smaller type is sent
+        #define GUARD(CDIST,RDIST) \
+          A.ColDist() == CDIST && A.RowDist() == RDIST
+        #define PAYLOAD(CDIST,RDIST) \
+          DistMatrix<T,CDIST,RDIST,BLOCK> AConv(A.Grid(),A.Root()); \
+          AConv.AlignAndResize \
+          ( A.BlockHeight(), A.BlockWidth(), A.ColAlign(), A.RowAlign(), \
+            A.ColCut(), A.RowCut(), A.Height(), A.Width(), true ); \
+          Copy( A.LockedMatrix(), AConv.Matrix() ); \
+          B = AConv;
+        #include "El/macros/GuardAndPayload.h"
+        return;
+    }
     DistMatrix<S,U,V,BLOCK> BOrig(A.Grid());
     BOrig.AlignWith( B );
     BOrig = A;
@@ -178,6 +219,23 @@ void Copy( const BlockMatrix<S>& A, BlockMatrix<T>& B )
     #include "El/macros/GuardAndPayload.h"
 }
 
+template<typename T>
+void ReducedPrecisionCopy
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("ReducedPrecisionCopy"))
+    copy::ReducedPrecision( A, B );
+}
+
+template<typename T>
+void Copy
+( const vector<const AbstractDistMatrix<T>*>& A,
+  const vector<AbstractDistMatrix<T>*>& B )
+{
+    DEBUG_ONLY(CSE cse("Copy (batch of ADM<T>)"))
+    copy::TranslateBetweenGrids( A, B );
+}
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers )
@@ -420,11 +478,11 @@ void CopyFromRoot( const DistMultiVec<T>& XDist, Matrix<T>& X )
     const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
 
-    const int numLocalEntries = XDist.LocalHeight()*n;
-    vector<int> entrySizes(commSize);
+    const Int numLocalEntries = XDist.LocalHeight()*n;
+    vector<Int> entrySizes(commSize);
     mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
-    vector<int> entryOffs;
-    const int numEntries = Scan( entrySizes, entryOffs );
+    vector<Int> entryOffs;
+    const Int numEntries = Scan( entrySizes, entryOffs );
 
     vector<T> recvBuf;
     FastResize( recvBuf, numEntries );
@@ -473,10 +531,10 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
     if( commRank == root )
         LogicError("Called CopyFromNonRoot from root");
 
-    const int numLocalEntries = XDist.LocalHeight()*XDist.Width();
-    vector<int> entrySizes(commSize);
+    const Int numLocalEntries = XDist.LocalHeight()*XDist.Width();
+    vector<Int> entrySizes(commSize);
     mpi::AllGather( &numLocalEntries, 1, entrySizes.data(), 1, comm );
-    vector<int> entryOffs;
+    vector<Int> entryOffs;
     Scan( entrySizes, entryOffs );
 
     const auto& XDistLoc = XDist.LockedMatrix();
@@ -510,6 +568,11 @@ void CopyFromNonRoot( const DistMultiVec<T>& XDist, int root )
   ( const Matrix<T>& A, Matrix<T>& B ); \
   EL_EXTERN template void Copy \
   ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void ReducedPrecisionCopy \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B ); \
+  EL_EXTERN template void Copy \
+  ( const vector<const AbstractDistMatrix<T>*>& A, \
+    const vector<AbstractDistMatrix<T>*>& B ); \
   EL_EXTERN template void CopyFromRoot \
   ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B, bool includingViewers ); \
   EL_EXTERN template void CopyFromNonRoot \
@@ -39,10 +39,9 @@ void AllGather
             const Int maxLocalHeight = MaxLength(height,colStride);
             const Int maxLocalWidth = MaxLength(width,rowStride);
             const Int portionSize = mpi::Pad( maxLocalHeight*maxLocalWidth );
-            vector<T> buf;
-            FastResize( buf, (distStride+1)*portionSize );
-            T* sendBuf = &buf[0];
-            T* recvBuf = &buf[portionSize];
+            Memory<T> buf( (distStride+1)*portionSize );
+            T* sendBuf = buf.Buffer();
+            T* recvBuf = &sendBuf[portionSize];
 
             // Pack
             util::InterleaveMatrix
@@ -68,23 +67,22 @@ void AllGather
         // Pack from the root
         const Int BLocalHeight = B.LocalHeight();
         const Int BLocalWidth = B.LocalWidth();
-        vector<T> buf;
-        FastResize( buf, BLocalHeight*BLocalWidth );
+        Memory<T> buf( BLocalHeight*BLocalWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
             ( BLocalHeight, BLocalWidth,
               B.LockedBuffer(), 1, B.LDim(),
-              buf.data(),       1, BLocalHeight ); 
+              buf.Buffer(),     1, BLocalHeight ); 
 
         // Broadcast from the root
         mpi::Broadcast
-        ( buf.data(), BLocalHeight*BLocalWidth, A.Root(), A.CrossComm() );
+        ( buf.Buffer(), BLocalHeight*BLocalWidth, A.Root(), A.CrossComm() );
 
         // Unpack if not the root
         if( A.CrossRank() != A.Root() )
             util::InterleaveMatrix
             ( BLocalHeight, BLocalWidth,
-              buf.data(), 1, BLocalHeight,
+              buf.Buffer(), 1, BLocalHeight,
               B.Buffer(), 1, B.LDim() );
     }
 }
@@ -48,25 +48,24 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             else if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> bcastBuf;
-                FastResize( bcastBuf, localWidthB );
+                Memory<T> bcastBuf( localWidthB );
 
                 if( A.ColRank() == A.ColAlign() )
                 {
                     B.Matrix() = A.LockedMatrix();
                     StridedMemCopy
-                    ( bcastBuf.data(),  1,
+                    ( bcastBuf.Buffer(),  1,
                       B.LockedBuffer(), B.LDim(), localWidthB );
                 }
 
                 // Broadcast within the column comm
                 mpi::Broadcast
-                ( bcastBuf.data(), localWidthB, A.ColAlign(), A.ColComm() );
+                ( bcastBuf.Buffer(), localWidthB, A.ColAlign(), A.ColComm() );
 
                 // Unpack
                 StridedMemCopy
                 ( B.Buffer(),      B.LDim(), 
-                  bcastBuf.data(), 1,        localWidthB );
+                  bcastBuf.Buffer(), 1,        localWidthB );
             }
             else
             {
@@ -75,10 +74,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int localWidth = A.LocalWidth();
                 const Int portionSize = mpi::Pad( maxLocalHeight*localWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = &sendBuf[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -109,15 +107,15 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
             if( height == 1 )
             {
                 const Int localWidthB = B.LocalWidth();
-                vector<T> buffer;
+                Memory<T> buffer;
                 T* bcastBuf;
 
                 if( A.ColRank() == A.ColAlign() )
                 {
                     const Int localWidth = A.LocalWidth();
-                    FastResize( buffer, localWidth+localWidthB );
-                    T* sendBuf = &buffer[0];
-                    bcastBuf   = &buffer[localWidth];
+                    buffer.Require( localWidth+localWidthB );
+                    T* sendBuf = buffer.Buffer();
+                    bcastBuf   = &sendBuf[localWidth];
 
                     // Pack
                     StridedMemCopy
@@ -130,8 +128,8 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 }
                 else
                 {
-                    FastResize( buffer, localWidthB );
-                    bcastBuf = buffer.data();
+                    buffer.Require( localWidthB );
+                    bcastBuf = buffer.Buffer();
                 }
 
                 // Communicate
@@ -150,10 +148,9 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int portionSize =
                     mpi::Pad( maxLocalHeight*maxLocalWidth );
 
-                vector<T> buffer;
-                FastResize( buffer, (colStride+1)*portionSize );
-                T* firstBuf  = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (colStride+1)*portionSize );
+                T* firstBuf  = buffer.Buffer();
+                T* secondBuf = &firstBuf[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -184,23 +181,22 @@ void ColAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
-        FastResize( buf, localHeight*localWidth );
+        Memory<T> buf( localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
               B.LockedBuffer(), 1, B.LDim(),
-              buf.data(),       1, localHeight );
+              buf.Buffer(),     1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
-        ( buf.data(), localHeight*localWidth, A.Root(), A.CrossComm() );
+        ( buf.Buffer(), localHeight*localWidth, A.Root(), A.CrossComm() );
 
         // Unpack if not the root
         if( A.CrossRank() != A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
-              buf.data(), 1, localHeight,
+              buf.Buffer(), 1, localHeight,
               B.Buffer(), 1, B.LDim() );
     }
 }
@@ -51,10 +51,9 @@ void ColAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &firstBuf[colStrideUnion*portionSize];
 
             // Pack            
             util::PartialColStridedPack
@@ -87,10 +86,9 @@ void ColAllToAllDemote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &firstBuf[colStrideUnion*portionSize];
 
         // Pack
         util::PartialColStridedPack
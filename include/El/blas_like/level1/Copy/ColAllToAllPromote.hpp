@@ -45,10 +45,9 @@ void ColAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*colStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[colStrideUnion*portionSize];
+            Memory<T> buffer( 2*colStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &firstBuf[colStrideUnion*portionSize];
 
             // Pack            
             util::RowStridedPack
@@ -81,10 +80,9 @@ void ColAllToAllPromote
         const Int sendColRankPart = Mod( colRankPart+colDiff, colStridePart );
         const Int recvColRankPart = Mod( colRankPart-colDiff, colStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*colStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[colStrideUnion*portionSize];
+        Memory<T> buffer( 2*colStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &firstBuf[colStrideUnion*portionSize];
 
         // Pack
         util::RowStridedPack
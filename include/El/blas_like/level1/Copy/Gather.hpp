@@ -46,12 +46,12 @@ void Gather
     // Gather the payload data
     // =======================
     const bool irrelevant = ( A.RedundantRank()!=0 || A.CrossRank()!=A.Root() );
-    int totalSend = ( irrelevant ? 0 : A.LocalHeight()*A.LocalWidth() );
-    vector<int> recvCounts, recvOffsets;
+    Int totalSend = ( irrelevant ? 0 : A.LocalHeight()*A.LocalWidth() );
+    vector<Int> recvCounts, recvOffsets;
     if( B.CrossRank() == B.Root() )
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
-    int totalRecv = Scan( recvCounts, recvOffsets );
+    Int totalRecv = Scan( recvCounts, recvOffsets );
     vector<T> sendBuf, recvBuf;
     FastResize( sendBuf, totalSend );
     FastResize( recvBuf, totalRecv );
@@ -121,12 +121,12 @@ void Gather
     // Gather the payload data
     // =======================
     const bool irrelevant = ( A.RedundantRank()!=0 || A.CrossRank()!=A.Root() );
-    int totalSend = ( irrelevant ? 0 : A.LocalHeight()*A.LocalWidth() );
-    vector<int> recvCounts, recvOffsets;
+    Int totalSend = ( irrelevant ? 0 : A.LocalHeight()*A.LocalWidth() );
+    vector<Int> recvCounts, recvOffsets;
     if( B.CrossRank() == B.Root() )
         recvCounts.resize( crossSize );
     mpi::Gather( &totalSend, 1, recvCounts.data(), 1, B.Root(), B.CrossComm() );
-    int totalRecv = Scan( recvCounts, recvOffsets );
+    Int totalRecv = Scan( recvCounts, recvOffsets );
     vector<T> sendBuf, recvBuf;
     FastResize( sendBuf, totalSend );
     FastResize( recvBuf, totalRecv );
@@ -161,6 +161,9 @@ void Gather
             const Int localWidth = 
               BlockedLength( width, rowShift, nb, rowCut, rowStride );
             const T* data = &recvBuf[recvOffsets[q]];
+            const Int numThreads =
+              copy::util::PackThreads( localHeight*localWidth );
+            EL_PARALLEL_FOR_THREADS(numThreads)
             for( Int jLoc=0; jLoc<localWidth; ++jLoc )
             {
                 const Int jBefore = rowShift*nb - rowCut;
@@ -12,15 +12,48 @@
 namespace El {
 namespace copy {
 
-template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
-void Helper
-( const AbstractDistMatrix<S>& A,
-        AbstractDistMatrix<T>& B ) 
+// The general-purpose redistribution only transmits the values of the
+// entries. Both A and B store their local entries in increasing order of
+// global index, so the entries which the process owning the (process) row r
+// and column c of A sends to a process of B can be packed, and unpacked, in
+// column-major order over the local rows and columns of the receiver which
+// are owned by row r and column c of A.
+
+// The smaller of two datatypes (preferring the source datatype in a tie)
+template<typename S,typename T>
+using TransmissionType =
+  typename std::conditional<(sizeof(T)<sizeof(S)),T,S>::type;
+
+inline void BucketIndices
+( Int numLocal, Int numOwners, function<int(Int)> owner, IndexBuckets& buckets )
 {
-    DEBUG_ONLY(CSE cse("copy::Helper"))
+    DEBUG_ONLY(CSE cse("copy::BucketIndices"))
+    vector<int> owners(numLocal);
+    buckets.offsets.assign( numOwners+1, 0 );
+    for( Int iLoc=0; iLoc<numLocal; ++iLoc )
+    {
+        owners[iLoc] = owner( iLoc );
+        ++buckets.offsets[owners[iLoc]+1];
+    }
+    for( Int q=0; q<numOwners; ++q )
+        buckets.offsets[q+1] += buckets.offsets[q];
+    auto offs = buckets.offsets;
+    FastResize( buckets.indices, numLocal );
+    for( Int iLoc=0; iLoc<numLocal; ++iLoc )
+        buckets.indices[offs[owners[iLoc]]++] = iLoc;
+}
 
-    // TODO: Decide whether S or T should be used as the transmission type
-    //       based upon which is smaller. Transmit S by default.
+// Resize B and determine how the entries of A which this process owns are to
+// be packed for an AllToAll over 'comm'. False is returned if this process
+// does not take part in the exchange.
+template<typename S,typename T>
+bool PackPlanHelper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        PackPlan& plan,
+        mpi::Comm& comm )
+{
+    DEBUG_ONLY(CSE cse("copy::PackPlanHelper"))
     const Int height = A.Height();
     const Int width = A.Width();
     const Grid& g = B.Grid();
@@ -30,134 +63,282 @@ void Helper
     const bool BPartic = B.Participating();
 
     const bool includeViewers = (A.Grid() != B.Grid());
+    if( includeViewers )
+    {
+        comm = g.ViewingComm();
+    }
+    else
+    {
+        if( !g.InGrid() )
+            return false;
+        comm = g.VCComm();
+    }
+    const int commSize = mpi::Size( comm );
 
-    const Int localHeight = A.LocalHeight();
-    const Int localWidth = A.LocalWidth();
+    // Map the (distribution) ranks of B to ranks in the communicator
+    const int colStride = B.ColStride();
+    const int rowStride = B.RowStride();
+    plan.distMap.resize( colStride*rowStride );
+    for( int q=0; q<colStride*rowStride; ++q )
+    {
+        const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
+        plan.distMap[q] =
+          ( includeViewers ? g.VCToViewing(vcOwner) : vcOwner );
+    }
+
+    plan.sendCounts.assign( commSize, 0 );
+    plan.directRow = plan.directCol = -1;
+    if( !A.Participating() || A.RedundantRank() != 0 )
+    {
+        plan.rows.offsets.assign( colStride+1, 0 );
+        plan.rows.indices.clear();
+        plan.cols.offsets.assign( rowStride+1, 0 );
+        plan.cols.indices.clear();
+        plan.totalSend = Scan( plan.sendCounts, plan.sendOffs );
+        return true;
+    }
+
+    // Bucket the local rows and columns of A by their owners in B
+    BucketIndices
+    ( A.LocalHeight(), colStride,
+      [&]( Int iLoc ) { return B.RowOwner(A.GlobalRow(iLoc)); }, plan.rows );
+    BucketIndices
+    ( A.LocalWidth(), rowStride,
+      [&]( Int jLoc ) { return B.ColOwner(A.GlobalCol(jLoc)); }, plan.cols );
 
-    // TODO: Break into smaller pieces to avoid excessive memory usage?
-    vector<Entry<S>> remoteEntries;
-    vector<int> distOwners;
-    if( A.RedundantRank() == 0 )
+    // Entries which this process owns in B are copied directly (unless B has
+    // redundant copies which must receive them as well)
+    if( BPartic && B.RedundantSize() == 1 )
     {
-        const bool noRedundant = B.RedundantSize() == 1;
-        const int colStride = B.ColStride();
-        const int rowRank = B.RowRank();
-        const int colRank = B.ColRank();
-
-        vector<Int> globalRows(localHeight), localRows(localHeight);
-        vector<int> ownerRows(localHeight);
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        plan.directRow = B.ColRank();
+        plan.directCol = B.RowRank();
+        const Int* rowInds =
+          plan.rows.indices.data()+plan.rows.offsets[plan.directRow];
+        const Int* colInds =
+          plan.cols.indices.data()+plan.cols.offsets[plan.directCol];
+        const Int numRows =
+          plan.rows.offsets[plan.directRow+1]-plan.rows.offsets[plan.directRow];
+        const Int numCols =
+          plan.cols.offsets[plan.directCol+1]-plan.cols.offsets[plan.directCol];
+        FastResize( plan.directLocalRows, numRows );
+        FastResize( plan.directLocalCols, numCols );
+        for( Int s=0; s<numRows; ++s )
+            plan.directLocalRows[s] = B.LocalRow(A.GlobalRow(rowInds[s]));
+        for( Int t=0; t<numCols; ++t )
+            plan.directLocalCols[t] = B.LocalCol(A.GlobalCol(colInds[t]));
+    }
+
+    for( int rowOwner=0; rowOwner<colStride; ++rowOwner )
+    {
+        const Int numRows =
+          plan.rows.offsets[rowOwner+1] - plan.rows.offsets[rowOwner];
+        for( int colOwner=0; colOwner<rowStride; ++colOwner )
         {
-            const Int i = A.GlobalRow(iLoc);
-            const int ownerRow = B.RowOwner(i);
-            globalRows[iLoc] = i;
-            ownerRows[iLoc] = ownerRow;
-            localRows[iLoc] = B.LocalRow(i,ownerRow);
+            if( rowOwner == plan.directRow && colOwner == plan.directCol )
+                continue;
+            const Int numCols =
+              plan.cols.offsets[colOwner+1] - plan.cols.offsets[colOwner];
+            plan.sendCounts[plan.distMap[rowOwner+colOwner*colStride]] +=
+              numRows*numCols;
         }
+    }
+    plan.totalSend = Scan( plan.sendCounts, plan.sendOffs );
+    return true;
+}
 
-        remoteEntries.reserve( localHeight*localWidth );
-        distOwners.reserve( localHeight*localWidth );
-        const S* ABuf = A.LockedBuffer();
-        const Int ALDim = A.LDim();
-        for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+// Directly copy the entries of A which this process owns in B and pack the
+// remaining entries (in the order described above) as the transmission
+// type W
+template<typename S,typename T,typename W,typename=EnableIf<CanCast<S,T>>>
+void Pack
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+  const PackPlan& plan,
+        W* sendBuf )
+{
+    DEBUG_ONLY(CSE cse("copy::Pack"))
+    const Int colStride = plan.rows.offsets.size()-1;
+    const Int rowStride = plan.cols.offsets.size()-1;
+    const S* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    for( Int colOwner=0; colOwner<rowStride; ++colOwner )
+    {
+        const Int* colInds =
+          plan.cols.indices.data()+plan.cols.offsets[colOwner];
+        const Int numCols =
+          plan.cols.offsets[colOwner+1]-plan.cols.offsets[colOwner];
+        for( Int rowOwner=0; rowOwner<colStride; ++rowOwner )
         {
-            const Int j = A.GlobalCol(jLoc);
-            const int ownerCol = B.ColOwner(j);
-            const Int localCol = B.LocalCol(j,ownerCol);
-            const bool isLocalCol = ( BPartic && ownerCol == rowRank );
-            for( Int iLoc=0; iLoc<localHeight; ++iLoc ) 
+            const Int* rowInds =
+              plan.rows.indices.data()+plan.rows.offsets[rowOwner];
+            const Int numRows =
+              plan.rows.offsets[rowOwner+1]-plan.rows.offsets[rowOwner];
+            if( numRows == 0 || numCols == 0 )
+                continue;
+            if( rowOwner == plan.directRow && colOwner == plan.directCol )
             {
-                const int ownerRow = ownerRows[iLoc];
-                const Int localRow = localRows[iLoc];
-                const bool isLocalRow = ( BPartic && ownerRow == colRank );
-                const S alpha = ABuf[iLoc+jLoc*ALDim];
-                if( noRedundant && isLocalRow && isLocalCol )
+                T* BBuf = B.Buffer();
+                const Int BLDim = B.LDim();
+                for( Int t=0; t<numCols; ++t )
                 {
-                    B.SetLocal( localRow, localCol, Caster<S,T>::Cast(alpha) );
-                }
-                else
-                {
-                    remoteEntries.push_back
-                    ( Entry<S>{localRow,localCol,alpha} );
-                    distOwners.push_back( ownerRow + colStride*ownerCol );
+                    const S* ACol = &ABuf[colInds[t]*ALDim];
+                    T* BCol = &BBuf[plan.directLocalCols[t]*BLDim];
+                    for( Int s=0; s<numRows; ++s )
+                        BCol[plan.directLocalRows[s]] =
+                          Caster<S,T>::Cast(ACol[rowInds[s]]);
                 }
+                continue;
+            }
+            const int owner = plan.distMap[rowOwner+colOwner*colStride];
+            W* sendPortion = &sendBuf[plan.sendOffs[owner]];
+            for( Int t=0; t<numCols; ++t )
+            {
+                const S* ACol = &ABuf[colInds[t]*ALDim];
+                for( Int s=0; s<numRows; ++s )
+                    sendPortion[s] = Caster<S,W>::Cast(ACol[rowInds[s]]);
+                sendPortion += numRows;
             }
-        }    
+        }
     }
+}
 
-    // Compute the metadata
-    // ====================
-    const Int totalSend = remoteEntries.size();
-    mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
-    if( includeViewers )
-    {
-        comm = g.ViewingComm();
-        const int commSize = mpi::Size( comm );
-
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-        {
-            const int vcOwner = g.CoordsToVC(colDist,rowDist,q,root);
-            distMap[q] = g.VCToViewing(vcOwner);
-        }
+// Resize B, directly copy the entries of A which this process owns in B, and
+// pack the remaining entries for an AllToAll over 'comm'. False is returned
+// if this process does not take part in the exchange.
+template<typename S,typename T,typename W,typename=EnableIf<CanCast<S,T>>>
+bool PackHelper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B,
+        vector<W>& sendBuf,
+        vector<Int>& sendCounts,
+        vector<Int>& sendOffs,
+        mpi::Comm& comm )
+{
+    DEBUG_ONLY(CSE cse("copy::PackHelper"))
+    PackPlan plan;
+    if( !PackPlanHelper( A, B, plan, comm ) )
+        return false;
+    FastResize( sendBuf, plan.totalSend );
+    Pack( A, B, plan, sendBuf.data() );
+    sendCounts = std::move(plan.sendCounts);
+    sendOffs = std::move(plan.sendOffs);
+    return true;
+}
 
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
-        }
+// Exchange the number of entries (and the process row and column of A they
+// originate from) and determine where the received entries belong in B
+template<typename S,typename T>
+void PlanHelper
+( const AbstractDistMatrix<S>& A,
+  const AbstractDistMatrix<T>& B,
+  const vector<Int>& sendCounts,
+        mpi::Comm comm,
+        UnpackPlan& plan )
+{
+    DEBUG_ONLY(CSE cse("copy::PlanHelper"))
+    const int commSize = mpi::Size( comm );
+    const bool sending = ( A.Participating() && A.RedundantRank() == 0 );
+    const int sourceRow = ( sending ? A.ColRank() : 0 );
+    const int sourceCol = ( sending ? A.RowRank() : 0 );
+    vector<Int> sendMeta(3*commSize), recvMeta(3*commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendMeta[3*q  ] = sendCounts[q];
+        sendMeta[3*q+1] = sourceRow;
+        sendMeta[3*q+2] = sourceCol;
     }
-    else
+    mpi::AllToAll( sendMeta.data(), 3, recvMeta.data(), 3, comm );
+
+    plan.recvCounts.resize( commSize );
+    plan.sourceRows.resize( commSize );
+    plan.sourceCols.resize( commSize );
+    for( int q=0; q<commSize; ++q )
     {
-        if( !g.InGrid() )
-            return;
-        comm = g.VCComm();
-        const int commSize = mpi::Size( comm );
+        plan.recvCounts[q] = recvMeta[3*q  ];
+        plan.sourceRows[q] = recvMeta[3*q+1];
+        plan.sourceCols[q] = recvMeta[3*q+2];
+    }
+    plan.totalRecv = Scan( plan.recvCounts, plan.recvOffs );
 
-        vector<int> distMap(commSize);
-        for( int q=0; q<commSize; ++q )
-            distMap[q] = g.CoordsToVC(colDist,rowDist,q,root);
+    BucketIndices
+    ( B.LocalHeight(), A.ColStride(),
+      [&]( Int iLoc ) { return A.RowOwner(B.GlobalRow(iLoc)); }, plan.rows );
+    BucketIndices
+    ( B.LocalWidth(), A.RowStride(),
+      [&]( Int jLoc ) { return A.ColOwner(B.GlobalCol(jLoc)); }, plan.cols );
+    DEBUG_ONLY(
+      for( int q=0; q<commSize; ++q )
+      {
+          if( plan.recvCounts[q] == 0 )
+              continue;
+          const int r = plan.sourceRows[q];
+          const int c = plan.sourceCols[q];
+          const Int numRows = plan.rows.offsets[r+1]-plan.rows.offsets[r];
+          const Int numCols = plan.cols.offsets[c+1]-plan.cols.offsets[c];
+          if( plan.recvCounts[q] != numRows*numCols )
+              LogicError
+              ("Expected ",numRows*numCols," entries from process ",q,
+               " but received ",plan.recvCounts[q]);
+      }
+    )
+}
 
-        sendCounts.resize(commSize,0);
-        for( Int k=0; k<totalSend; ++k )
-        {
-            owners[k] = distMap[distOwners[k]];
-            ++sendCounts[owners[k]];
-        }
-    }
-    SwapClear( distOwners );
-
-    // Pack the data
-    // =============
-    vector<int> sendOffs;
-    Scan( sendCounts, sendOffs );
-    vector<Entry<S>> sendBuf;
-    FastResize( sendBuf, totalSend );
-    auto offs = sendOffs;
-    for( Int k=0; k<totalSend; ++k )
-        sendBuf[offs[owners[k]]++] = remoteEntries[k];
-    SwapClear( remoteEntries );
-    SwapClear( owners );
-
-    // Exchange and unpack the data
-    // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
-    if( B.Participating() )
+// Unpack the received entries and share them with the redundant copies of B
+template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
+void UnpackHelper
+( const vector<S>& recvBuf, const UnpackPlan& plan, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("copy::UnpackHelper"))
+    if( !B.Participating() )
+        return;
+
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    const int commSize = plan.recvCounts.size();
+    for( int q=0; q<commSize; ++q )
     {
-        Int recvBufSize = recvBuf.size();
-        mpi::Broadcast( recvBufSize, 0, B.RedundantComm() );
-        FastResize( recvBuf, recvBufSize );
-        mpi::Broadcast( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
-        T* BBuf = B.Buffer();
-        const Int BLDim = B.LDim();
-        for( Int k=0; k<recvBufSize; ++k )
+        if( plan.recvCounts[q] == 0 )
+            continue;
+        const int r = plan.sourceRows[q];
+        const int c = plan.sourceCols[q];
+        const Int* rowInds = plan.rows.indices.data()+plan.rows.offsets[r];
+        const Int* colInds = plan.cols.indices.data()+plan.cols.offsets[c];
+        const Int numRows = plan.rows.offsets[r+1]-plan.rows.offsets[r];
+        const Int numCols = plan.cols.offsets[c+1]-plan.cols.offsets[c];
+        const S* recvPortion = &recvBuf[plan.recvOffs[q]];
+        for( Int t=0; t<numCols; ++t )
         {
-            const auto& entry = recvBuf[k];
-            BBuf[entry.i+entry.j*BLDim] = Caster<S,T>::Cast(entry.value);
+            T* BCol = &BBuf[colInds[t]*BLDim];
+            for( Int s=0; s<numRows; ++s )
+                BCol[rowInds[s]] = Caster<S,T>::Cast(recvPortion[s]);
+            recvPortion += numRows;
         }
     }
+    Broadcast( B, B.RedundantComm(), 0 );
+}
+
+// Redistribute A into B by transmitting entries of type W
+template<typename W,typename S,typename T>
+void Helper
+( const AbstractDistMatrix<S>& A,
+        AbstractDistMatrix<T>& B ) 
+{
+    DEBUG_ONLY(CSE cse("copy::Helper"))
+    vector<W> sendBuf;
+    vector<Int> sendCounts, sendOffs;
+    mpi::Comm comm;
+    if( !PackHelper( A, B, sendBuf, sendCounts, sendOffs, comm ) )
+        return;
+    UnpackPlan plan;
+    PlanHelper( A, B, sendCounts, comm, plan );
+
+    vector<W> recvBuf;
+    FastResize( recvBuf, plan.totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), plan.recvCounts.data(), plan.recvOffs.data(), comm );
+    SwapClear( sendBuf );
+    UnpackHelper( recvBuf, plan, B );
 }
 
 template<typename S,typename T,typename>
@@ -174,7 +355,9 @@ void GeneralPurpose
         return;
     }
 
-    Helper( A, B );
+    // Since the conversion can equally well happen before or after the
+    // exchange, transmit whichever of the two datatypes is smaller
+    Helper<TransmissionType<S,T>>( A, B );
 }
 
 template<typename T,typename>
@@ -221,7 +404,23 @@ void GeneralPurpose
     }
 #endif
 
-    Helper( A, B );
+    Helper<T>( A, B );
+}
+
+template<typename T>
+void ReducedPrecision
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("copy::ReducedPrecision"))
+    typedef Demote<T> W;
+    if( IsSame<W,T>::value ||
+        (A.Grid().Size() == 1 && B.Grid().Size() == 1) )
+    {
+        Copy( A, B );
+        return;
+    }
+    Helper<W>( A, B );
 }
 
 } // namespace copy
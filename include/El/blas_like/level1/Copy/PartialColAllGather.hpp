@@ -65,10 +65,9 @@ void PartialColAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (colStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer( (colStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = &firstBuf[portionSize];
 
             // Pack
             util::InterleaveMatrix
@@ -97,10 +96,9 @@ void PartialColAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialColAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (colStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        Memory<T> buffer( (colStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = &firstBuf[portionSize];
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
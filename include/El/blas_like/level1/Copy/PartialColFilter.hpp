@@ -67,10 +67,9 @@ void PartialColFilter
         const Int localHeightSend = Length( height, sendColShift, colStride );
         const Int sendSize = localHeightSend*width;
         const Int recvSize = localHeight    *width;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &sendBuf[sendSize];
         // Pack
         util::InterleaveMatrix
         ( localHeightSend, width,
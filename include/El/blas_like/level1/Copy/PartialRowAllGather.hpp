@@ -53,10 +53,9 @@ void PartialRowAllGather
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, (rowStrideUnion+1)*portionSize );
-            T* firstBuf = &buffer[0];
-            T* secondBuf = &buffer[portionSize];
+            Memory<T> buffer( (rowStrideUnion+1)*portionSize );
+            T* firstBuf = buffer.Buffer();
+            T* secondBuf = &firstBuf[portionSize];
    
             // Pack
             util::InterleaveMatrix
@@ -85,10 +84,9 @@ void PartialRowAllGather
         if( A.Grid().Rank() == 0 )
             cerr << "Unaligned PartialRowAllGather" << endl;
 #endif
-        vector<T> buffer;
-        FastResize( buffer, (rowStrideUnion+1)*portionSize );
-        T* firstBuf = &buffer[0];
-        T* secondBuf = &buffer[portionSize];
+        Memory<T> buffer( (rowStrideUnion+1)*portionSize );
+        T* firstBuf = buffer.Buffer();
+        T* secondBuf = &firstBuf[portionSize];
 
         // Perform a SendRecv to match the row alignments
         util::InterleaveMatrix
@@ -67,10 +67,9 @@ void PartialRowFilter
         const Int localWidthSend = Length( width, sendRowShift, rowStride );
         const Int sendSize = height*localWidthSend;
         const Int recvSize = height*localWidth;
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &sendBuf[sendSize];
         // Pack
         util::InterleaveMatrix
         ( height, localWidthSend,
@@ -50,10 +50,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad( localHeight*maxLocalWidth );
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* sendBuf = &buffer[0];
-                T* recvBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* sendBuf = buffer.Buffer();
+                T* recvBuf = &sendBuf[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -103,10 +102,9 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
                 const Int maxLocalWidth = MaxLength(width,rowStride);
 
                 const Int portionSize = mpi::Pad(maxLocalHeight*maxLocalWidth);
-                vector<T> buffer;
-                FastResize( buffer, (rowStride+1)*portionSize );
-                T* firstBuf = &buffer[0];
-                T* secondBuf = &buffer[portionSize];
+                Memory<T> buffer( (rowStride+1)*portionSize );
+                T* firstBuf = buffer.Buffer();
+                T* secondBuf = &firstBuf[portionSize];
 
                 // Pack
                 util::InterleaveMatrix
@@ -137,23 +135,22 @@ void RowAllGather( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
         // Pack from the root
         const Int localHeight = B.LocalHeight();
         const Int localWidth = B.LocalWidth();
-        vector<T> buf;
-        FastResize( buf, localHeight*localWidth );
+        Memory<T> buf( localHeight*localWidth );
         if( A.CrossRank() == A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
               B.LockedBuffer(), 1, B.LDim(),
-              buf.data(),       1, localHeight );
+              buf.Buffer(),     1, localHeight );
 
         // Broadcast from the root
         mpi::Broadcast
-        ( buf.data(), localHeight*localWidth, A.Root(), A.CrossComm() );
+        ( buf.Buffer(), localHeight*localWidth, A.Root(), A.CrossComm() );
 
         // Unpack if not the root
         if( A.CrossRank() != A.Root() )
             util::InterleaveMatrix
             ( localHeight, localWidth,
-              buf.data(), 1, localHeight,
+              buf.Buffer(), 1, localHeight,
               B.Buffer(), 1, B.LDim() );
     }
 }
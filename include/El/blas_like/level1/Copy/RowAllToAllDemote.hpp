@@ -46,10 +46,9 @@ void RowAllToAllDemote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &firstBuf[rowStrideUnion*portionSize];
 
             // Pack            
             util::PartialRowStridedPack
@@ -82,10 +81,9 @@ void RowAllToAllDemote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &firstBuf[rowStrideUnion*portionSize];
 
         // Pack
         util::PartialRowStridedPack
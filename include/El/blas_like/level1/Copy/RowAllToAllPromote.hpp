@@ -47,10 +47,9 @@ void RowAllToAllPromote
         }
         else
         {
-            vector<T> buffer;
-            FastResize( buffer, 2*rowStrideUnion*portionSize );
-            T* firstBuf  = &buffer[0];
-            T* secondBuf = &buffer[rowStrideUnion*portionSize];
+            Memory<T> buffer( 2*rowStrideUnion*portionSize );
+            T* firstBuf  = buffer.Buffer();
+            T* secondBuf = &firstBuf[rowStrideUnion*portionSize];
 
             // Pack            
             util::ColStridedPack
@@ -83,10 +82,9 @@ void RowAllToAllPromote
         const Int sendRowRankPart = Mod( rowRankPart+rowDiff, rowStridePart );
         const Int recvRowRankPart = Mod( rowRankPart-rowDiff, rowStridePart );
 
-        vector<T> buffer;
-        FastResize( buffer, 2*rowStrideUnion*portionSize );
-        T* firstBuf  = &buffer[0];
-        T* secondBuf = &buffer[rowStrideUnion*portionSize];
+        Memory<T> buffer( 2*rowStrideUnion*portionSize );
+        T* firstBuf  = buffer.Buffer();
+        T* secondBuf = &firstBuf[rowStrideUnion*portionSize];
 
         // Pack
         util::ColStridedPack
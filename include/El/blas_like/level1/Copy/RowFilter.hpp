@@ -57,10 +57,9 @@ void RowFilter
         const Int sendSize = localHeightA*localWidth;
         const Int recvSize = localHeight *localWidth;
 
-        vector<T> buffer;
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[sendSize];
+        Memory<T> buffer( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &sendBuf[sendSize];
 
         // Pack
         util::InterleaveMatrix
@@ -50,13 +50,13 @@ void Scatter
         return;
     }
 
-    vector<T> buffer;
+    Memory<T> buffer;
     T* recvBuf=0; // some compilers (falsely) warn otherwise
     if( A.CrossRank() == root )
     {
-        FastResize( buffer, sendSize+recvSize );
-        T* sendBuf = &buffer[0];
-        recvBuf    = &buffer[sendSize];
+        buffer.Require( sendSize+recvSize );
+        T* sendBuf = buffer.Buffer();
+        recvBuf    = &sendBuf[sendSize];
 
         // Pack the send buffer
         copy::util::StridedPack
@@ -72,8 +72,8 @@ void Scatter
     }
     else
     {
-        FastResize( buffer, recvSize );
-        recvBuf = &buffer[0];
+        buffer.Require( recvSize );
+        recvBuf = buffer.Buffer();
 
         // Perform the receiving portion of the scatter from the non-root
         mpi::Scatter
@@ -115,23 +115,22 @@ void Scatter
     if( B.Participating() )
     {
         const Int pkgSize = mpi::Pad( height*width );
-        vector<T> buffer;
-        FastResize( buffer, pkgSize );
+        Memory<T> buffer( pkgSize );
 
         // Pack            
         if( A.Participating() )
             util::InterleaveMatrix
             ( height, width,
               A.LockedBuffer(), 1, A.LDim(),
-              buffer.data(),    1, height );
+              buffer.Buffer(),  1, height );
 
         // Broadcast from the process that packed
-        mpi::Broadcast( buffer.data(), pkgSize, A.Root(), A.CrossComm() );
+        mpi::Broadcast( buffer.Buffer(), pkgSize, A.Root(), A.CrossComm() );
 
         // Unpack
         util::InterleaveMatrix
         ( height, width,
-          buffer.data(), 1, height,
+          buffer.Buffer(), 1, height,
           B.Buffer(),    1, B.LDim() );
     }
 }
@@ -60,9 +60,9 @@ void Translate
         const Int maxHeight = MaxLength( height, colStride );
         const Int maxWidth  = MaxLength( width,  rowStride );
         const Int pkgSize = mpi::Pad( maxHeight*maxWidth );
-        vector<T> buffer;
+        Memory<T> buffer;
         if( crossRank == root || crossRank == B.Root() )
-            FastResize( buffer, pkgSize );
+            buffer.Require( pkgSize );
 
         const Int colAlignB = B.ColAlign();
         const Int rowAlignB = B.RowAlign();
@@ -77,7 +77,7 @@ void Translate
             util::InterleaveMatrix
             ( A.LocalHeight(), A.LocalWidth(),
               A.LockedBuffer(), 1, A.LDim(),
-              buffer.data(),    1, A.LocalHeight() );
+              buffer.Buffer(),  1, A.LocalHeight() );
 
             if( !aligned )
             {
@@ -94,22 +94,22 @@ void Translate
                 const Int fromRank = fromRow + fromCol*colStride;
 
                 mpi::SendRecv
-                ( buffer.data(), pkgSize, toRank, fromRank, A.DistComm() );
+                ( buffer.Buffer(), pkgSize, toRank, fromRank, A.DistComm() );
             }
         }
         if( root != B.Root() )
         {
             // Send to the correct new root over the cross communicator
             if( crossRank == root )
-                mpi::Send( buffer.data(), recvSize, B.Root(), B.CrossComm() );
+                mpi::Send( buffer.Buffer(), recvSize, B.Root(), B.CrossComm() );
             else if( crossRank == B.Root() )
-                mpi::Recv( buffer.data(), recvSize, root, B.CrossComm() );
+                mpi::Recv( buffer.Buffer(), recvSize, root, B.CrossComm() );
         }
         // Unpack
         if( crossRank == B.Root() )
             util::InterleaveMatrix
             ( localHeightB, localWidthB,
-              buffer.data(), 1, localHeightB,
+              buffer.Buffer(), 1, localHeightB,
               B.Buffer(),    1, B.LDim() );
     }
 }
@@ -12,13 +12,243 @@
 namespace El {
 namespace copy {
 
+// The rank (in the viewing communicator) of the first redundant copy of the
+// process owning the given process row and column of the distribution of M
+template<typename T>
+int ViewingOwner
+( const AbstractDistMatrix<T>& M, int rowOwner, int colOwner )
+{
+    const Grid& g = M.Grid();
+    const int vcOwner =
+      g.CoordsToVC
+      ( M.ColDist(), M.RowDist(), rowOwner+colOwner*M.ColStride(), M.Root() );
+    return g.VCToViewing( vcOwner );
+}
+
+// Redistribute each A[k] into B[k] with a single round of point-to-point
+// messages over the (common) viewing communicator of their grids. Each
+// process determines, from the distributions alone, exactly which of its
+// entries overlap with those of every other process, so that no metadata is
+// exchanged and each pair of processes exchanges at most one message (which
+// contains the overlapping pieces of every matrix in the batch). Only the
+// first redundant copy of A sends, and the redundant copies of B are filled
+// by a final broadcast.
+template<typename T>
+void TranslateBetweenGrids
+( const vector<const AbstractDistMatrix<T>*>& A,
+  const vector<AbstractDistMatrix<T>*>& B )
+{
+    DEBUG_ONLY(CSE cse("copy::TranslateBetweenGrids [batch]"))
+    const Int numMats = A.size();
+    if( Int(B.size()) != numMats )
+        LogicError("Batches of ",numMats," and ",B.size()," matrices");
+    if( numMats == 0 )
+        return;
+    mpi::Comm comm = B[0]->Grid().ViewingComm();
+    DEBUG_ONLY(
+      for( Int k=0; k<numMats; ++k )
+          if( !mpi::Congruent( A[k]->Grid().ViewingComm(), comm ) ||
+              !mpi::Congruent( B[k]->Grid().ViewingComm(), comm ) )
+              LogicError
+              ("Redistributing between nonmatching grids currently requires"
+               " the viewing communicators to match.");
+    )
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Bucket the local rows and columns which are sent (received) by their
+    // owners in B (A) and count the entries exchanged with each process
+    vector<IndexBuckets> sendRows(numMats), sendCols(numMats),
+                         recvRows(numMats), recvCols(numMats);
+    vector<bool> sending(numMats), receiving(numMats);
+    vector<Int> sendCounts(commSize,0), recvCounts(commSize,0);
+    for( Int k=0; k<numMats; ++k )
+    {
+        const AbstractDistMatrix<T>& AK = *A[k];
+        AbstractDistMatrix<T>& BK = *B[k];
+        BK.Resize( AK.Height(), AK.Width() );
+        sending[k] = ( AK.Participating() && AK.RedundantRank() == 0 );
+        receiving[k] = ( BK.Participating() && BK.RedundantRank() == 0 );
+        if( sending[k] )
+        {
+            BucketIndices
+            ( AK.LocalHeight(), BK.ColStride(),
+              [&]( Int iLoc ) { return BK.RowOwner(AK.GlobalRow(iLoc)); },
+              sendRows[k] );
+            BucketIndices
+            ( AK.LocalWidth(), BK.RowStride(),
+              [&]( Int jLoc ) { return BK.ColOwner(AK.GlobalCol(jLoc)); },
+              sendCols[k] );
+            for( int c=0; c<BK.RowStride(); ++c )
+            {
+                const Int numCols =
+                  sendCols[k].offsets[c+1] - sendCols[k].offsets[c];
+                for( int r=0; r<BK.ColStride(); ++r )
+                {
+                    const Int numRows =
+                      sendRows[k].offsets[r+1] - sendRows[k].offsets[r];
+                    sendCounts[ViewingOwner(BK,r,c)] += numRows*numCols;
+                }
+            }
+        }
+        if( receiving[k] )
+        {
+            BucketIndices
+            ( BK.LocalHeight(), AK.ColStride(),
+              [&]( Int iLoc ) { return AK.RowOwner(BK.GlobalRow(iLoc)); },
+              recvRows[k] );
+            BucketIndices
+            ( BK.LocalWidth(), AK.RowStride(),
+              [&]( Int jLoc ) { return AK.ColOwner(BK.GlobalCol(jLoc)); },
+              recvCols[k] );
+            for( int c=0; c<AK.RowStride(); ++c )
+            {
+                const Int numCols =
+                  recvCols[k].offsets[c+1] - recvCols[k].offsets[c];
+                for( int r=0; r<AK.ColStride(); ++r )
+                {
+                    const Int numRows =
+                      recvRows[k].offsets[r+1] - recvRows[k].offsets[r];
+                    recvCounts[ViewingOwner(AK,r,c)] += numRows*numCols;
+                }
+            }
+        }
+    }
+    vector<Int> sendOffs, recvOffs;
+    const Int totalSend = Scan( sendCounts, sendOffs );
+    const Int totalRecv = Scan( recvCounts, recvOffs );
+    vector<T> sendBuf, recvBuf;
+    FastResize( sendBuf, totalSend );
+    FastResize( recvBuf, totalRecv );
+
+    // Post the receives (in pieces of at most mpi::MaxCount() entries)
+    const Int maxCount = mpi::MaxCount();
+    Int numRequests = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank )
+            numRequests += (recvCounts[q]+maxCount-1)/maxCount +
+                           (sendCounts[q]+maxCount-1)/maxCount;
+    vector<mpi::Request<T>> requests( numRequests );
+    numRequests = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        T* recvPortion = &recvBuf[recvOffs[q]];
+        for( Int off=0; off<recvCounts[q]; off+=maxCount )
+            mpi::IRecv
+            ( &recvPortion[off], int(Min(maxCount,recvCounts[q]-off)), q,
+              comm, requests[numRequests++] );
+    }
+
+    // Pack the pieces of every matrix for each process (in column-major
+    // order over the local rows and columns of A which it owns in B)
+    auto offs = sendOffs;
+    for( Int k=0; k<numMats; ++k )
+    {
+        if( !sending[k] )
+            continue;
+        const AbstractDistMatrix<T>& AK = *A[k];
+        const AbstractDistMatrix<T>& BK = *B[k];
+        const T* ABuf = AK.LockedBuffer();
+        const Int ALDim = AK.LDim();
+        for( int c=0; c<BK.RowStride(); ++c )
+        {
+            const Int* colInds =
+              sendCols[k].indices.data() + sendCols[k].offsets[c];
+            const Int numCols =
+              sendCols[k].offsets[c+1] - sendCols[k].offsets[c];
+            for( int r=0; r<BK.ColStride(); ++r )
+            {
+                const Int* rowInds =
+                  sendRows[k].indices.data() + sendRows[k].offsets[r];
+                const Int numRows =
+                  sendRows[k].offsets[r+1] - sendRows[k].offsets[r];
+                if( numRows == 0 || numCols == 0 )
+                    continue;
+                const int q = ViewingOwner(BK,r,c);
+                T* sendPortion = &sendBuf[offs[q]];
+                for( Int t=0; t<numCols; ++t )
+                {
+                    const T* ACol = &ABuf[colInds[t]*ALDim];
+                    for( Int s=0; s<numRows; ++s )
+                        sendPortion[s] = ACol[rowInds[s]];
+                    sendPortion += numRows;
+                }
+                offs[q] += numRows*numCols;
+            }
+        }
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        const T* sendPortion = &sendBuf[sendOffs[q]];
+        for( Int off=0; off<sendCounts[q]; off+=maxCount )
+            mpi::ISend
+            ( &sendPortion[off], int(Min(maxCount,sendCounts[q]-off)), q,
+              comm, requests[numRequests++] );
+    }
+    std::copy
+    ( sendBuf.begin()+sendOffs[commRank],
+      sendBuf.begin()+sendOffs[commRank]+sendCounts[commRank],
+      recvBuf.begin()+recvOffs[commRank] );
+    mpi::WaitAll( int(numRequests), requests.data() );
+    SwapClear( sendBuf );
+
+    // Unpack in the same order
+    offs = recvOffs;
+    for( Int k=0; k<numMats; ++k )
+    {
+        if( !receiving[k] )
+            continue;
+        const AbstractDistMatrix<T>& AK = *A[k];
+        AbstractDistMatrix<T>& BK = *B[k];
+        T* BBuf = BK.Buffer();
+        const Int BLDim = BK.LDim();
+        for( int c=0; c<AK.RowStride(); ++c )
+        {
+            const Int* colInds =
+              recvCols[k].indices.data() + recvCols[k].offsets[c];
+            const Int numCols =
+              recvCols[k].offsets[c+1] - recvCols[k].offsets[c];
+            for( int r=0; r<AK.ColStride(); ++r )
+            {
+                const Int* rowInds =
+                  recvRows[k].indices.data() + recvRows[k].offsets[r];
+                const Int numRows =
+                  recvRows[k].offsets[r+1] - recvRows[k].offsets[r];
+                if( numRows == 0 || numCols == 0 )
+                    continue;
+                const int q = ViewingOwner(AK,r,c);
+                const T* recvPortion = &recvBuf[offs[q]];
+                for( Int t=0; t<numCols; ++t )
+                {
+                    T* BCol = &BBuf[colInds[t]*BLDim];
+                    for( Int s=0; s<numRows; ++s )
+                        BCol[rowInds[s]] = recvPortion[s];
+                    recvPortion += numRows;
+                }
+                offs[q] += numRows*numCols;
+            }
+        }
+    }
+    SwapClear( recvBuf );
+
+    for( Int k=0; k<numMats; ++k )
+        if( B[k]->Participating() && B[k]->RedundantSize() > 1 )
+            Broadcast( *B[k], B[k]->RedundantComm(), 0 );
+}
+
 template<typename T,Dist U,Dist V>
 void TranslateBetweenGrids
 ( const DistMatrix<T,U,V>& A,
         DistMatrix<T,U,V>& B ) 
 {
     DEBUG_ONLY(CSE cse("copy::TranslateBetweenGrids"))
-    GeneralPurpose( A, B );
+    vector<const AbstractDistMatrix<T>*> ABatch(1,&A);
+    vector<AbstractDistMatrix<T>*> BBatch(1,&B);
+    TranslateBetweenGrids( ABatch, BBatch );
 }
 
 // TODO: Compare against copy::GeneralPurpose
@@ -107,13 +337,12 @@ void TranslateBetweenGrids
         requiredMemory += maxSendSize;
     if( inBGrid )
         requiredMemory += maxSendSize;
-    vector<T> auxBuf;
-    FastResize( auxBuf, requiredMemory );
+    Memory<T> auxBuf( requiredMemory );
     Int offset = 0;
-    T* sendBuf = &auxBuf[offset];
+    T* sendBuf = &auxBuf.Buffer()[offset];
     if( inAGrid )
         offset += maxSendSize;
-    T* recvBuf = &auxBuf[offset];
+    T* recvBuf = &auxBuf.Buffer()[offset];
 
     Int recvRow = 0; // avoid compiler warnings...
     if( inAGrid )
@@ -245,13 +474,12 @@ void TranslateBetweenGrids
         requiredMemory += height*width;
     if( B.Participating() )
         requiredMemory += height*width;
-    vector<T> buffer;
-    FastResize( buffer, requiredMemory );
+    Memory<T> buffer( requiredMemory );
     Int offset = 0;
-    T* sendBuf = &buffer[offset];
+    T* sendBuf = &buffer.Buffer()[offset];
     if( rankA == 0 ) 
         offset += height*width;
-    T* bcastBuffer = &buffer[offset];
+    T* bcastBuffer = &buffer.Buffer()[offset];
 
     // Send from the root of A to the root of B's matrix's grid
     mpi::Request<T> sendRequest;
@@ -45,30 +45,17 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         const Int recvRankB = 
             (recvRankA/colStrideA)+rowStrideA*(recvRankA%colStrideA);
 
-        vector<T> buffer;
-        FastResize( buffer, (colStrideA+rowStrideA)*portionSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[colStrideA*portionSize];
+        Memory<T> buffer( (colStrideA+rowStrideA)*portionSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &sendBuf[colStrideA*portionSize];
 
         if( A.RowRank() == A.RowAlign() )
         {
             // Pack
-            // TODO: Use kernel from copy::util
-            const Int AColShift = A.ColShift();
-            const T* ABuf = A.LockedBuffer();
-            EL_PARALLEL_FOR
-            for( Int k=0; k<rowStrideA; ++k )
-            {
-                T* data = &recvBuf[k*portionSize];
-
-                const Int shift = 
-                  Shift_(A.ColRank()+colStrideA*k,A.ColAlign(),distSize);
-                const Int offset = (shift-AColShift) / colStrideA;
-                const Int thisLocalHeight = Length_(height,shift,distSize);
-
-                for( Int iLoc=0; iLoc<thisLocalHeight; ++iLoc )
-                    data[iLoc] = ABuf[offset+iLoc*rowStrideA];
-            }
+            util::PartialColStridedColumnPack
+            ( height, A.ColAlign(), distSize,
+              rowStrideA, colStrideA, A.ColRank(), A.ColShift(),
+              A.LockedBuffer(), recvBuf, portionSize );
         }
 
         // (e.g., A[VC,STAR] <- A[MC,MR])
@@ -89,21 +76,10 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         if( B.RowRank() == B.RowAlign() )
         {
             // Unpack
-            // TODO: Use kernel from copy::util
-            T* bufB = B.Buffer();
-            EL_PARALLEL_FOR
-            for( Int k=0; k<colStrideA; ++k )
-            {
-                const T* data = &sendBuf[k*portionSize];
-
-                const Int shift = 
-                  Shift_(B.ColRank()+rowStrideA*k,B.ColAlign(),distSize);
-                const Int offset = (shift-B.ColShift()) / rowStrideA;
-                const Int thisLocalHeight = Length_(height,shift,distSize);
-
-                for( Int iLoc=0; iLoc<thisLocalHeight; ++iLoc )
-                    bufB[offset+iLoc*colStrideA] = data[iLoc];
-            }
+            util::PartialColStridedColumnUnpack
+            ( height, B.ColAlign(), distSize,
+              colStrideA, rowStrideA, B.ColRank(), B.ColShift(),
+              sendBuf, portionSize, B.Buffer() );
         }
     }
     else if( A.Height() == 1 )
@@ -119,29 +95,17 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         const Int recvRankA = 
             (recvRankB/rowStrideA)+colStrideA*(recvRankB%rowStrideA);
 
-        vector<T> buffer;
-        FastResize( buffer, (colStrideA+rowStrideA)*portionSize );
-        T* sendBuf = &buffer[0];
-        T* recvBuf = &buffer[rowStrideA*portionSize];
+        Memory<T> buffer( (colStrideA+rowStrideA)*portionSize );
+        T* sendBuf = buffer.Buffer();
+        T* recvBuf = &sendBuf[rowStrideA*portionSize];
 
         if( A.ColRank() == A.ColAlign() )
         {
             // Pack
-            // TODO: Use kernel from copy::util
-            const T* ABuf = A.LockedBuffer();
-            EL_PARALLEL_FOR
-            for( Int k=0; k<colStrideA; ++k )
-            {
-                T* data = &recvBuf[k*portionSize];
-
-                const Int shift = 
-                  Shift_(A.RowRank()+rowStrideA*k,A.RowAlign(),distSize);
-                const Int offset = (shift-A.RowShift()) / rowStrideA;
-                const Int thisLocalWidth = Length_(width,shift,distSize);
-
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                    data[jLoc] = ABuf[(offset+jLoc*colStrideA)*A.LDim()];
-            }
+            util::PartialRowStridedPack
+            ( 1, width, A.RowAlign(), distSize,
+              colStrideA, rowStrideA, A.RowRank(), A.RowShift(),
+              A.LockedBuffer(), A.LDim(), recvBuf, portionSize );
         }
 
         // (e.g., A[STAR,VR] <- A[MC,MR])
@@ -162,21 +126,10 @@ void TransposeDist( const DistMatrix<T,U,V>& A, DistMatrix<T,V,U>& B )
         if( B.ColRank() == B.ColAlign() )
         {
             // Unpack
-            // TODO: Use kernel from copy::util
-            T* bufB = B.Buffer();
-            EL_PARALLEL_FOR
-            for( Int k=0; k<rowStrideA; ++k )
-            {
-                const T* data = &sendBuf[k*portionSize];
-
-                const Int shift = 
-                  Shift_(B.RowRank()+colStrideA*k,B.RowAlign(),distSize);
-                const Int offset = (shift-B.RowShift()) / colStrideA;
-                const Int thisLocalWidth = Length_(width,shift,distSize);
-
-                for( Int jLoc=0; jLoc<thisLocalWidth; ++jLoc )
-                    bufB[(offset+jLoc*rowStrideA)*B.LDim()] = data[jLoc];
-            }
+            util::PartialRowStridedUnpack
+            ( 1, width, B.RowAlign(), distSize,
+              rowStrideA, colStrideA, B.RowRank(), B.RowShift(),
+              sendBuf, portionSize, B.Buffer(), B.LDim() );
         }
     }
     else
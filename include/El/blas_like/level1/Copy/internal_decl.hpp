@@ -19,6 +19,10 @@ void GeneralPurpose
         AbstractDistMatrix<T>& B );
 template<typename T,typename=EnableIf<IsBlasScalar<T>>>
 void GeneralPurpose
+( const AbstractDistMatrix<T>& A,
+        AbstractDistMatrix<T>& B );
+template<typename T>
+void ReducedPrecision
 ( const AbstractDistMatrix<T>& A,
         AbstractDistMatrix<T>& B );
 
@@ -40,10 +44,14 @@ void TranslateBetweenGrids
 template<typename T>
 void TranslateBetweenGrids
 ( const DistMatrix<T,STAR,STAR>& A, DistMatrix<T,STAR,STAR>& B );
-// The fallback case that simply throws an exception
+// The general case, which uses the batched routine below
 template<typename T,Dist U,Dist V>
 void TranslateBetweenGrids
 ( const DistMatrix<T,U,V>& A, DistMatrix<T,U,V>& B );
+template<typename T>
+void TranslateBetweenGrids
+( const vector<const AbstractDistMatrix<T>*>& A,
+  const vector<AbstractDistMatrix<T>*>& B );
 
 // NOTE: Only instantiated for (U,V)=(MC,MR) and (U,V)=(MR,MC)
 template<typename T,Dist U,Dist V>
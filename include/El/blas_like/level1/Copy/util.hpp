@@ -13,8 +13,41 @@ namespace El {
 namespace copy {
 namespace util {
 
+// Threaded, cache-blocked (un)packing
+// -----------------------------------
+// The local matrix is processed in panels of columns which are each small
+// enough to remain in cache while they are scattered to (or gathered from)
+// every portion, so that the strided accesses into the local matrix are not
+// repeated from main memory for each portion. In hybrid builds, the panels
+// are distributed over PackingThreads() threads.
+
+// Forking threads is not worthwhile for fewer entries than this
+const Int minParallelPackSize = 8192;
+// The target number of bytes in a panel of the local matrix
+const Int packPanelBytes = 1 << 18;
+
+inline Int PackThreads( Int numEntries )
+{
+#ifdef EL_HYBRID
+    return numEntries >= minParallelPackSize ? PackingThreads() : 1;
+#else
+    return 1;
+#endif
+}
+
+// The width of the panels of a height x width matrix: small enough to fit in
+// cache, yet leaving at least one panel per task
 template<typename T>
-void InterleaveMatrix
+Int PackPanelWidth( Int height, Int width, Int numTasks )
+{
+    const Int panelBytes = Max(height,Int(1))*Int(sizeof(T));
+    const Int cacheWidth = Max( packPanelBytes/panelBytes, Int(1) );
+    const Int taskWidth = Max( (width+numTasks-1)/numTasks, Int(1) );
+    return Min( cacheWidth, taskWidth );
+}
+
+template<typename T>
+void SequentialInterleaveMatrix
 ( Int height, Int width,
   const T* A, Int colStrideA, Int rowStrideA,
         T* B, Int colStrideB, Int rowStrideB )
@@ -39,6 +72,43 @@ void InterleaveMatrix
     }
 }
 
+template<typename T>
+void InterleaveMatrix
+( Int height, Int width,
+  const T* A, Int colStrideA, Int rowStrideA,
+        T* B, Int colStrideB, Int rowStrideB )
+{
+    const Int numThreads = PackThreads( height*width );
+    if( numThreads == 1 )
+    {
+        SequentialInterleaveMatrix
+        ( height, width, A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
+        return;
+    }
+
+    // Split the rows as well when there are too few columns to go around
+    const Int numRowBlocks = ( width >= numThreads ? 1 : numThreads );
+    const Int rowBlocksize = (height+numRowBlocks-1) / numRowBlocks;
+    const Int panelWidth =
+      PackPanelWidth<T>( rowBlocksize, width, numThreads/numRowBlocks );
+    const Int numPanels = (width+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
+    for( Int t=0; t<numPanels; ++t )
+    {
+        for( Int s=0; s<numRowBlocks; ++s )
+        {
+            const Int j = t*panelWidth;
+            const Int i = s*rowBlocksize;
+            if( i >= height )
+                continue;
+            SequentialInterleaveMatrix
+            ( Min(rowBlocksize,height-i), Min(panelWidth,width-j),
+              &A[i*colStrideA+j*rowStrideA], colStrideA, rowStrideA,
+              &B[i*colStrideB+j*rowStrideB], colStrideB, rowStrideB );
+        }
+    }
+}
+
 template<typename T>
 void ColStridedPack
 ( Int height, Int width,
@@ -46,14 +116,23 @@ void ColStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
-    for( Int k=0; k<colStride; ++k )
+    const Int numThreads = PackThreads( height*width );
+    const Int panelWidth = PackPanelWidth<T>( height, width, numThreads );
+    const Int numPanels = (width+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_THREADS(numThreads)
+    for( Int t=0; t<numPanels; ++t )
     {
-        const Int colShift = Shift_( k, colAlign, colStride );
-        const Int localHeight = Length_( height, colShift, colStride );
-        InterleaveMatrix
-        ( localHeight, width,
-          &A[colShift],              colStride, ALDim,
-          &BPortions[k*portionSize], 1,         localHeight );
+        const Int j = t*panelWidth;
+        const Int thisWidth = Min( panelWidth, width-j );
+        for( Int k=0; k<colStride; ++k )
+        {
+            const Int colShift = Shift_( k, colAlign, colStride );
+            const Int localHeight = Length_( height, colShift, colStride );
+            SequentialInterleaveMatrix
+            ( localHeight, thisWidth,
+              &A[colShift+j*ALDim], colStride, ALDim,
+              &BPortions[k*portionSize+j*localHeight], 1, localHeight );
+        }
     }
 }
 
@@ -65,6 +144,8 @@ void ColStridedColumnPack
   const T* A,
         T* BPortions, Int portionSize )
 {
+    const Int numThreads = Min( PackThreads(height), colStride );
+    EL_PARALLEL_FOR_THREADS(numThreads)
     for( Int k=0; k<colStride; ++k )
     {
         const Int colShift = Shift_( k, colAlign, colStride );
@@ -82,14 +163,23 @@ void ColStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
-    for( Int k=0; k<colStride; ++k )
+    const Int numThreads = PackThreads( height*width );
+    const Int panelWidth = PackPanelWidth<T>( height, width, numThreads );
+    const Int numPanels = (width+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_THREADS(numThreads)
+    for( Int t=0; t<numPanels; ++t )
     {
-        const Int colShift = Shift_( k, colAlign, colStride );
-        const Int localHeight = Length_( height, colShift, colStride );
-        InterleaveMatrix
-        ( localHeight, width,
-          &APortions[k*portionSize], 1,         localHeight,
-          &B[colShift],              colStride, BLDim );
+        const Int j = t*panelWidth;
+        const Int thisWidth = Min( panelWidth, width-j );
+        for( Int k=0; k<colStride; ++k )
+        {
+            const Int colShift = Shift_( k, colAlign, colStride );
+            const Int localHeight = Length_( height, colShift, colStride );
+            SequentialInterleaveMatrix
+            ( localHeight, thisWidth,
+              &APortions[k*portionSize+j*localHeight], 1, localHeight,
+              &B[colShift+j*BLDim], colStride, BLDim );
+        }
     }
 }
 
@@ -102,16 +192,26 @@ void PartialColStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
-    for( Int k=0; k<colStrideUnion; ++k )
+    const Int localHeightA = Length_( height, colShiftA, colStridePart );
+    const Int numThreads = PackThreads( localHeightA*width );
+    const Int panelWidth = PackPanelWidth<T>( localHeightA, width, numThreads );
+    const Int numPanels = (width+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_THREADS(numThreads)
+    for( Int t=0; t<numPanels; ++t )
     {
-        const Int colShift =
-            Shift_( colRankPart+k*colStridePart, colAlign, colStride );
-        const Int colOffset = (colShift-colShiftA) / colStridePart;
-        const Int localHeight = Length_( height, colShift, colStride );
-        InterleaveMatrix
-        ( localHeight, width,
-          &A[colOffset],             colStrideUnion, ALDim,
-          &BPortions[k*portionSize], 1,              localHeight );
+        const Int j = t*panelWidth;
+        const Int thisWidth = Min( panelWidth, width-j );
+        for( Int k=0; k<colStrideUnion; ++k )
+        {
+            const Int colShift =
+                Shift_( colRankPart+k*colStridePart, colAlign, colStride );
+            const Int colOffset = (colShift-colShiftA) / colStridePart;
+            const Int localHeight = Length_( height, colShift, colStride );
+            SequentialInterleaveMatrix
+            ( localHeight, thisWidth,
+              &A[colOffset+j*ALDim], colStrideUnion, ALDim,
+              &BPortions[k*portionSize+j*localHeight], 1, localHeight );
+        }
     }
 }
 
@@ -124,6 +224,9 @@ void PartialColStridedColumnPack
   const T* A, 
         T* BPortions, Int portionSize )
 {
+    const Int numThreads =
+      Min( PackThreads(height/colStridePart), colStrideUnion );
+    EL_PARALLEL_FOR_THREADS(numThreads)
     for( Int k=0; k<colStrideUnion; ++k )
     {
         const Int colShift =
@@ -145,16 +248,26 @@ void PartialColStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
-    for( Int k=0; k<colStrideUnion; ++k )
+    const Int localHeightB = Length_( height, colShiftB, colStridePart );
+    const Int numThreads = PackThreads( localHeightB*width );
+    const Int panelWidth = PackPanelWidth<T>( localHeightB, width, numThreads );
+    const Int numPanels = (width+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_THREADS(numThreads)
+    for( Int t=0; t<numPanels; ++t )
     {
-        const Int colShift =
-            Shift_( colRankPart+k*colStridePart, colAlign, colStride );
-        const Int colOffset = (colShift-colShiftB) / colStridePart;
-        const Int localHeight = Length_( height, colShift, colStride );
-        InterleaveMatrix
-        ( localHeight, width,
-          &APortions[k*portionSize], 1,              localHeight,
-          &B[colOffset],             colStrideUnion, BLDim );
+        const Int j = t*panelWidth;
+        const Int thisWidth = Min( panelWidth, width-j );
+        for( Int k=0; k<colStrideUnion; ++k )
+        {
+            const Int colShift =
+                Shift_( colRankPart+k*colStridePart, colAlign, colStride );
+            const Int colOffset = (colShift-colShiftB) / colStridePart;
+            const Int localHeight = Length_( height, colShift, colStride );
+            SequentialInterleaveMatrix
+            ( localHeight, thisWidth,
+              &APortions[k*portionSize+j*localHeight], 1, localHeight,
+              &B[colOffset+j*BLDim], colStrideUnion, BLDim );
+        }
     }
 }
 
@@ -167,6 +280,9 @@ void PartialColStridedColumnUnpack
   const T* APortions, Int portionSize,
         T* B )
 {
+    const Int numThreads =
+      Min( PackThreads(height/colStridePart), colStrideUnion );
+    EL_PARALLEL_FOR_THREADS(numThreads)
     for( Int k=0; k<colStrideUnion; ++k )
     {
         const Int colShift =
@@ -179,6 +295,9 @@ void PartialColStridedColumnUnpack
     }
 }
 
+// Since each column of a portion is contiguous in the local matrix, there is
+// no reuse to block for, and the columns of each portion are simply split
+// into enough panels to occupy the threads
 template<typename T>
 void RowStridedPack
 ( Int height, Int width,
@@ -186,14 +305,27 @@ void RowStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    const Int numThreads = PackThreads( height*width );
+    const Int maxLocalWidth = MaxLength_( width, rowStride );
+    const Int panelWidth =
+      PackPanelWidth<T>
+      ( height, maxLocalWidth, (numThreads+rowStride-1)/rowStride );
+    const Int numPanels = (maxLocalWidth+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
     for( Int k=0; k<rowStride; ++k )
     {
-        const Int rowShift = Shift_( k, rowAlign, rowStride );
-        const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth, 
-          &A[rowShift*ALDim],        rowStride*ALDim,
-          &BPortions[k*portionSize], height );
+        for( Int t=0; t<numPanels; ++t )
+        {
+            const Int rowShift = Shift_( k, rowAlign, rowStride );
+            const Int localWidth = Length_( width, rowShift, rowStride );
+            const Int j = t*panelWidth;
+            if( j >= localWidth )
+                continue;
+            lapack::Copy
+            ( 'F', height, Min(panelWidth,localWidth-j),
+              &A[(rowShift+j*rowStride)*ALDim], rowStride*ALDim,
+              &BPortions[k*portionSize+j*height], height );
+        }
     }
 }
 
@@ -204,14 +336,27 @@ void RowStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    const Int numThreads = PackThreads( height*width );
+    const Int maxLocalWidth = MaxLength_( width, rowStride );
+    const Int panelWidth =
+      PackPanelWidth<T>
+      ( height, maxLocalWidth, (numThreads+rowStride-1)/rowStride );
+    const Int numPanels = (maxLocalWidth+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
     for( Int k=0; k<rowStride; ++k )
     {
-        const Int rowShift = Shift_( k, rowAlign, rowStride );
-        const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowShift*BLDim],        rowStride*BLDim );
+        for( Int t=0; t<numPanels; ++t )
+        {
+            const Int rowShift = Shift_( k, rowAlign, rowStride );
+            const Int localWidth = Length_( width, rowShift, rowStride );
+            const Int j = t*panelWidth;
+            if( j >= localWidth )
+                continue;
+            lapack::Copy
+            ( 'F', height, Min(panelWidth,localWidth-j),
+              &APortions[k*portionSize+j*height], height,
+              &B[(rowShift+j*rowStride)*BLDim], rowStride*BLDim );
+        }
     }
 }
 
@@ -224,18 +369,32 @@ void PartialRowStridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    const Int numThreads = PackThreads( height*(width/rowStridePart) );
+    const Int maxLocalWidth = MaxLength_( width, rowStride );
+    const Int panelWidth =
+      PackPanelWidth<T>
+      ( height, maxLocalWidth, (numThreads+rowStrideUnion-1)/rowStrideUnion );
+    const Int numPanels = (maxLocalWidth+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
     for( Int k=0; k<rowStrideUnion; ++k )
     {
-        const Int rowShift =
-            Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
-        const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
-        const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &A[rowOffset*ALDim],       rowStrideUnion*ALDim,
-          &BPortions[k*portionSize], height );
+        for( Int t=0; t<numPanels; ++t )
+        {
+            const Int rowShift =
+                Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
+            const Int rowOffset = (rowShift-rowShiftA) / rowStridePart;
+            const Int localWidth = Length_( width, rowShift, rowStride );
+            const Int j = t*panelWidth;
+            if( j >= localWidth )
+                continue;
+            lapack::Copy
+            ( 'F', height, Min(panelWidth,localWidth-j),
+              &A[(rowOffset+j*rowStrideUnion)*ALDim], rowStrideUnion*ALDim,
+              &BPortions[k*portionSize+j*height],     height );
+        }
     }
 }
+
 template<typename T>
 void PartialRowStridedUnpack
 ( Int height, Int width,
@@ -245,16 +404,29 @@ void PartialRowStridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    const Int numThreads = PackThreads( height*(width/rowStridePart) );
+    const Int maxLocalWidth = MaxLength_( width, rowStride );
+    const Int panelWidth =
+      PackPanelWidth<T>
+      ( height, maxLocalWidth, (numThreads+rowStrideUnion-1)/rowStrideUnion );
+    const Int numPanels = (maxLocalWidth+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
     for( Int k=0; k<rowStrideUnion; ++k )
     {
-        const Int rowShift =
-            Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
-        const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
-        const Int localWidth = Length_( width, rowShift, rowStride );
-        lapack::Copy
-        ( 'F', height, localWidth,
-          &APortions[k*portionSize], height,
-          &B[rowOffset*BLDim],       rowStrideUnion*BLDim );
+        for( Int t=0; t<numPanels; ++t )
+        {
+            const Int rowShift =
+                Shift_( rowRankPart+k*rowStridePart, rowAlign, rowStride );
+            const Int rowOffset = (rowShift-rowShiftB) / rowStridePart;
+            const Int localWidth = Length_( width, rowShift, rowStride );
+            const Int j = t*panelWidth;
+            if( j >= localWidth )
+                continue;
+            lapack::Copy
+            ( 'F', height, Min(panelWidth,localWidth-j),
+              &APortions[k*portionSize+j*height],     height,
+              &B[(rowOffset+j*rowStrideUnion)*BLDim], rowStrideUnion*BLDim );
+        }
     }
 }
 
@@ -267,18 +439,34 @@ void StridedPack
   const T* A,         Int ALDim,
         T* BPortions, Int portionSize )
 {
+    const Int numThreads = PackThreads( height*width );
+    const Int maxLocalWidth = MaxLength_( width, rowStride );
+    const Int panelWidth =
+      PackPanelWidth<T>
+      ( height, maxLocalWidth, (numThreads+rowStride-1)/rowStride );
+    const Int numPanels = (maxLocalWidth+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
     for( Int l=0; l<rowStride; ++l )
     {
-        const Int rowShift = Shift_( l, rowAlign, rowStride );
-        const Int localWidth = Length_( width, rowShift, rowStride );
-        for( Int k=0; k<colStride; ++k )
+        for( Int t=0; t<numPanels; ++t )
         {
-            const Int colShift = Shift_( k, colAlign, colStride );
-            const Int localHeight = Length_( height, colShift, colStride );
-            InterleaveMatrix
-            ( localHeight, localWidth,
-              &A[colShift+rowShift*ALDim], colStride, rowStride*ALDim,
-              &BPortions[(k+l*colStride)*portionSize], 1, localHeight );
+            const Int rowShift = Shift_( l, rowAlign, rowStride );
+            const Int localWidth = Length_( width, rowShift, rowStride );
+            const Int j = t*panelWidth;
+            if( j >= localWidth )
+                continue;
+            const Int thisWidth = Min( panelWidth, localWidth-j );
+            for( Int k=0; k<colStride; ++k )
+            {
+                const Int colShift = Shift_( k, colAlign, colStride );
+                const Int localHeight = Length_( height, colShift, colStride );
+                SequentialInterleaveMatrix
+                ( localHeight, thisWidth,
+                  &A[colShift+(rowShift+j*rowStride)*ALDim],
+                  colStride, rowStride*ALDim,
+                  &BPortions[(k+l*colStride)*portionSize+j*localHeight],
+                  1, localHeight );
+            }
         }
     }
 }
@@ -292,18 +480,34 @@ void StridedUnpack
   const T* APortions, Int portionSize,
         T* B,         Int BLDim )
 {
+    const Int numThreads = PackThreads( height*width );
+    const Int maxLocalWidth = MaxLength_( width, rowStride );
+    const Int panelWidth =
+      PackPanelWidth<T>
+      ( height, maxLocalWidth, (numThreads+rowStride-1)/rowStride );
+    const Int numPanels = (maxLocalWidth+panelWidth-1) / panelWidth;
+    EL_PARALLEL_FOR_COLLAPSE2_THREADS(numThreads)
     for( Int l=0; l<rowStride; ++l )
     {
-        const Int rowShift = Shift_( l, rowAlign, rowStride );
-        const Int localWidth = Length_( width, rowShift, rowStride );
-        for( Int k=0; k<colStride; ++k )
+        for( Int t=0; t<numPanels; ++t )
         {
-            const Int colShift = Shift_( k, colAlign, colStride );
-            const Int localHeight = Length_( height, colShift, colStride );
-            InterleaveMatrix
-            ( localHeight, localWidth,
-              &APortions[(k+l*colStride)*portionSize], 1, localHeight,
-              &B[colShift+rowShift*BLDim], colStride, rowStride*BLDim );
+            const Int rowShift = Shift_( l, rowAlign, rowStride );
+            const Int localWidth = Length_( width, rowShift, rowStride );
+            const Int j = t*panelWidth;
+            if( j >= localWidth )
+                continue;
+            const Int thisWidth = Min( panelWidth, localWidth-j );
+            for( Int k=0; k<colStride; ++k )
+            {
+                const Int colShift = Shift_( k, colAlign, colStride );
+                const Int localHeight = Length_( height, colShift, colStride );
+                SequentialInterleaveMatrix
+                ( localHeight, thisWidth,
+                  &APortions[(k+l*colStride)*portionSize+j*localHeight],
+                  1, localHeight,
+                  &B[colShift+(rowShift+j*rowStride)*BLDim],
+                  colStride, rowStride*BLDim );
+            }
         }
     }
 }
@@ -32,6 +32,34 @@ template<typename T>
 void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func )
 { EntrywiseFill( A.Matrix(), func ); }
 
+// Versions which accept an arbitrary (inlinable) callable
+// =======================================================
+
+template<typename T,class Function>
+void EntrywiseFill( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CSE cse("EntrywiseFill"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func();
+    }
+}
+
+template<typename T,class Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func )
+{ EntrywiseFill( A.Matrix(), func ); }
+
+template<typename T,class Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func )
+{ EntrywiseFill( A.Matrix(), func ); }
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
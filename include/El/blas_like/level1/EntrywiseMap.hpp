@@ -176,6 +176,148 @@ void EntrywiseMap
     EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
 }
 
+// Versions which accept an arbitrary (inlinable) callable
+// =======================================================
+
+template<typename T,class Function>
+void EntrywiseMap( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CSE cse("EntrywiseMap"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func(ACol[i]);
+    }
+}
+
+template<typename T,class Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CSE cse("EntrywiseMap"))
+    T* vBuf = A.ValueBuffer();
+    const Int numEntries = A.NumEntries();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numEntries; ++k )
+        vBuf[k] = func(vBuf[k]);
+}
+
+template<typename T,class Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func )
+{ EntrywiseMap( A.Matrix(), func ); }
+
+template<typename T,class Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CSE cse("EntrywiseMap"))
+    T* vBuf = A.ValueBuffer();
+    const Int numLocalEntries = A.NumLocalEntries();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numLocalEntries; ++k )
+        vBuf[k] = func(vBuf[k]);
+}
+
+template<typename T,class Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func )
+{ EntrywiseMap( A.Matrix(), func ); }
+
+template<typename S,typename T,class Function>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func )
+{
+    DEBUG_ONLY(CSE cse("EntrywiseMap"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const S* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+
+    B.Resize( m, n );
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        const S* ACol = &ABuf[j*ALDim];
+        T* BCol = &BBuf[j*BLDim];
+        for( Int i=0; i<m; ++i )
+            BCol[i] = func(ACol[i]);
+    }
+}
+
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const ElementalMatrix<S>& A,
+        ElementalMatrix<T>& B, 
+        Function func )
+{ 
+    if( A.DistData().colDist == B.DistData().colDist &&
+        A.DistData().rowDist == B.DistData().rowDist )
+    {
+        B.AlignWith( A.DistData() );
+        B.Resize( A.Height(), A.Width() );
+        EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
+    }
+    else
+    {
+        B.Resize( A.Height(), A.Width() );
+        #define GUARD(CDIST,RDIST) \
+          B.DistData().colDist == CDIST && B.DistData().rowDist == RDIST
+        #define PAYLOAD(CDIST,RDIST) \
+          DistMatrix<S,CDIST,RDIST> AProx(B.Grid()); \
+          AProx.AlignWith( B.DistData() ); \
+          Copy( A, AProx ); \
+          EntrywiseMap( AProx.Matrix(), B.Matrix(), func );
+        #include "El/macros/GuardAndPayload.h"
+        #undef GUARD
+        #undef PAYLOAD
+    }
+}
+
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const BlockMatrix<S>& A,
+        BlockMatrix<T>& B, 
+        Function func )
+{ 
+    if( A.DistData().colDist == B.DistData().colDist &&
+        A.DistData().rowDist == B.DistData().rowDist )
+    {
+        B.AlignWith( A.DistData() );
+        B.Resize( A.Height(), A.Width() );
+        EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
+    }
+    else
+    {
+        B.Resize( A.Height(), A.Width() );
+        #define GUARD(CDIST,RDIST) \
+          B.DistData().colDist == CDIST && B.DistData().rowDist == RDIST
+        #define PAYLOAD(CDIST,RDIST) \
+          DistMatrix<S,CDIST,RDIST,BLOCK> AProx(B.Grid()); \
+          AProx.AlignWith( B.DistData() ); \
+          Copy( A, AProx ); \
+          EntrywiseMap( AProx.Matrix(), B.Matrix(), func );
+        #include "El/macros/GuardAndPayload.h"
+        #undef GUARD
+        #undef PAYLOAD
+    }
+}
+
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const DistMultiVec<S>& A,
+        DistMultiVec<T>& B,
+        Function func )
+{
+    DEBUG_ONLY(CSE cse("EntrywiseMap"))
+    B.SetComm( A.Comm() );
+    B.Resize( A.Height(), A.Width() );
+    EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
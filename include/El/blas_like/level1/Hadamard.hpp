@@ -30,9 +30,16 @@ void Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
     const Int BLDim = B.LDim();
     const Int CLDim = C.LDim();
 
-    for( Int j=0; j<width; ++j )
-        for( Int i=0; i<height; ++i )
-            CBuf[i+j*CLDim] = ABuf[i+j*ALDim]*BBuf[i+j*BLDim];
+    if( ALDim == height && BLDim == height && CLDim == height )
+    {
+        simd::Hadamard( height*width, ABuf, BBuf, CBuf );
+    }
+    else
+    {
+        for( Int j=0; j<width; ++j )
+            simd::Hadamard
+            ( height, &ABuf[j*ALDim], &BBuf[j*BLDim], &CBuf[j*CLDim] );
+    }
 }
 
 template<typename T> 
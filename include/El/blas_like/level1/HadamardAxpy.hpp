@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_HADAMARDAXPY_HPP
+#define EL_BLAS_HADAMARDAXPY_HPP
+
+// C(i,j) := C(i,j) + alpha A(i,j) B(i,j) without forming the Hadamard product
+
+namespace El {
+
+template<typename T,typename S>
+void HadamardAxpy
+( S alphaS, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
+{
+    DEBUG_ONLY(CSE cse("HadamardAxpy"))
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.Height() != C.Height() || A.Width() != C.Width() )
+        LogicError("HadamardAxpy requires equal dimensions");
+    const T alpha = T(alphaS);
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+          T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+
+    for( Int j=0; j<width; ++j )
+        for( Int i=0; i<height; ++i )
+            CBuf[i+j*CLDim] += alpha*ABuf[i+j*ALDim]*BBuf[i+j*BLDim];
+}
+
+template<typename T,typename S>
+void HadamardAxpy
+( S alpha,
+  const ElementalMatrix<T>& A,
+  const ElementalMatrix<T>& B,
+        ElementalMatrix<T>& C )
+{
+    DEBUG_ONLY(CSE cse("HadamardAxpy"))
+    const ElementalData ADistData = A.DistData();
+    const ElementalData BDistData = B.DistData();
+    const ElementalData CDistData = C.DistData();
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.Height() != C.Height() || A.Width() != C.Width() )
+        LogicError("HadamardAxpy requires equal dimensions");
+    AssertSameGrids( A, B, C );
+    if( ADistData.colDist != BDistData.colDist ||
+        ADistData.rowDist != BDistData.rowDist ||
+        ADistData.colDist != CDistData.colDist ||
+        ADistData.rowDist != CDistData.rowDist ||
+        A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() ||
+        A.ColAlign() != C.ColAlign() || A.RowAlign() != C.RowAlign() ||
+        A.Root() != B.Root() || A.Root() != C.Root() )
+    {
+        // Fall back to forming the Hadamard product in the distribution of A
+        unique_ptr<ElementalMatrix<T>> P( A.Construct(A.Grid(),A.Root()) );
+        P->AlignWith( ADistData );
+        Copy( B, *P );
+        Hadamard( A, *P, *P );
+        Axpy( alpha, *P, C );
+        return;
+    }
+    HadamardAxpy( alpha, A.LockedMatrix(), B.LockedMatrix(), C.Matrix() );
+}
+
+template<typename T,typename S>
+void HadamardAxpy
+( S alpha,
+  const DistMultiVec<T>& A,
+  const DistMultiVec<T>& B,
+        DistMultiVec<T>& C )
+{
+    DEBUG_ONLY(
+      CSE cse("HadamardAxpy");
+      if( !mpi::Congruent( A.Comm(), B.Comm() ) ||
+          !mpi::Congruent( A.Comm(), C.Comm() ) )
+          LogicError("A, B, and C must have congruent communicators");
+    )
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        A.Height() != C.Height() || A.Width() != C.Width() )
+        LogicError("HadamardAxpy requires equal dimensions");
+    HadamardAxpy( alpha, A.LockedMatrix(), B.LockedMatrix(), C.Matrix() );
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template void HadamardAxpy \
+  ( T alpha, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C ); \
+  EL_EXTERN template void HadamardAxpy \
+  ( T alpha, \
+    const ElementalMatrix<T>& A, \
+    const ElementalMatrix<T>& B, \
+          ElementalMatrix<T>& C ); \
+  EL_EXTERN template void HadamardAxpy \
+  ( T alpha, \
+    const DistMultiVec<T>& A, \
+    const DistMultiVec<T>& B, \
+          DistMultiVec<T>& C );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_HADAMARDAXPY_HPP
@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_ICOPY_HPP
+#define EL_BLAS_ICOPY_HPP
+
+namespace El {
+
+template<typename T>
+CopyRequest<T>::CopyRequest() { }
+
+// NOTE: Moving a vector preserves its buffer, so the pointers handed to the
+//       non-blocking AllToAll remain valid
+template<typename T>
+CopyRequest<T>::CopyRequest( CopyRequest<T>&& req )
+: B_(req.B_), exchanging_(req.exchanging_),
+  sendBuf_(std::move(req.sendBuf_)), recvBuf_(std::move(req.recvBuf_)),
+  sendCounts_(std::move(req.sendCounts_)),
+  sendOffs_(std::move(req.sendOffs_)),
+  recvCounts_(std::move(req.recvCounts_)),
+  recvOffs_(std::move(req.recvOffs_)),
+  plan_(std::move(req.plan_)),
+  request_(std::move(req.request_))
+{
+    req.B_ = nullptr;
+    req.exchanging_ = false;
+    req.request_.backend = MPI_REQUEST_NULL;
+}
+
+template<typename T>
+CopyRequest<T>& CopyRequest<T>::operator=( CopyRequest<T>&& req )
+{
+    DEBUG_ONLY(CSE cse("CopyRequest::operator="))
+    if( this != &req )
+    {
+        Wait();
+        B_ = req.B_;
+        exchanging_ = req.exchanging_;
+        sendBuf_ = std::move(req.sendBuf_);
+        recvBuf_ = std::move(req.recvBuf_);
+        sendCounts_ = std::move(req.sendCounts_);
+        sendOffs_ = std::move(req.sendOffs_);
+        recvCounts_ = std::move(req.recvCounts_);
+        recvOffs_ = std::move(req.recvOffs_);
+        plan_ = std::move(req.plan_);
+        request_ = std::move(req.request_);
+        req.B_ = nullptr;
+        req.exchanging_ = false;
+        req.request_.backend = MPI_REQUEST_NULL;
+    }
+    return *this;
+}
+
+template<typename T>
+CopyRequest<T>::~CopyRequest()
+{
+    if( Active() )
+    {
+        try { Wait(); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+}
+
+template<typename T>
+bool CopyRequest<T>::Active() const { return B_ != nullptr; }
+
+template<typename T>
+bool CopyRequest<T>::Test()
+{
+    DEBUG_ONLY(CSE cse("CopyRequest::Test"))
+    if( !exchanging_ )
+        return true;
+    return mpi::Test( request_ );
+}
+
+template<typename T>
+void CopyRequest<T>::Wait()
+{
+    DEBUG_ONLY(CSE cse("CopyRequest::Wait"))
+    if( !Active() )
+        return;
+    if( exchanging_ )
+    {
+        mpi::Wait( request_ );
+        SwapClear( sendBuf_ );
+        copy::UnpackHelper( recvBuf_, plan_, *B_ );
+    }
+    SwapClear( recvBuf_ );
+    SwapClear( sendCounts_ );
+    SwapClear( sendOffs_ );
+    SwapClear( recvCounts_ );
+    SwapClear( recvOffs_ );
+    plan_ = copy::UnpackPlan();
+    B_ = nullptr;
+    exchanging_ = false;
+}
+
+template<typename T>
+CopyRequest<T> ICopy
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("ICopy"))
+    CopyRequest<T> req;
+    req.B_ = &B;
+    if( A.Grid().Size() == 1 && B.Grid().Size() == 1 )
+    {
+        B.Resize( A.Height(), A.Width() );
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return req;
+    }
+
+    mpi::Comm comm;
+    vector<Int> sendCounts, sendOffs;
+    if( !copy::PackHelper( A, B, req.sendBuf_, sendCounts, sendOffs, comm ) )
+        return req;
+
+    // The (small) exchange of the counts is blocking
+    copy::PlanHelper( A, B, sendCounts, comm, req.plan_ );
+    FastResize( req.recvBuf_, req.plan_.totalRecv );
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // The non-blocking AllToAll only accepts int counts and displacements, so
+    // larger exchanges are completed immediately (by the large-count AllToAll)
+    bool fits = true;
+ #ifdef EL_USE_64BIT_INTS
+    const Int maxCount = mpi::MaxCount();
+    fits = Int(req.sendBuf_.size()) <= maxCount &&
+           req.plan_.totalRecv <= maxCount;
+    fits = mpi::AllReduce( int(fits), mpi::MIN, comm );
+ #endif
+    if( fits )
+    {
+        req.sendCounts_.assign( sendCounts.begin(), sendCounts.end() );
+        req.sendOffs_.assign( sendOffs.begin(), sendOffs.end() );
+        req.recvCounts_.assign
+        ( req.plan_.recvCounts.begin(), req.plan_.recvCounts.end() );
+        req.recvOffs_.assign
+        ( req.plan_.recvOffs.begin(), req.plan_.recvOffs.end() );
+        mpi::IAllToAll
+        ( req.sendBuf_.data(), req.sendCounts_.data(), req.sendOffs_.data(),
+          req.recvBuf_.data(), req.recvCounts_.data(), req.recvOffs_.data(),
+          comm, req.request_ );
+        req.exchanging_ = true;
+        return req;
+    }
+#endif
+    mpi::AllToAll
+    ( req.sendBuf_.data(), sendCounts.data(), sendOffs.data(),
+      req.recvBuf_.data(), req.plan_.recvCounts.data(),
+      req.plan_.recvOffs.data(), comm );
+    req.exchanging_ = true;
+    return req;
+}
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+// The arbitrary-precision types are excluded since the non-blocking
+// collectives do not support them
+#define PROTO(T) \
+  EL_EXTERN template class CopyRequest<T>; \
+  EL_EXTERN template CopyRequest<T> ICopy \
+  ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_ICOPY_HPP
@@ -40,6 +40,50 @@ void IndexDependentFill
     }
 }
 
+// Versions which accept an arbitrary (inlinable) callable
+// =======================================================
+
+template<typename T,class Function>
+void IndexDependentFill( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CSE cse("IndexDependentFill"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func(i,j);
+    }
+}
+
+template<typename T,class Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CSE cse("IndexDependentFill"))
+    const Int mLoc = A.LocalHeight();
+    const Int nLoc = A.LocalWidth();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    // Avoid a virtual call per entry
+    vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        T* ACol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            ACol[iLoc] = func(globalRows[iLoc],j);
+    }
+}
+
 #ifdef EL_INSTANTIATE_BLAS_LEVEL1
 # define EL_EXTERN
 #else
@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BLAS_REDISTPLAN_HPP
+#define EL_BLAS_REDISTPLAN_HPP
+
+namespace El {
+
+// A reusable plan for redistributing matrices with the distribution,
+// alignments, and size of A into matrices with those of B. The counts,
+// offsets, index maps, and buffers of the (general-purpose) exchange are
+// computed once by Setup, which is collective over the union of the grids,
+// and each Execute then only packs, exchanges point-to-point messages with
+// the processes which share entries, and unpacks.
+//
+// Execute transparently rebuilds the plan if it is called with matrices
+// which do not match the ones it was set up with.
+template<typename T>
+class RedistPlan
+{
+public:
+    RedistPlan();
+    RedistPlan( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+    void Setup( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+    bool Matches
+    ( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ) const;
+    void Execute( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+    // The number of processes this process sends to and receives from
+    Int NumSendPeers() const;
+    Int NumRecvPeers() const;
+
+private:
+    bool setup_=false, exchanging_=false, local_=false;
+    Int height_=0, width_=0;
+    DistData AData_, BData_;
+    mpi::Comm comm_;
+    copy::PackPlan packPlan_;
+    copy::UnpackPlan unpackPlan_;
+    vector<int> sendPeers_, recvPeers_;
+    vector<T> sendBuf_, recvBuf_;
+    vector<mpi::Request<T>> requests_;
+};
+
+template<typename T>
+RedistPlan<T>::RedistPlan() { }
+
+template<typename T>
+RedistPlan<T>::RedistPlan
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{ Setup( A, B ); }
+
+template<typename T>
+void RedistPlan<T>::Setup
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("RedistPlan::Setup"))
+    height_ = A.Height();
+    width_ = A.Width();
+    AData_ = DistData( A );
+    BData_ = DistData( B );
+    setup_ = true;
+    sendPeers_.clear();
+    recvPeers_.clear();
+
+    local_ = ( A.Grid().Size() == 1 && B.Grid().Size() == 1 );
+    if( local_ )
+    {
+        B.Resize( height_, width_ );
+        exchanging_ = false;
+        return;
+    }
+
+    exchanging_ = copy::PackPlanHelper( A, B, packPlan_, comm_ );
+    if( !exchanging_ )
+        return;
+    copy::PlanHelper( A, B, packPlan_.sendCounts, comm_, unpackPlan_ );
+
+    const int commSize = mpi::Size( comm_ );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( packPlan_.sendCounts[q] > 0 )
+            sendPeers_.push_back( q );
+        if( unpackPlan_.recvCounts[q] > 0 )
+            recvPeers_.push_back( q );
+    }
+    FastResize( sendBuf_, packPlan_.totalSend );
+    FastResize( recvBuf_, unpackPlan_.totalRecv );
+}
+
+template<typename T>
+bool RedistPlan<T>::Matches
+( const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B ) const
+{
+    if( !setup_ )
+        return false;
+    const DistData AData( A ), BData( B );
+    return A.Height() == height_ && A.Width() == width_ &&
+           AData == AData_ && BData == BData_ &&
+           AData.colCut == AData_.colCut && AData.rowCut == AData_.rowCut &&
+           BData.colCut == BData_.colCut && BData.rowCut == BData_.rowCut;
+}
+
+template<typename T>
+void RedistPlan<T>::Execute
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B )
+{
+    DEBUG_ONLY(CSE cse("RedistPlan::Execute"))
+    if( !Matches( A, B ) )
+        Setup( A, B );
+    B.Resize( height_, width_ );
+    if( local_ )
+    {
+        Copy( A.LockedMatrix(), B.Matrix() );
+        return;
+    }
+    if( !exchanging_ )
+        return;
+
+    // Messages are split into pieces of at most mpi::MaxCount() entries
+    const Int maxCount = mpi::MaxCount();
+    Int numRequests = 0;
+    for( const int q : recvPeers_ )
+        numRequests += (unpackPlan_.recvCounts[q]+maxCount-1) / maxCount;
+    for( const int q : sendPeers_ )
+        numRequests += (packPlan_.sendCounts[q]+maxCount-1) / maxCount;
+    requests_.resize( numRequests );
+
+    // Post the receives before packing so that they are ready for the sends
+    numRequests = 0;
+    for( const int q : recvPeers_ )
+    {
+        const Int count = unpackPlan_.recvCounts[q];
+        T* recvPortion = &recvBuf_[unpackPlan_.recvOffs[q]];
+        for( Int off=0; off<count; off+=maxCount )
+            mpi::IRecv
+            ( &recvPortion[off], int(Min(maxCount,count-off)), q, comm_,
+              requests_[numRequests++] );
+    }
+
+    copy::Pack( A, B, packPlan_, sendBuf_.data() );
+    for( const int q : sendPeers_ )
+    {
+        const Int count = packPlan_.sendCounts[q];
+        const T* sendPortion = &sendBuf_[packPlan_.sendOffs[q]];
+        for( Int off=0; off<count; off+=maxCount )
+            mpi::ISend
+            ( &sendPortion[off], int(Min(maxCount,count-off)), q, comm_,
+              requests_[numRequests++] );
+    }
+    mpi::WaitAll( int(numRequests), requests_.data() );
+
+    copy::UnpackHelper( recvBuf_, unpackPlan_, B );
+}
+
+template<typename T>
+Int RedistPlan<T>::NumSendPeers() const { return sendPeers_.size(); }
+template<typename T>
+Int RedistPlan<T>::NumRecvPeers() const { return recvPeers_.size(); }
+
+#ifdef EL_INSTANTIATE_BLAS_LEVEL1
+# define EL_EXTERN
+#else
+# define EL_EXTERN extern
+#endif
+
+#define PROTO(T) \
+  EL_EXTERN template class RedistPlan<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+#undef EL_EXTERN
+
+} // namespace El
+
+#endif // ifndef EL_BLAS_REDISTPLAN_HPP
@@ -82,6 +82,17 @@ template<typename T>
 void AllReduce
 ( AbstractDistMatrix<T>& A, mpi::Comm comm, mpi::Op op=mpi::SUM );
 
+// Axpby
+// =====
+// Y := alpha X + beta Y
+template<typename T,typename S>
+void Axpby( S alpha, const Matrix<T>& X, S beta, Matrix<T>& Y );
+template<typename T,typename S>
+void Axpby
+( S alpha, const ElementalMatrix<T>& X, S beta, ElementalMatrix<T>& Y );
+template<typename T,typename S>
+void Axpby( S alpha, const DistMultiVec<T>& X, S beta, DistMultiVec<T>& Y );
+
 // Axpy
 // ====
 template<typename T,typename S>
@@ -124,6 +135,32 @@ template<typename T>
 void AxpyContract
 ( T alpha, const BlockMatrix<T>& A, BlockMatrix<T>& B );
 
+// AxpyDot
+// =======
+// Return (X + alpha dX)^H (Y + beta dY) without forming either sum
+template<typename T,typename S>
+T AxpyDot
+( S alpha, const Matrix<T>& dX, const Matrix<T>& X,
+  S beta,  const Matrix<T>& dY, const Matrix<T>& Y );
+template<typename T,typename S>
+T AxpyDot
+( S alpha, const ElementalMatrix<T>& dX, const ElementalMatrix<T>& X,
+  S beta,  const ElementalMatrix<T>& dY, const ElementalMatrix<T>& Y );
+template<typename T,typename S>
+T AxpyDot
+( S alpha, const DistMultiVec<T>& dX, const DistMultiVec<T>& X,
+  S beta,  const DistMultiVec<T>& dY, const DistMultiVec<T>& Y );
+
+// AxpyNrm2
+// ========
+// Y := Y + alpha X, returning || Y ||_F from the same pass over memory
+template<typename F,typename S>
+Base<F> AxpyNrm2( S alpha, const Matrix<F>& X, Matrix<F>& Y );
+template<typename F,typename S>
+Base<F> AxpyNrm2( S alpha, const ElementalMatrix<F>& X, ElementalMatrix<F>& Y );
+template<typename F,typename S>
+Base<F> AxpyNrm2( S alpha, const DistMultiVec<F>& X, DistMultiVec<F>& Y );
+
 // AxpyTrapezoid
 // =============
 template<typename T,typename S>
@@ -460,6 +497,104 @@ void Copy( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
 template<typename S,typename T,typename=EnableIf<CanCast<S,T>>>
 void Copy( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B );
 
+// Redistribute A into B while transmitting the entries in a reduced precision
+// (e.g., as float rather than double), which roughly halves the volume of
+// communication at the cost of rounding the entries of B. This should only be
+// used for data which tolerates the loss, e.g., sketching matrices or
+// preconditioners.
+template<typename T>
+void ReducedPrecisionCopy
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
+// Redistribute each A[k] into B[k] with a single exchange of point-to-point
+// messages, e.g., to move many matrices between (overlapping or disjoint)
+// subgrids. The grids of every matrix must share a viewing communicator.
+template<typename T>
+void Copy
+( const vector<const AbstractDistMatrix<T>*>& A,
+  const vector<AbstractDistMatrix<T>*>& B );
+
+namespace copy {
+
+// The local rows (or columns) of a process bucketed by the owner in another
+// distribution
+struct IndexBuckets
+{
+    vector<Int> offsets, indices;
+};
+
+// The sending side of a general-purpose redistribution
+struct PackPlan
+{
+    Int totalSend=0;
+    vector<Int> sendCounts, sendOffs;
+    // The local rows and columns of A bucketed by their owners in B
+    IndexBuckets rows, cols;
+    // The rank in the communicator of each (distribution) rank of B
+    vector<int> distMap;
+    // The owner in B of the entries which this process copies directly
+    // (if any) and their local rows and columns in B
+    int directRow=-1, directCol=-1;
+    vector<Int> directLocalRows, directLocalCols;
+};
+
+// The receiving side of a general-purpose redistribution
+struct UnpackPlan
+{
+    Int totalRecv=0;
+    vector<Int> recvCounts, recvOffs;
+    // The process row and column of A which sent the entries from each process
+    vector<int> sourceRows, sourceCols;
+    // The local rows and columns of B bucketed by their owners in A
+    IndexBuckets rows, cols;
+};
+
+} // namespace copy
+
+// A handle for a redistribution which was started with ICopy. The target
+// matrix must not be accessed until Wait has been called, and Wait must be
+// called by every process in the target's grid (it is implicitly called upon
+// destruction). Test does not communicate beyond MPI_Test, so it may be
+// called asynchronously.
+template<typename T>
+class CopyRequest
+{
+public:
+    CopyRequest();
+    CopyRequest( CopyRequest<T>&& req );
+    CopyRequest<T>& operator=( CopyRequest<T>&& req );
+    ~CopyRequest();
+
+    CopyRequest( const CopyRequest<T>& req ) = delete;
+    CopyRequest<T>& operator=( const CopyRequest<T>& req ) = delete;
+
+    bool Active() const;
+    // Returns true if the exchange of data has finished (though Wait must
+    // still be called in order to unpack it)
+    bool Test();
+    void Wait();
+
+private:
+    AbstractDistMatrix<T>* B_=nullptr;
+    bool exchanging_=false;
+    vector<T> sendBuf_, recvBuf_;
+    // The (int) counts and offsets of the non-blocking AllToAll
+    vector<int> sendCounts_, sendOffs_, recvCounts_, recvOffs_;
+    copy::UnpackPlan plan_;
+    mpi::Request<T> request_;
+
+    template<typename S>
+    friend CopyRequest<S> ICopy
+    ( const AbstractDistMatrix<S>& A, AbstractDistMatrix<S>& B );
+};
+
+// Begin redistributing A into B and return a handle to wait on. The
+// general-purpose exchange is always used so that a single non-blocking
+// AllToAll suffices for any pair of distributions.
+template<typename T>
+CopyRequest<T> ICopy
+( const AbstractDistMatrix<T>& A, AbstractDistMatrix<T>& B );
+
 template<typename T>
 void CopyFromRoot
 ( const Matrix<T>& A, DistMatrix<T,CIRC,CIRC>& B,
@@ -760,6 +895,16 @@ void EntrywiseFill( AbstractDistMatrix<T>& A, function<T(void)> func );
 template<typename T>
 void EntrywiseFill( DistMultiVec<T>& A, function<T(void)> func );
 
+// The following overloads accept an arbitrary callable, which (unlike a
+// std::function) can be inlined. The callable is invoked concurrently over
+// the (local) columns when OpenMP is enabled and must be safe to do so.
+template<typename T,class Function>
+void EntrywiseFill( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseFill( DistMultiVec<T>& A, Function func );
+
 // EntrywiseMap
 // ============
 template<typename T>
@@ -796,6 +941,32 @@ void EntrywiseMap
 ( const DistMultiVec<S>& A, DistMultiVec<T>& B, 
   function<T(S)> func );
 
+// The following overloads accept an arbitrary callable, which (unlike a
+// std::function) can be inlined. The callable is invoked concurrently when
+// OpenMP is enabled and must be safe to do so.
+template<typename T,class Function>
+void EntrywiseMap( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( DistMultiVec<T>& A, Function func );
+
+template<typename S,typename T,class Function>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const ElementalMatrix<S>& A, ElementalMatrix<T>& B, Function func );
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const BlockMatrix<S>& A, BlockMatrix<T>& B, Function func );
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const DistMultiVec<S>& A, DistMultiVec<T>& B, Function func );
+
 // Fill
 // ====
 template<typename T>
@@ -1093,6 +1264,25 @@ void Hadamard
   const DistMultiVec<T>& B,
         DistMultiVec<T>& C );
 
+// HadamardAxpy
+// ============
+// C := C + alpha (A o B)
+template<typename T,typename S>
+void HadamardAxpy
+( S alpha, const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C );
+template<typename T,typename S>
+void HadamardAxpy
+( S alpha,
+  const ElementalMatrix<T>& A,
+  const ElementalMatrix<T>& B,
+        ElementalMatrix<T>& C );
+template<typename T,typename S>
+void HadamardAxpy
+( S alpha,
+  const DistMultiVec<T>& A,
+  const DistMultiVec<T>& B,
+        DistMultiVec<T>& C );
+
 // HilbertSchmidt
 // ==============
 template<typename T>
@@ -1121,6 +1311,14 @@ template<typename T>
 void IndexDependentFill
 ( AbstractDistMatrix<T>& A, function<T(Int,Int)> func );
 
+// The following overloads accept an arbitrary callable, which (unlike a
+// std::function) can be inlined. The callable is invoked concurrently over
+// the (local) columns when OpenMP is enabled and must be safe to do so.
+template<typename T,class Function>
+void IndexDependentFill( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func );
+
 // IndexDependentMap
 // =================
 template<typename T>
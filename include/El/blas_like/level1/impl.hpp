@@ -10,8 +10,11 @@
 #define EL_BLAS1_IMPL_HPP
 
 #include <El/blas_like/level1/AllReduce.hpp>
+#include <El/blas_like/level1/Axpby.hpp>
 #include <El/blas_like/level1/Axpy.hpp>
 #include <El/blas_like/level1/AxpyContract.hpp>
+#include <El/blas_like/level1/AxpyDot.hpp>
+#include <El/blas_like/level1/AxpyNrm2.hpp>
 #include <El/blas_like/level1/AxpyTrapezoid.hpp>
 #include <El/blas_like/level1/Broadcast.hpp>
 #include <El/blas_like/level1/Concatenate.hpp>
@@ -33,6 +36,9 @@
 #include <El/blas_like/level1/GetMappedDiagonal.hpp>
 #include <El/blas_like/level1/GetSubmatrix.hpp>
 #include <El/blas_like/level1/Hadamard.hpp>
+#include <El/blas_like/level1/HadamardAxpy.hpp>
+#include <El/blas_like/level1/ICopy.hpp>
+#include <El/blas_like/level1/RedistPlan.hpp>
 #include <El/blas_like/level1/ImagPart.hpp>
 #include <El/blas_like/level1/IndexDependentFill.hpp>
 #include <El/blas_like/level1/IndexDependentMap.hpp>
@@ -20,11 +20,28 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_C_PIPELINED,
+  GEMM_SUMMA_25D
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of layers, c, used by GEMM_SUMMA_25D. Each layer holds 1/c of the
+// processes, and the default of zero selects the largest c <= p^(1/3) which
+// divides the number of processes, p.
+Int GemmReplicationFactor();
+void SetGemmReplicationFactor( Int c );
+
+// The SUMMA variant which GEMM_DEFAULT selects for forming the m x n product
+// of A and B (with summation dimension k) over the grid g: the variant with
+// the smallest predicted cost under the model returned by GetCostModel
+// (GEMM_SUMMA_C_PIPELINED is never selected by default)
+template<typename T>
+GemmAlgorithm DefaultGemmAlgorithm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g );
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -47,6 +64,20 @@ void Gemm
   T alpha, const ElementalMatrix<T>& A, const ElementalMatrix<T>& B,
                  ElementalMatrix<T>& C, GemmAlgorithm alg=GEMM_DEFAULT );
 
+// Block-cyclic SUMMA which works directly with the block distributions (as in
+// PBLAS) rather than through element-cyclic proxies
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BlockMatrix<T>& A, const BlockMatrix<T>& B,
+  T beta,        BlockMatrix<T>& C );
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BlockMatrix<T>& A, const BlockMatrix<T>& B,
+                 BlockMatrix<T>& C );
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -454,6 +485,16 @@ void Trsm
   const AbstractDistMatrix<F>& A,
         AbstractDistMatrix<F>& B,
   bool checkIfSingular=false, TrsmAlgorithm alg=TRSM_DEFAULT );
+// Solves directly against the block-cyclic distributions rather than through
+// element-cyclic proxies
+template<typename F>
+void Trsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  F alpha,
+  const BlockMatrix<F>& A,
+        BlockMatrix<F>& B,
+  bool checkIfSingular=false );
 
 template<typename F>
 void LocalTrsm
@@ -17,14 +17,17 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <sstream>
+#include <stack>
 #include <stdexcept>
 #include <string>
 #include <random>
@@ -99,6 +102,7 @@ typedef __float128 Quad;
 #include <El/core/environment/decl.hpp>
 
 #include <El/core/Timer.hpp>
+#include <El/core/Profile.hpp>
 #include <El/core/indexing/decl.hpp>
 #include <El/core/imports/blas.hpp>
 #include <El/core/imports/lapack.hpp>
@@ -109,6 +113,7 @@ typedef __float128 Quad;
 #include <El/core/imports/scalapack.hpp>
 
 #include <El/core/limits.hpp>
+#include <El/core/SIMD.hpp>
 
 #include <El/core/Memory.hpp>
 
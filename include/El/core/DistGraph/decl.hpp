@@ -33,8 +33,10 @@ public:
     DistGraph( Int numSources, mpi::Comm comm=mpi::COMM_WORLD );
     DistGraph( Int numSources, Int numTargets, mpi::Comm comm=mpi::COMM_WORLD );
     DistGraph( const Graph& graph );
-    // TODO: Move constructor
     DistGraph( const DistGraph& graph );
+    // Move the buffers and communicator from a given graph, which is left
+    // empty and over mpi::COMM_SELF
+    DistGraph( DistGraph&& graph );
     ~DistGraph();
 
     // Assignment and reconfiguration
@@ -44,7 +46,11 @@ public:
     // -------------
     const DistGraph& operator=( const Graph& graph );
     const DistGraph& operator=( const DistGraph& graph );
-    // TODO: Move assignment
+
+    // Move assignment
+    // ---------------
+    // NOTE: The communicators are exchanged and 'graph' is left empty
+    DistGraph& operator=( DistGraph&& graph );
 
     // Make a copy of a subgraph
     // -------------------------
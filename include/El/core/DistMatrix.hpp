@@ -57,6 +57,9 @@ class DistMultiVec;
 #include "./DistMatrix/Block/VC_STAR.hpp"
 #include "./DistMatrix/Block/VR_STAR.hpp"
 
+#include "./DistMatrix/RemoteAccumulator.hpp"
+#include "./DistMatrix/SharedReplica.hpp"
+
 namespace El {
 
 #ifdef EL_HAVE_SCALAPACK
@@ -0,0 +1,70 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DISTMATRIX_REMOTEACCUMULATOR_HPP
+#define EL_DISTMATRIX_REMOTEACCUMULATOR_HPP
+
+namespace El {
+
+// An asynchronous alternative to QueueUpdate/ProcessQueues for summing
+// (possibly remote) updates into a distributed matrix, e.g., during
+// finite-element assembly. The updates are aggregated per target process
+// (combining those to the same entry) and, once 'capacity' of them are
+// pending for a target (or upon Flush), are added directly into the local
+// buffer of the target with a single MPI-3 one-sided accumulation. Unlike
+// ProcessQueues, processes with few updates therefore do not wait upon
+// those with many.
+//
+// The constructor, Fence, and Close (which is called by the destructor) are
+// collective over the viewing communicator of the grid of A. The entries of
+// A may only be accessed after a Fence or Close, and A must not be resized
+// or realigned until Close. Without MPI-3 one-sided support, the updates
+// are instead queued within A and processed by Fence and Close.
+template<typename T>
+class RemoteAccumulator
+{
+public:
+    RemoteAccumulator( AbstractDistMatrix<T>& A, Int capacity=4096 );
+    ~RemoteAccumulator();
+
+    RemoteAccumulator( const RemoteAccumulator<T>& accum ) = delete;
+    RemoteAccumulator<T>& operator=
+    ( const RemoteAccumulator<T>& accum ) = delete;
+
+    bool Open() const;
+
+    void QueueUpdate( const Entry<T>& entry );
+    void QueueUpdate( Int i, Int j, T value );
+
+    // Send every pending update and wait until they have been applied
+    void Flush();
+    // Flush and then wait for the updates of every other process
+    void Fence();
+    // Fence and then release A
+    void Close();
+
+private:
+    AbstractDistMatrix<T>* A_=nullptr;
+    Int capacity_;
+#ifdef EL_HAVE_MPI3_RMA
+    mpi::Comm comm_;
+    mpi::Window window_;
+    // The leading dimension of the local matrix of each process
+    vector<Int> ldims_;
+    // The pending (value,local offset) pairs for each process
+    vector<vector<ValueInt<T>>> pending_;
+    vector<Int> sendOffsets_;
+    vector<T> sendValues_;
+
+    void Send( int target );
+#endif
+};
+
+} // namespace El
+
+#endif // ifndef EL_DISTMATRIX_REMOTEACCUMULATOR_HPP
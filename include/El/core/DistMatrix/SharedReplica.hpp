@@ -0,0 +1,62 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_DISTMATRIX_SHAREDREPLICA_HPP
+#define EL_DISTMATRIX_SHAREDREPLICA_HPP
+
+namespace El {
+
+// A read-only [STAR,STAR] copy of a distributed matrix which stores a single
+// copy of the entries per node (within an MPI-3 shared-memory window) rather
+// than one per process. Set first gathers the entries owned by each node
+// directly into its window and then exchanges them between one leader per
+// node, so that each entry crosses the network once per node.
+//
+// The constructor and Set are collective over the grid, and the view returned
+// by Matrix() is invalidated by the next call to Set. Without MPI-3
+// one-sided support, each process instead holds a standard [STAR,STAR] copy.
+template<typename T>
+class SharedReplica
+{
+public:
+    explicit SharedReplica( const El::Grid& g=DefaultGrid() );
+    explicit SharedReplica( const AbstractDistMatrix<T>& A );
+    ~SharedReplica();
+
+    SharedReplica( const SharedReplica<T>& replica ) = delete;
+    SharedReplica<T>& operator=( const SharedReplica<T>& replica ) = delete;
+
+    // Replace the replica with a copy of A (which must share its grid)
+    void Set( const AbstractDistMatrix<T>& A );
+
+    const DistMatrix<T,STAR,STAR>& Matrix() const EL_NO_EXCEPT;
+    const El::Grid& Grid() const EL_NO_EXCEPT;
+
+private:
+    const El::Grid* grid_;
+    DistMatrix<T,STAR,STAR> view_;
+#ifdef EL_HAVE_MPI3_RMA
+    // The processes on the node of this process and, on the node leaders,
+    // the leaders of all of the nodes
+    mpi::Comm nodeComm_, leaderComm_;
+    // The node index of each VC rank and whether every node holds a
+    // contiguous range of VC ranks
+    vector<int> nodes_;
+    bool contiguous_=true;
+
+    mpi::Window window_;
+    T* buffer_=nullptr;
+    Int capacity_=0;
+
+    void Reserve( Int size );
+#endif
+};
+
+} // namespace El
+
+#endif // ifndef EL_DISTMATRIX_SHAREDREPLICA_HPP
@@ -25,6 +25,9 @@ public:
     DistMultiVec( mpi::Comm comm=mpi::COMM_WORLD );
     DistMultiVec( Int height, Int width, mpi::Comm comm=mpi::COMM_WORLD );
     DistMultiVec( const DistMultiVec<T>& A );
+    // Move the buffer and communicator from a given multivector, which is
+    // left empty and over mpi::COMM_SELF
+    DistMultiVec( DistMultiVec<T>&& A );
     ~DistMultiVec();
 
     // Assignment  and reconfiguration
@@ -58,6 +61,11 @@ public:
     const DistMultiVec<T>& operator=( const DistMultiVec<T>& X );
     const DistMultiVec<T>& operator=( const AbstractDistMatrix<T>& X );
 
+    // Move assignment
+    // ---------------
+    // NOTE: The communicators are exchanged and 'X' is left empty
+    DistMultiVec<T>& operator=( DistMultiVec<T>&& X );
+
     // Rescaling
     // ---------
     const DistMultiVec<T>& operator*=( T alpha );
@@ -53,11 +53,17 @@ DistMultiVec<T>::DistMultiVec( const DistMultiVec<T>& A )
     )
 }
 
+template<typename T>
+DistMultiVec<T>::DistMultiVec( DistMultiVec<T>&& A )
+: height_(0), width_(0), comm_(mpi::COMM_SELF),
+  commSize_(1), commRank_(0), blocksize_(1)
+{ *this = std::move(A); }
+
 template<typename T>
 DistMultiVec<T>::~DistMultiVec()
 { 
     if( !mpi::Finalized() )
-        if( comm_ != mpi::COMM_WORLD )
+        if( comm_ != mpi::COMM_WORLD && comm_ != mpi::COMM_SELF )
             mpi::Free( comm_ );
 }
 
@@ -111,7 +117,7 @@ void DistMultiVec<T>::SetComm( mpi::Comm comm )
     if( comm == comm_ )
         return;
 
-    if( comm_ != mpi::COMM_WORLD )
+    if( comm_ != mpi::COMM_WORLD && comm_ != mpi::COMM_SELF )
         mpi::Free( comm_ );
     if( comm == mpi::COMM_WORLD )
         comm_ = comm;
@@ -143,6 +149,30 @@ DistMultiVec<T>::operator=( const AbstractDistMatrix<T>& A )
     return *this;
 }
 
+// Move assignment
+// ---------------
+template<typename T>
+DistMultiVec<T>& DistMultiVec<T>::operator=( DistMultiVec<T>&& A )
+{
+    DEBUG_ONLY(CSE cse("DistMultiVec::operator=( DistMultiVec&& )"))
+    if( &A == this )
+        return *this;
+
+    // Exchanging the communicators avoids freeing and duplicating them
+    std::swap( comm_, A.comm_ );
+    std::swap( commSize_, A.commSize_ );
+    std::swap( commRank_, A.commRank_ );
+
+    height_ = A.height_;
+    width_ = A.width_;
+    blocksize_ = A.blocksize_;
+    multiVec_ = std::move(A.multiVec_);
+    remoteUpdates_ = std::move(A.remoteUpdates_);
+
+    A.Empty();
+    return *this;
+}
+
 // Make a copy of a submatrix
 // --------------------------
 template<typename T>
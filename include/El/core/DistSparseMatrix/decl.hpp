@@ -23,6 +23,8 @@ struct DistSparseMultMeta
     vector<Int> sendInds, colOffs;
 
     DistSparseMultMeta() : ready(false), numRecvInds(0) { }
+    DistSparseMultMeta( const DistSparseMultMeta& meta ) = default;
+    DistSparseMultMeta( DistSparseMultMeta&& meta ) = default;
 
     void Clear()
     {
@@ -48,6 +50,8 @@ struct DistSparseMultMeta
         colOffs = meta.colOffs;
         return *this;
     }
+
+    DistSparseMultMeta& operator=( DistSparseMultMeta&& meta ) = default;
 };
 
 // Use a simple 1d distribution where each process owns a fixed number of rows,
@@ -62,7 +66,9 @@ public:
     DistSparseMatrix( mpi::Comm comm=mpi::COMM_WORLD );
     DistSparseMatrix( Int height, Int width, mpi::Comm comm=mpi::COMM_WORLD );
     DistSparseMatrix( const DistSparseMatrix<T>& A );
-    // TODO: Move constructor
+    // Move the buffers and communicator from a given matrix, which is left
+    // empty and over mpi::COMM_SELF
+    DistSparseMatrix( DistSparseMatrix<T>&& A );
     ~DistSparseMatrix();
 
     // Assignment and reconfiguration
@@ -120,7 +126,11 @@ public:
     // Make a copy
     // -----------
     const DistSparseMatrix<T>& operator=( const DistSparseMatrix<T>& A );
-    // TODO: Move assignment
+
+    // Move assignment
+    // ---------------
+    // NOTE: The communicators are exchanged and 'A' is left empty
+    DistSparseMatrix<T>& operator=( DistSparseMatrix<T>&& A );
 
     // Make a copy of a submatrix
     // --------------------------
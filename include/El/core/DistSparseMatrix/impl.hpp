@@ -50,6 +50,18 @@ DistSparseMatrix<T>::DistSparseMatrix( const DistSparseMatrix<T>& A )
     )
 }
 
+template<typename T>
+DistSparseMatrix<T>::DistSparseMatrix( DistSparseMatrix<T>&& A )
+: multMeta(std::move(A.multMeta)),
+  distGraph_(std::move(A.distGraph_)),
+  vals_(std::move(A.vals_)),
+  remoteVals_(std::move(A.remoteVals_))
+{
+    A.multMeta.Clear();
+    A.vals_.clear();
+    A.remoteVals_.clear();
+}
+
 template<typename T>
 DistSparseMatrix<T>::~DistSparseMatrix()
 { }
@@ -404,6 +416,24 @@ DistSparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
     return *this;
 }
 
+template<typename T>
+DistSparseMatrix<T>&
+DistSparseMatrix<T>::operator=( DistSparseMatrix<T>&& A )
+{
+    DEBUG_ONLY(CSE cse("DistSparseMatrix::operator=( DistSparseMatrix&& )"))
+    if( &A != this )
+    {
+        distGraph_ = std::move(A.distGraph_);
+        vals_ = std::move(A.vals_);
+        remoteVals_ = std::move(A.remoteVals_);
+        multMeta = std::move(A.multMeta);
+        A.vals_.clear();
+        A.remoteVals_.clear();
+        A.multMeta.Clear();
+    }
+    return *this;
+}
+
 // Make a copy of a submatrix
 // --------------------------
 template<typename T>
@@ -809,23 +839,16 @@ void DistSparseMatrix<T>::MappedSources
 ( const DistMap& reordering, vector<Int>& mappedSources ) const
 {
     DEBUG_ONLY(CSE cse("DistSparseMatrix::MappedSources"))
-    mpi::Comm comm = Comm();
-    const int commRank = mpi::Rank( comm );
-    Timer timer;
-    const bool time = false; 
     const Int localHeight = LocalHeight();
     if( Int(mappedSources.size()) == localHeight )
         return;
 
     // Get the reordered indices of our local rows of the sparse matrix
-    if( time && commRank == 0 )
-        timer.Start();
+    ProfileRegion region("Source translation");
     mappedSources.resize( localHeight );
     for( Int iLoc=0; iLoc<localHeight; ++iLoc )
         mappedSources[iLoc] = GlobalRow(iLoc);
     reordering.Translate( mappedSources );
-    if( time && commRank == 0 )
-        Output("Source translation: ",timer.Stop()," secs");
 }
 
 template<typename T>
@@ -838,14 +861,8 @@ void DistSparseMatrix<T>::MappedTargets
     if( mappedTargets.size() != 0 && colOffs.size() != 0 ) 
         return;
 
-    mpi::Comm comm = Comm();
-    const int commRank = mpi::Rank( comm ); 
-    Timer timer;
-    const bool time = false;
-
     // Compute the unique set of column indices that our process interacts with
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Unique sort");
     const Int* colBuffer = LockedTargetBuffer();
     const Int numLocalEntries = NumLocalEntries();
     colOffs.resize( numLocalEntries );
@@ -868,19 +885,16 @@ void DistSparseMatrix<T>::MappedTargets
         uniqueCols.resize( uniqueOff+1 );
     }
     const Int numUniqueCols = uniqueCols.size();
-    if( time && commRank == 0 )
-        Output("Unique sort: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Get the reordered indices of the targets of our portion of the 
     // distributed sparse matrix
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Target translation");
     mappedTargets.resize( numUniqueCols );
     for( Int e=0; e<numUniqueCols; ++e )
         mappedTargets[e] = uniqueCols[e].value;
     reordering.Translate( mappedTargets );
-    if( time && commRank == 0 )
-        Output("Target translation: ",timer.Stop()," secs");
+    PopProfileRegion();
 }
 
 template<typename T>
@@ -171,6 +171,22 @@ template<> struct PromoteHelper<Complex<double>>
 
 template<typename F> using Promote = typename PromoteHelper<F>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename F> struct DemoteHelper { typedef F type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+template<> struct DemoteHelper<Complex<double>>
+{ typedef Complex<float> type; };
+#ifdef EL_HAVE_QD
+template<> struct DemoteHelper<DoubleDouble> { typedef double type; };
+template<> struct DemoteHelper<QuadDouble> { typedef DoubleDouble type; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct DemoteHelper<Quad> { typedef double type; };
+#endif
+
+template<typename F> using Demote = typename DemoteHelper<F>::type;
+
 // Returning the underlying, or "base", real field
 // -----------------------------------------------
 // Note: The following is for internal usage only; please use Base
@@ -35,7 +35,8 @@ public:
     Graph( const Graph& graph );
     // NOTE: This requires the DistGraph to be over a single process
     Graph( const DistGraph& graph );
-    // TODO: Move constructor
+    // Move the buffers from a given graph (which is left empty)
+    Graph( Graph&& graph ) EL_NO_EXCEPT;
     ~Graph();
 
     // Assignment and reconfiguration
@@ -47,7 +48,10 @@ public:
     const Graph& operator=( const Graph& graph );
     // NOTE: This requires the DistGraph to be over a single process
     const Graph& operator=( const DistGraph& graph );
-    // TODO: Move assignment
+
+    // Move assignment
+    // ---------------
+    Graph& operator=( Graph&& graph ) EL_NO_EXCEPT;
 
     // Make a copy of a subgraph
     // -------------------------
@@ -17,7 +17,15 @@ class Grid
 public:
     explicit Grid
     ( mpi::Comm comm=mpi::COMM_WORLD, GridOrder order=COLUMN_MAJOR );
-    explicit Grid( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR );
+    // If 'nodeAware' is true, the processes are reordered so that each node
+    // holds a contiguous range of the ranks of the grid (so that, e.g., the
+    // columns of a column-major grid of height dividing the number of
+    // processes per node are node-local) and the broadcasts and AllGathers
+    // over the MC, MR, VC, and VR communicators are performed hierarchically
+    // (see mpi::CreateHierarchy)
+    explicit Grid
+    ( mpi::Comm comm, int height, GridOrder order=COLUMN_MAJOR,
+      bool nodeAware=false );
     ~Grid();
 
     // Simple interface (simpler version of distributed-based interface)
@@ -28,6 +36,7 @@ public:
     int Size() const EL_NO_EXCEPT;         // VCSize() and VRSize()
     int Rank() const EL_NO_RELEASE_EXCEPT; // same as OwningRank()
     GridOrder Order() const EL_NO_EXCEPT;  // either COLUMN_MAJOR or ROW_MAJOR
+    bool NodeAware() const EL_NO_EXCEPT;
     mpi::Comm ColComm() const EL_NO_EXCEPT; // MCComm()
     mpi::Comm RowComm() const EL_NO_EXCEPT; // MRComm()
     // VCComm (VRComm) if COLUMN_MAJOR (ROW_MAJOR)
@@ -86,11 +95,20 @@ public:
 
     static int FindFactor( int p ) EL_NO_EXCEPT;
 
+    // The grid over the given layer of a 2.5D decomposition into 'depth'
+    // layers of Size()/depth consecutive processes (viewed by this grid's
+    // viewing communicator), and the communicator between the processes with
+    // the same rank in each layer. These are created collectively on first use
+    // and freed along with this grid.
+    const Grid& LayerGrid( int depth, int layer ) const;
+    mpi::Comm DepthComm( int depth ) const;
+
 private:
     bool haveViewers_;
     int height_, size_, gcd_;
     bool inGrid_;
     GridOrder order_;
+    bool nodeAware_;
 
     vector<int> diagsAndRanks_;
     vector<int> vcToViewing_;
@@ -111,7 +129,15 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    struct Layers
+    {
+        vector<unique_ptr<Grid>> grids;
+        mpi::Comm depthComm;
+    };
+    mutable std::map<int,unique_ptr<Layers>> layers_;
+
     void SetUpGrid();
+    const Layers& GetLayers( int depth ) const;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -126,6 +152,11 @@ bool operator!=( const Grid& A, const Grid& B ) EL_NO_EXCEPT;
 // Return a grid constructed using mpi::COMM_WORLD.
 const Grid& DefaultGrid() EL_NO_RELEASE_EXCEPT;
 
+// The (possibly tuned) blocksize of a routine over the given grid
+template<typename T>
+inline Int Blocksize( const string& routine, const Grid& g )
+{ return Blocksize<T>( routine, g.Height(), g.Width() ); }
+
 inline void AssertSameGrids( const Grid& g1 ) { }
 
 inline void AssertSameGrids( const Grid& g1, const Grid& g2 )
@@ -122,6 +122,10 @@ public:
     void SetViewType( El::ViewType viewType ) EL_NO_EXCEPT;
     El::ViewType ViewType() const EL_NO_EXCEPT;
 
+    // The page placement policy for subsequent (re)allocations
+    void SetNumaPolicy( El::NumaPolicy policy ) EL_NO_EXCEPT;
+    El::NumaPolicy NumaPolicy() const EL_NO_EXCEPT;
+
     // Single-entry manipulation
     // =========================
     scalarType Get( Int i, Int j ) const EL_NO_RELEASE_EXCEPT;
@@ -162,6 +166,7 @@ private:
     // ================
     El::ViewType viewType_;
     Int height_, width_, ldim_;
+    El::NumaPolicy numaPolicy_=DefaultNumaPolicy();
 
     Memory<scalarType> memory_;
     // Const-correctness is internally managed to avoid the need for storing
@@ -177,6 +182,8 @@ private:
     void Empty_( bool freeMemory=true );
     void Resize_( Int height, Int width );
     void Resize_( Int height, Int width, Int ldim );
+    // (Re)allocate a buffer for an ldim_ x width_ matrix
+    void Require_();
 
     void Control_
     ( Int height, Int width, scalarType* buffer, Int ldim );
@@ -33,8 +33,7 @@ Matrix<T>::Matrix( Int height, Int width, bool fixed )
       CSE cse("Matrix::Matrix");
       AssertValidDimensions( height, width );
     )
-    memory_.Require( ldim_ * width );
-    data_ = memory_.Buffer();
+    Require_();
     // TODO: Consider explicitly zeroing
 }
 
@@ -48,8 +47,7 @@ Matrix<T>::Matrix
       CSE cse("Matrix::Matrix");
       AssertValidDimensions( height, width, ldim );
     )
-    memory_.Require( ldim*width );
-    data_ = memory_.Buffer();
+    Require_();
 }
 
 template<typename T>
@@ -81,7 +79,7 @@ Matrix<T>::Matrix
 template<typename T>
 Matrix<T>::Matrix( const Matrix<T>& A )
 : viewType_( OWNER ),
-  height_(0), width_(0), ldim_(1), 
+  height_(0), width_(0), ldim_(1), numaPolicy_(A.numaPolicy_),
   data_(nullptr)
 {
     DEBUG_ONLY(CSE cse("Matrix::Matrix( const Matrix& )"))
@@ -95,7 +93,7 @@ template<typename T>
 Matrix<T>::Matrix( Matrix<T>&& A ) EL_NO_EXCEPT
 : viewType_(A.viewType_),
   height_(A.height_), width_(A.width_), ldim_(A.ldim_),
-  memory_(std::move(A.memory_)), data_(nullptr)
+  numaPolicy_(A.numaPolicy_), memory_(std::move(A.memory_)), data_(nullptr)
 { std::swap( data_, A.data_ ); }
 
 template<typename T>
@@ -266,6 +264,8 @@ Matrix<T>& Matrix<T>::operator=( Matrix<T>&& A )
     {
         memory_.ShallowSwap( A.memory_ );
         std::swap( data_, A.data_ );
+        // The policy describes how the pages were placed, so it follows them
+        std::swap( numaPolicy_, A.numaPolicy_ );
         viewType_ = A.viewType_;
         height_ = A.height_;
         width_ = A.width_;
@@ -377,6 +377,14 @@ template<typename T>
 El::ViewType Matrix<T>::ViewType() const EL_NO_EXCEPT
 { return viewType_; }
 
+template<typename T>
+void Matrix<T>::SetNumaPolicy( El::NumaPolicy policy ) EL_NO_EXCEPT
+{ numaPolicy_ = policy; }
+
+template<typename T>
+El::NumaPolicy Matrix<T>::NumaPolicy() const EL_NO_EXCEPT
+{ return numaPolicy_; }
+
 // Single-entry manipulation
 // =========================
 
@@ -675,8 +683,7 @@ void Matrix<T>::Resize_( Int height, Int width )
     if( reallocate )
     {
         ldim_ = Max( height, 1 );
-        memory_.Require( ldim_ * width );
-        data_ = memory_.Buffer();
+        Require_();
     }
 }
 
@@ -689,11 +696,23 @@ void Matrix<T>::Resize_( Int height, Int width, Int ldim )
     if( reallocate )
     {
         ldim_ = ldim;
-        memory_.Require(ldim*width);
-        data_ = memory_.Buffer();
+        Require_();
     }
 }
 
+template<typename T>
+void Matrix<T>::Require_()
+{
+    // Only bypass the cache of freed blocks when the fresh pages will be
+    // explicitly placed
+    const bool touch = ( numaPolicy_ != NUMA_DEFAULT );
+    const size_t oldSize = memory_.Size();
+    memory_.Require( ldim_*width_, !touch );
+    data_ = memory_.Buffer();
+    if( touch && memory_.Size() != oldSize )
+        FirstTouch( data_, ldim_, width_, numaPolicy_ );
+}
+
 #ifdef EL_INSTANTIATE_CORE
 # define EL_EXTERN
 #else
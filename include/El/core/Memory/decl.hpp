@@ -11,6 +11,69 @@
 
 namespace El {
 
+// The alignment (in bytes) of every buffer handed out by Memory<G> for
+// trivially-copyable datatypes. A multiple of the cache line size allows local
+// kernels to make use of aligned SIMD loads and stores.
+#ifndef EL_MEMORY_ALIGNMENT
+# define EL_MEMORY_ALIGNMENT 64
+#endif
+
+// A size-class cache of freed, aligned blocks
+// ===========================================
+// Rather than returning each freed buffer to the system, blocks are rounded up
+// to one of a small number of size classes per power of two and retained (up
+// to a configurable number of bytes) so that the temporaries created within
+// the loops of blocked algorithms and redistributions need not hit malloc.
+
+// Return a buffer of at least 'numBytes' bytes aligned to EL_MEMORY_ALIGNMENT.
+// If 'cached' is false, the cache is bypassed so that the (untouched) pages
+// can be placed via a first-touch policy.
+void* AlignedAlloc( size_t numBytes, bool cached=true );
+// Return a buffer created via AlignedAlloc to the cache (or to the system)
+void AlignedFree( void* buffer, size_t numBytes );
+
+// The maximum number of freed bytes retained by the cache
+void SetMemoryPoolCapacity( size_t numBytes );
+size_t MemoryPoolCapacity();
+// The number of bytes currently sitting in the cache
+size_t MemoryPoolCachedBytes();
+// Hand every cached block back to the system
+void ReleaseMemoryPool();
+
+// For retaining every block freed by the constructing thread within the scope
+// of a single call (e.g., a factorization or a solve), regardless of the pool
+// capacity. Once no arena is active on any thread, the cache is trimmed back
+// to MemoryPoolCapacity() bytes; ReleaseMemoryPool frees the remainder.
+class MemoryArena
+{
+public:
+    MemoryArena();
+    ~MemoryArena();
+    MemoryArena( const MemoryArena& ) = delete;
+    MemoryArena& operator=( const MemoryArena& ) = delete;
+};
+
+// Policies for the placement of the pages of newly allocated Matrix buffers
+// on NUMA machines. They only have an effect in hybrid (EL_HYBRID) builds.
+namespace NumaPolicyNS {
+enum NumaPolicy
+{
+    NUMA_DEFAULT,     // Pages are placed by whichever thread first writes
+    NUMA_FIRST_TOUCH, // Each column is touched by the thread which owns it
+                      // within a (static) parallel loop over the columns
+    NUMA_INTERLEAVE   // Pages are touched round-robin by the threads
+};
+}
+using namespace NumaPolicyNS;
+
+// The policy adopted by each newly constructed Matrix
+void SetDefaultNumaPolicy( NumaPolicy policy );
+NumaPolicy DefaultNumaPolicy();
+
+// Touch the pages of an ldim x width column-major buffer using 'policy'
+template<typename G>
+void FirstTouch( G* buffer, Int ldim, Int width, NumaPolicy policy );
+
 template<typename G>
 class Memory
 {
@@ -31,7 +94,7 @@ public:
     G* Buffer() const EL_NO_EXCEPT;
     size_t Size() const EL_NO_EXCEPT;
 
-    G* Require( size_t size );
+    G* Require( size_t size, bool cached=true );
     void Release();
     void Empty();
 };
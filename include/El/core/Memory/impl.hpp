@@ -11,14 +11,34 @@ namespace El {
 
 namespace {
 
+// Datatypes which do not require destruction (e.g., the standard real and
+// complex types and the QD types) are drawn from the aligned block cache, 
+// whereas the remaining types (e.g., BigInt and BigFloat) must be constructed
+// and destructed via new[] and delete[]
 template<typename G>
-static G* New( size_t size )
+using IsPoolable = std::is_trivially_destructible<G>;
+
+template<typename G,typename=EnableIf<IsPoolable<G>>>
+static G* New( size_t size, bool cached )
+{
+    return static_cast<G*>( AlignedAlloc( size*sizeof(G), cached ) );
+}
+
+template<typename G,typename=DisableIf<IsPoolable<G>>,typename=void>
+static G* New( size_t size, bool cached )
 {
     return new G[size];
 }
 
-template<typename G>
-static void Delete( G*& ptr )
+template<typename G,typename=EnableIf<IsPoolable<G>>>
+static void Delete( G*& ptr, size_t size )
+{
+    AlignedFree( ptr, size*sizeof(G) );
+    ptr = nullptr;
+}
+
+template<typename G,typename=DisableIf<IsPoolable<G>>,typename=void>
+static void Delete( G*& ptr, size_t size )
 {
     delete[] ptr;
     ptr = nullptr;
@@ -26,6 +46,36 @@ static void Delete( G*& ptr )
 
 } // anonymous namespace
 
+template<typename G>
+void FirstTouch( G* buffer, Int ldim, Int width, NumaPolicy policy )
+{
+#ifdef EL_HYBRID
+    if( policy == NUMA_FIRST_TOUCH )
+    {
+        // Mirror the static column partition of the EL_PARALLEL_FOR loops
+        EL_PARALLEL_FOR
+        for( Int j=0; j<width; ++j )
+            MemZero( &buffer[j*ldim], ldim );
+    }
+    else if( policy == NUMA_INTERLEAVE )
+    {
+        const size_t size = size_t(ldim)*size_t(width);
+        const size_t pageSize = std::max( size_t(4096)/sizeof(G), size_t(1) );
+        const size_t numPages = (size+pageSize-1)/pageSize;
+        #pragma omp parallel
+        {
+            const size_t numThreads = omp_get_num_threads();
+            const size_t thread = omp_get_thread_num();
+            for( size_t page=thread; page<numPages; page+=numThreads )
+            {
+                const size_t offset = page*pageSize;
+                MemZero( &buffer[offset], std::min(pageSize,size-offset) );
+            }
+        }
+    }
+#endif
+}
+
 template<typename G>
 Memory<G>::Memory()
 : size_(0), rawBuffer_(nullptr), buffer_(nullptr)
@@ -38,7 +88,7 @@ Memory<G>::Memory( size_t size )
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -56,7 +106,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -66,18 +116,19 @@ template<typename G>
 size_t  Memory<G>::Size() const EL_NO_EXCEPT { return size_; }
 
 template<typename G>
-G* Memory<G>::Require( size_t size )
+G* Memory<G>::Require( size_t size, bool cached )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
-            rawBuffer_ = New<G>( size );
+            rawBuffer_ = New<G>( size, cached );
             buffer_ = rawBuffer_;
 
             size_ = size;
@@ -110,7 +161,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
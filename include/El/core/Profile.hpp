@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_PROFILE_HPP
+#define EL_PROFILE_HPP
+
+namespace El {
+
+namespace ProfileFormatNS {
+enum ProfileFormat
+{
+  PROFILE_JSON,         // per-region statistics aggregated over the processes
+  PROFILE_CHROME_TRACE  // the timeline of every process (chrome://tracing)
+};
+}
+using namespace ProfileFormatNS;
+
+// Hierarchical profiling
+// ======================
+// Each region is identified by its name together with the names of the
+// regions it is nested within. Every process (and every thread) maintains its
+// own tree of regions with call counts and inclusive/exclusive times, and the
+// reporting routines aggregate the trees of the calling thread over a
+// communicator. When profiling is disabled, entering and exiting a region
+// only checks a flag.
+//
+// Profiling can also be enabled at runtime via the command-line arguments
+//   --profile                (print a report during Finalize),
+//   --profile-json <file>    (write aggregated statistics during Finalize),
+//   --profile-trace <file>   (write a chrome-trace timeline during Finalize),
+// or by setting the environment variable EL_PROFILE (equivalent to --profile).
+
+void EnableProfiling( bool trace=false );
+void DisableProfiling();
+bool ProfilingEnabled();
+
+// Discard all recorded regions (and trace events) of the calling thread
+void ResetProfile();
+
+// NOTE: The name must remain valid until the region is exited
+void PushProfileRegion( const char* name );
+void PopProfileRegion();
+
+// Scoped region which is entered upon construction and exited upon destruction
+// (along with any regions pushed within it which were left open, e.g., due to
+// an exception)
+class ProfileRegion
+{
+public:
+    explicit ProfileRegion( const char* name );
+    ~ProfileRegion();
+private:
+    // The number of open regions before this one was entered (or -1 if
+    // profiling was disabled at construction)
+    Int depth_;
+};
+
+// Enables profiling for its lifetime (if it was not already enabled) and then
+// prints and discards the recorded profile of the calling thread. This is
+// meant for honoring the 'time' members of the control structures.
+class ScopedProfile
+{
+public:
+    explicit ScopedProfile( bool enable, mpi::Comm comm=mpi::COMM_WORLD );
+    ~ScopedProfile();
+private:
+    bool active_;
+    mpi::Comm comm_;
+};
+
+// Collective over the communicator; only the root outputs
+void PrintProfile( mpi::Comm comm=mpi::COMM_WORLD, ostream& os=cout );
+void WriteProfile
+( const string& filename,
+  ProfileFormat format=PROFILE_JSON,
+  mpi::Comm comm=mpi::COMM_WORLD );
+
+} // namespace El
+
+#endif // ifndef EL_PROFILE_HPP
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SIMD_HPP
+#define EL_CORE_SIMD_HPP
+
+namespace El {
+namespace simd {
+
+// Explicitly vectorized kernels for contiguous level-1 operations on
+// float, double, and their complex counterparts (as well as double-double
+// arithmetic when QD is available). The instruction set is chosen at runtime:
+// AVX-512 or AVX2 (with FMA) on x86-64 when compiled with GCC or Clang, and
+// the generic (scalar) templates below are used for every other datatype or
+// platform.
+
+enum InstructionSet
+{
+  SCALAR_INSTRUCTIONS=0,
+  AVX2_INSTRUCTIONS,
+  AVX512_INSTRUCTIONS
+};
+
+// The most capable instruction set supported by both the build and the CPU
+InstructionSet DetectedInstructionSet();
+InstructionSet ActiveInstructionSet();
+// Restrict the kernels to (at most) the given instruction set, e.g., in order
+// to compare against the scalar implementations
+void SetInstructionSet( InstructionSet set );
+string InstructionSetName( InstructionSet set );
+
+// x^H y
+// -----
+template<typename T>
+T Dot( Int n, const T* x, const T* y )
+{
+    T alpha(0);
+    for( Int i=0; i<n; ++i )
+        alpha += Conj(x[i])*y[i];
+    return alpha;
+}
+float Dot( Int n, const float* x, const float* y );
+double Dot( Int n, const double* x, const double* y );
+scomplex Dot( Int n, const scomplex* x, const scomplex* y );
+dcomplex Dot( Int n, const dcomplex* x, const dcomplex* y );
+#ifdef EL_HAVE_QD
+DoubleDouble Dot( Int n, const DoubleDouble* x, const DoubleDouble* y );
+#endif
+
+// || x ||_2
+// ---------
+// The vectorized versions form the unscaled sum of squares (in double
+// precision for single-precision input) and only fall back to the scaled
+// accumulation if overflow or harmful underflow could have occurred
+template<typename F>
+Base<F> Nrm2( Int n, const F* x )
+{
+    typedef Base<F> Real;
+    Real scale = 0;
+    Real scaledSquare = 1;
+    for( Int i=0; i<n; ++i )
+        UpdateScaledSquare( x[i], scale, scaledSquare );
+    return scale*Sqrt(scaledSquare);
+}
+float Nrm2( Int n, const float* x );
+double Nrm2( Int n, const double* x );
+float Nrm2( Int n, const scomplex* x );
+double Nrm2( Int n, const dcomplex* x );
+#ifdef EL_HAVE_QD
+DoubleDouble Nrm2( Int n, const DoubleDouble* x );
+#endif
+
+// The index of the first entry of maximum absolute value (-1 if n=0)
+// ------------------------------------------------------------------
+template<typename T>
+Int MaxAbsInd( Int n, const T* x )
+{
+    typedef Base<T> Real;
+    Real maxAbsVal = -1;
+    Int maxAbsInd = -1;
+    for( Int i=0; i<n; ++i )
+    {
+        const Real absVal = Abs(x[i]);
+        if( absVal > maxAbsVal )
+        {
+            maxAbsVal = absVal;
+            maxAbsInd = i;
+        }
+    }
+    return maxAbsInd;
+}
+Int MaxAbsInd( Int n, const float* x );
+Int MaxAbsInd( Int n, const double* x );
+Int MaxAbsInd( Int n, const scomplex* x );
+Int MaxAbsInd( Int n, const dcomplex* x );
+
+// c := a o b
+// ----------
+template<typename T>
+void Hadamard( Int n, const T* a, const T* b, T* c )
+{
+    for( Int i=0; i<n; ++i )
+        c[i] = a[i]*b[i];
+}
+void Hadamard( Int n, const float* a, const float* b, float* c );
+void Hadamard( Int n, const double* a, const double* b, double* c );
+void Hadamard( Int n, const scomplex* a, const scomplex* b, scomplex* c );
+void Hadamard( Int n, const dcomplex* a, const dcomplex* b, dcomplex* c );
+
+// a1 := gamma11 a1 + gamma12 a2 and a2 := gamma21 a1 + gamma22 a2
+// ---------------------------------------------------------------
+template<typename T>
+void Transform2x2
+( Int n, T gamma11, T gamma12, T gamma21, T gamma22, T* a1, T* a2 )
+{
+    for( Int i=0; i<n; ++i )
+    {
+        const T temp = gamma11*a1[i] + gamma12*a2[i];
+        a2[i] = gamma21*a1[i] + gamma22*a2[i];
+        a1[i] = temp;
+    }
+}
+void Transform2x2
+( Int n,
+  float gamma11, float gamma12, float gamma21, float gamma22,
+  float* a1, float* a2 );
+void Transform2x2
+( Int n,
+  double gamma11, double gamma12, double gamma21, double gamma22,
+  double* a1, double* a2 );
+void Transform2x2
+( Int n,
+  scomplex gamma11, scomplex gamma12, scomplex gamma21, scomplex gamma22,
+  scomplex* a1, scomplex* a2 );
+void Transform2x2
+( Int n,
+  dcomplex gamma11, dcomplex gamma12, dcomplex gamma21, dcomplex gamma22,
+  dcomplex* a1, dcomplex* a2 );
+
+} // namespace simd
+} // namespace El
+
+#endif // ifndef EL_CORE_SIMD_HPP
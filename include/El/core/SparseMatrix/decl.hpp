@@ -27,7 +27,8 @@ public:
     SparseMatrix( const SparseMatrix<T>& A );
     // NOTE: This requires A to be distributed over a single process
     SparseMatrix( const DistSparseMatrix<T>& A );
-    // TODO: Move constructor
+    // Move the buffers from a given matrix (which is left empty)
+    SparseMatrix( SparseMatrix<T>&& A ) EL_NO_EXCEPT;
     ~SparseMatrix();
 
     // Assignment and reconfiguration
@@ -68,7 +69,10 @@ public:
     const SparseMatrix<T>& operator=( const SparseMatrix<T>& A );
     // NOTE: This requires A to be distributed over a single process
     const SparseMatrix<T>& operator=( const DistSparseMatrix<T>& A );
-    // TODO: Move assignment
+
+    // Move assignment
+    // ---------------
+    SparseMatrix<T>& operator=( SparseMatrix<T>&& A ) EL_NO_EXCEPT;
 
     // Make a copy of a submatrix
     // --------------------------
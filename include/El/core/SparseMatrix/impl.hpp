@@ -41,6 +41,11 @@ SparseMatrix<T>::SparseMatrix( const DistSparseMatrix<T>& A )
     *this = A;
 }
 
+template<typename T>
+SparseMatrix<T>::SparseMatrix( SparseMatrix<T>&& A ) EL_NO_EXCEPT
+: graph_(std::move(A.graph_)), vals_(std::move(A.vals_))
+{ A.vals_.clear(); }
+
 template<typename T>
 SparseMatrix<T>::~SparseMatrix() { }
 
@@ -161,6 +166,18 @@ const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
     return *this;
 }
 
+template<typename T>
+SparseMatrix<T>& SparseMatrix<T>::operator=( SparseMatrix<T>&& A ) EL_NO_EXCEPT
+{
+    if( &A != this )
+    {
+        graph_ = std::move(A.graph_);
+        vals_ = std::move(A.vals_);
+        A.vals_.clear();
+    }
+    return *this;
+}
+
 template<typename T>
 const SparseMatrix<T>&
 SparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
@@ -83,6 +83,52 @@ T Input( string name, string desc, T defaultVal );
 void ProcessInput();
 void PrintInputReport();
 
+// The mutable state consulted by (sequential) routines: the algorithmic
+// blocksize stack, the random number generator, and (in debug mode) the call
+// stack. Each thread is given its own context so that independent sequential
+// operations may be run concurrently from several threads; a thread may also
+// install an explicitly constructed context.
+class Context
+{
+public:
+    Context();
+
+    // For getting and setting the algorithmic blocksize
+    Int Blocksize() const;
+    void SetBlocksize( Int blocksize );
+    // Whether the current blocksize was set or pushed (rather than being the
+    // default, which defers to the tuned blocksizes)
+    bool BlocksizeSpecified() const;
+
+    // For manipulating the algorithmic blocksize as a stack
+    void PushBlocksizeStack( Int blocksize );
+    void PopBlocksizeStack();
+    // Reset the stack to the single default blocksize
+    void ResetBlocksizeStack();
+    void EmptyBlocksizeStack();
+
+    std::mt19937& Generator();
+    void Seed( unsigned long seed );
+
+    DEBUG_ONLY(
+      void PushCallStack( string s );
+      void PopCallStack();
+      void DumpCallStack( ostream& os=cerr );
+    )
+
+private:
+    // An entry of zero denotes the default blocksize
+    std::stack<Int> blocksizeStack_;
+    std::mt19937 generator_;
+    DEBUG_ONLY(std::stack<string> callStack_;)
+};
+
+// Return the context of the calling thread
+Context& ThreadContext();
+// Route the calling thread through 'context' (or, if it is a null pointer,
+// through the thread's own context)
+void SetThreadContext( Context* context );
+
 // For getting and setting the algorithmic blocksize
 Int Blocksize();
 void SetBlocksize( Int blocksize );
@@ -91,11 +137,110 @@ void SetBlocksize( Int blocksize );
 void PushBlocksizeStack( Int blocksize );
 void PopBlocksizeStack();
 
+// Tuned algorithmic blocksizes
+// ----------------------------
+// The blocked routines request their blocksize by routine name (e.g.,
+// "Cholesky"), datatype, and process grid shape. Unless the calling thread has
+// set or pushed a blocksize, the entry of the tuning table for that routine,
+// datatype, and grid shape is returned; failing that, the entry for the same
+// routine and datatype whose grid has the closest number of processes; and
+// failing that, the default blocksize.
+//
+// Tuning tables are produced by calibration runs such as
+// examples/core/TuneBlocksizes.cpp and can be loaded during Initialize via the
+// command-line argument --blocksize-tuning <file> or the environment variable
+// EL_BLOCKSIZE_TUNING. Each line of a tuning file is of the form
+//   <routine> <gridHeight> <gridWidth> <blocksize> <datatype>
+// and '#' begins a comment.
+
+Int Blocksize
+( const string& routine, const string& typeName,
+  int gridHeight=1, int gridWidth=1 );
+template<typename T>
+Int Blocksize( const string& routine, int gridHeight=1, int gridWidth=1 )
+{ return Blocksize( routine, TypeName<T>(), gridHeight, gridWidth ); }
+
+void SetTunedBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth, Int blocksize );
+void ClearTunedBlocksizes();
+
+// The root process reads the file and broadcasts its contents
+void LoadBlocksizeTuning
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+// The root process writes the (identical) tuning table of the calling process
+void SaveBlocksizeTuning
+( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+// Time 'run' with each candidate blocksize pushed (taking the best of
+// 'numReps' runs and the slowest process of 'comm'), record the fastest
+// candidate in the tuning table, and return it
+Int TuneBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth,
+  const vector<Int>& candidates, function<void()> run,
+  mpi::Comm comm=mpi::COMM_WORLD, Int numReps=3 );
+template<typename T>
+Int TuneBlocksize
+( const string& routine, int gridHeight, int gridWidth,
+  const vector<Int>& candidates, function<void()> run,
+  mpi::Comm comm=mpi::COMM_WORLD, Int numReps=3 )
+{
+    return TuneBlocksize
+    ( routine, TypeName<T>(), gridHeight, gridWidth, candidates, run,
+      comm, numReps );
+}
+
+// Machine cost model
+// ------------------
+// An alpha-beta-gamma model of the machine which the distributed routines
+// use to choose between their algorithmic variants (e.g., the stationary
+// A/B/C/Dot SUMMA Gemms): a message of n bytes costs alpha + beta n seconds
+// and each flop of a local Gemm costs gamma seconds. The defaults are rough
+// estimates for a commodity cluster. A calibrated model can be measured by
+// CalibrateCostModel or, during Initialize, via the command-line argument
+// --calibrate-cost-model (or the environment variable
+// EL_CALIBRATE_COST_MODEL), and can be loaded during Initialize via the
+// command-line argument --cost-model <file> or the environment variable
+// EL_COST_MODEL. Each line of a cost model file is of the form
+//   <parameter> <value>
+// where <parameter> is one of alpha, beta, or gamma, and '#' begins a comment.
+
+struct CostModel
+{
+    double alpha=1.e-5;  // seconds per message
+    double beta=1.e-9;   // seconds per byte
+    double gamma=1.e-10; // seconds per flop
+};
+
+const CostModel& GetCostModel();
+void SetCostModel( const CostModel& model );
+void ResetCostModel();
+
+// Time ping-pongs between pairs of processes and a local double-precision
+// Gemm (taking the slowest process of 'comm'), install the result, and
+// return it
+CostModel CalibrateCostModel( mpi::Comm comm=mpi::COMM_WORLD );
+
+// The root process reads the file and broadcasts its contents
+void LoadCostModel( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+// The root process writes the (identical) model of the calling process
+void SaveCostModel( const string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
 Int DefaultBlockHeight();
 Int DefaultBlockWidth();
 void SetDefaultBlockHeight( Int blockHeight );
 void SetDefaultBlockWidth( Int blockWidth );
 
+// The number of threads used to pack and unpack the buffers of the
+// redistributions (always one unless Elemental was built in hybrid mode).
+// The default of zero defers to omp_get_max_threads(); it can be overridden
+// during Initialize by a positive count given via the command-line argument
+// --packing-threads <num> or (if the argument is absent) the environment
+// variable EL_PACKING_THREADS.
+Int PackingThreads();
+void SetPackingThreads( Int numThreads );
+
 std::mt19937& Generator();
 
 template<typename T,typename=EnableIf<IsScalar<T>>>
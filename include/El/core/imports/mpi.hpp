@@ -14,12 +14,16 @@ namespace El {
 
 using std::function;
 using std::vector;
+using std::ostream;
+using std::cout;
+using std::string;
 
 namespace mpi {
 
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -87,7 +91,8 @@ struct Request
 {
     Request() { }
 
-    MPI_Request backend;
+    // Waiting on a request which was never started returns immediately
+    MPI_Request backend=MPI_REQUEST_NULL;
 
     vector<byte> buffer;
     bool receivingPacked=false;
@@ -248,6 +253,21 @@ void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
 ( Comm comm, ErrorHandler errorHandler ) EL_NO_RELEASE_EXCEPT;
+void SetCommName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT;
+string CommName( Comm comm ) EL_NO_RELEASE_EXCEPT;
+// Split into the sets of processes which can share memory (e.g., nodes)
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
+
+// Once a hierarchy has been created for a communicator, Broadcast and
+// AllGather over it are performed within each node and between one leader
+// per node, so that each message crosses the network once per node. The
+// nodes are those of SplitShared unless a color is explicitly given.
+// Creating a hierarchy is collective, and it must be freed before the
+// communicator.
+void CreateHierarchy( Comm comm ) EL_NO_RELEASE_EXCEPT;
+void CreateHierarchy( Comm comm, int nodeColor ) EL_NO_RELEASE_EXCEPT;
+bool HaveHierarchy( Comm comm ) EL_NO_EXCEPT;
+void FreeHierarchy( Comm comm ) EL_NO_RELEASE_EXCEPT;
 
 // Cartesian communicator routines
 void CartCreate
@@ -980,6 +1000,116 @@ void IGather
   int root, Comm comm,
   Request<Complex<Real>>& request );
 
+// Non-blocking AllGather, AllToAll, AllReduce, and ReduceScatter
+// --------------------------------------------------------------
+// The buffers must not be accessed until the request has been waited upon.
+// Unlike the blocking versions, these are not available for the
+// arbitrary-precision (MPC) datatypes, which require (de)serialization, with
+// the exception of IAllGather, which blocks for them.
+template<typename Real>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+#ifdef EL_HAVE_MPC
+template<>
+void IAllGather
+( const BigInt* sbuf, int sc,
+        BigInt* rbuf, int rc, Comm comm,
+  Request<BigInt>& request );
+template<>
+void IAllGather
+( const ValueInt<BigInt>* sbuf, int sc,
+        ValueInt<BigInt>* rbuf, int rc, Comm comm,
+  Request<ValueInt<BigInt>>& request );
+template<>
+void IAllGather
+( const Entry<BigInt>* sbuf, int sc,
+        Entry<BigInt>* rbuf, int rc, Comm comm,
+  Request<Entry<BigInt>>& request );
+
+template<>
+void IAllGather
+( const BigFloat* sbuf, int sc,
+        BigFloat* rbuf, int rc, Comm comm,
+  Request<BigFloat>& request );
+template<>
+void IAllGather
+( const ValueInt<BigFloat>* sbuf, int sc,
+        ValueInt<BigFloat>* rbuf, int rc, Comm comm,
+  Request<ValueInt<BigFloat>>& request );
+template<>
+void IAllGather
+( const Entry<BigFloat>* sbuf, int sc,
+        Entry<BigFloat>* rbuf, int rc, Comm comm,
+  Request<Entry<BigFloat>>& request );
+#endif
+template<typename Real>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+
+template<typename Real>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request );
+template<typename Real>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+
+// NOTE: The count and displacement arrays must also remain valid until the
+//       request has been waited upon
+template<typename Real>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request );
+template<typename Real>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Complex<Real>>& request );
+
+template<typename Real>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request );
+
+// In-place option
+template<typename Real>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request );
+
+// Each process receives 'rc' entries
+template<typename Real>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Gather with variable recv sizes
 // -------------------------------
 template<typename Real>
@@ -1119,6 +1249,14 @@ void AllGather
   Comm comm )
 EL_NO_RELEASE_EXCEPT;
 
+// AllGather with variable recv sizes in which the contribution of this process
+// already lies at rbuf[rds[rank]] (and is therefore sent in place)
+// NOTE: The arbitrary-precision types are not supported since they must be
+//       serialized
+template<typename T>
+void AllGather( T* rbuf, const int* rcs, const int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+
 // Scatter
 // -------
 template<typename Real>
@@ -1834,6 +1972,79 @@ void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Large-count variants
+// --------------------
+// MPI counts and displacements are ints, so the following variants accept
+// Int counts and displacements. If every count and displacement within the
+// communicator is at most MaxCount(), the standard routine is called;
+// otherwise the entries are exchanged with point-to-point messages of at most
+// MaxCount() entries each. (With 32-bit Int, the standard routines suffice.)
+//
+// MaxCount defaults to the largest int but may be decreased in order to
+// exercise the point-to-point exchanges on modest amounts of data.
+Int MaxCount();
+void SetMaxCount( Int maxCount );
+
+#ifdef EL_USE_64BIT_INTS
+template<typename T>
+void Gather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds,
+  int root, Comm comm ) EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllGather( T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+void AllToAll
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT;
+#endif
+
+#ifdef EL_HAVE_MPI3_RMA
+// One-sided communication
+// -----------------------
+typedef MPI_Win Window;
+
+// Expose the 'size' entries of 'buf' (collectively over 'comm')
+template<typename T>
+void WindowCreate( T* buf, Int size, Comm comm, Window& window )
+EL_NO_RELEASE_EXCEPT;
+void WindowFree( Window& window ) EL_NO_RELEASE_EXCEPT;
+
+// Allocate 'size' entries which may be directly accessed by the other
+// processes of 'comm' (which must share memory, see SplitShared) and return
+// the address of the entries of 'rank'
+template<typename T>
+void WindowAllocateShared( Int size, Comm comm, T*& buf, Window& window )
+EL_NO_RELEASE_EXCEPT;
+template<typename T>
+T* WindowSharedQuery( int rank, Window window ) EL_NO_RELEASE_EXCEPT;
+
+// Begin and end a passive-target access epoch to every process
+void WindowLockAll( Window window ) EL_NO_RELEASE_EXCEPT;
+void WindowUnlockAll( Window window ) EL_NO_RELEASE_EXCEPT;
+
+// Complete the pending operations to 'rank' locally (so that their buffers may
+// be reused) or to every process at the target (so that they are visible)
+void WindowFlushLocal( int rank, Window window ) EL_NO_RELEASE_EXCEPT;
+void WindowFlushAll( Window window ) EL_NO_RELEASE_EXCEPT;
+// Synchronize the public and private copies of the local window
+void WindowSync( Window window ) EL_NO_RELEASE_EXCEPT;
+
+// Atomically add buf[k] to the entry at offsets[k] of the window of 'target'
+// for each 0 <= k < count (with a single MPI_Accumulate)
+template<typename T>
+void Accumulate
+( const T* buf, const Int* offsets, int count, int target, Window window )
+EL_NO_RELEASE_EXCEPT;
+#endif
+
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
@@ -1908,6 +2119,88 @@ void CreateBigFloatFamily();
 void DestroyBigFloatFamily();
 #endif
 
+// Traffic accounting
+// ==================
+// When enabled, each call of a communication wrapper records the number of
+// bytes sent and received by the calling process and the time spent within
+// MPI, keyed by the wrapper and the name of the communicator. The
+// communicators of each Grid are named "MC", "MR", "VC", "VR", "MD",
+// "MDPerp", "Owning", and "Viewing". The byte counts are of the local
+// contributions rather than of the messages generated by the collective
+// algorithms, e.g., the root of a Broadcast of n bytes counts n bytes sent
+// and every other process counts n bytes received. One-sided accumulations
+// count the bytes sent by their origin and, since windows are not named, are
+// recorded (as are the window synchronizations) without a communicator name.
+//
+// The counters can also be enabled at runtime via the command-line argument
+// --mpi-traffic (or the environment variable EL_MPI_TRAFFIC), in which case
+// they are printed during Finalize.
+
+namespace TrafficRoutineNS {
+enum TrafficRoutine
+{
+  TRAFFIC_ACCUMULATE,
+  TRAFFIC_ALL_GATHER,
+  TRAFFIC_ALL_REDUCE,
+  TRAFFIC_ALL_TO_ALL,
+  TRAFFIC_BARRIER,
+  TRAFFIC_BROADCAST,
+  TRAFFIC_GATHER,
+  TRAFFIC_IALL_GATHER,
+  TRAFFIC_IALL_REDUCE,
+  TRAFFIC_IALL_TO_ALL,
+  TRAFFIC_IBROADCAST,
+  TRAFFIC_IGATHER,
+  TRAFFIC_IRECV,
+  TRAFFIC_IREDUCE_SCATTER,
+  TRAFFIC_ISEND,
+  TRAFFIC_RECV,
+  TRAFFIC_REDUCE,
+  TRAFFIC_REDUCE_SCATTER,
+  TRAFFIC_SCAN,
+  TRAFFIC_SCATTER,
+  TRAFFIC_SEND,
+  TRAFFIC_SEND_RECV,
+  TRAFFIC_WAIT,
+  TRAFFIC_WINDOW_CREATE,
+  TRAFFIC_WINDOW_FREE,
+  TRAFFIC_WINDOW_SYNC,
+  NUM_TRAFFIC_ROUTINES
+};
+}
+using namespace TrafficRoutineNS;
+
+string TrafficRoutineName( TrafficRoutine routine );
+
+struct TrafficCounter
+{
+    long long numCalls=0;
+    long long bytesSent=0;
+    long long bytesRecv=0;
+    double time=0;
+};
+
+typedef std::map<std::pair<TrafficRoutine,string>,TrafficCounter>
+  TrafficCounterMap;
+
+void EnableTrafficCounters();
+void DisableTrafficCounters();
+bool TrafficCountersEnabled() EL_NO_EXCEPT;
+void ResetTrafficCounters();
+
+// The counters of the calling process
+TrafficCounterMap TrafficCounters();
+TrafficCounter TrafficCounters( TrafficRoutine routine, const string& commName );
+
+// Collective over the communicator: the root prints the counters summed over
+// the processes together with the maximum time spent by any one process
+void PrintTrafficCounters( Comm comm=COMM_WORLD, ostream& os=cout );
+
+// Used by the wrappers to record a single call
+void RecordTraffic
+( TrafficRoutine routine, Comm comm,
+  long long bytesSent, long long bytesRecv, double time );
+
 // Convenience functions which might not be very useful
 int Comm::Rank() const EL_NO_RELEASE_EXCEPT { return mpi::Rank(*this); }
 int Comm::Size() const EL_NO_RELEASE_EXCEPT { return mpi::Size(*this); }
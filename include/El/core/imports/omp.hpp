@@ -17,9 +17,24 @@
 # else
 #  define EL_PARALLEL_FOR_COLLAPSE2 EL_PARALLEL_FOR
 # endif
+// Parallel loops over a runtime number of threads which are run sequentially
+// (without forking) when only a single thread is requested
+# define EL_OMP_PRAGMA(CLAUSES) _Pragma(#CLAUSES)
+# define EL_PARALLEL_FOR_THREADS(NUMTHREADS) \
+  EL_OMP_PRAGMA(omp parallel for num_threads(NUMTHREADS) if(NUMTHREADS>1))
+# ifdef EL_HAVE_OMP_COLLAPSE
+#  define EL_PARALLEL_FOR_COLLAPSE2_THREADS(NUMTHREADS) \
+   EL_OMP_PRAGMA(omp parallel for collapse(2) \
+                 num_threads(NUMTHREADS) if(NUMTHREADS>1))
+# else
+#  define EL_PARALLEL_FOR_COLLAPSE2_THREADS(NUMTHREADS) \
+   EL_PARALLEL_FOR_THREADS(NUMTHREADS)
+# endif
 #else
 # define EL_PARALLEL_FOR 
 # define EL_PARALLEL_FOR_COLLAPSE2
+# define EL_PARALLEL_FOR_THREADS(NUMTHREADS)
+# define EL_PARALLEL_FOR_COLLAPSE2_THREADS(NUMTHREADS)
 #endif
 
 #ifdef EL_AVOID_OMP_FMA
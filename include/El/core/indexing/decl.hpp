@@ -41,6 +41,9 @@ Int MaxBlockedLength_( Int n, Int bsize, Int cut, Int numProcs ) EL_NO_EXCEPT;
 
 Int GlobalBlockedIndex( Int iLoc, Int shift, Int bsize, Int cut, Int numProcs );
 
+// The number of indices from i through the end of the block containing i
+Int BlockRemainder( Int i, Int bsize, Int cut ) EL_NO_EXCEPT;
+
 // Miscellaneous indexing routines
 // ===============================
 
@@ -163,6 +163,9 @@ GlobalBlockedIndex( Int iLoc, Int shift, Int bsize, Int cut, Int numProcs )
     return iBefore + iMid + iPost;
 }
 
+inline Int BlockRemainder( Int i, Int bsize, Int cut ) EL_NO_EXCEPT
+{ return bsize - Mod_( i+cut, bsize ); }
+
 // Miscellaneous indexing routines
 // ===============================
 
@@ -90,6 +90,48 @@ F SampleBall( const F& center=F(0), const Base<F>& radius=Base<F>(1) );
 template<typename Real,typename=EnableIf<IsReal<Real>>> 
 Real SampleBall( const Real& center=Real(0), const Real& radius=Real(1) );
 
+// Counter-based random number generation
+// ======================================
+// The Philox4x32-10 generator of Salmon et al. maps a 128-bit counter and a
+// 64-bit key to 128 pseudorandom bits without any state. Keying it by a seed
+// and a stream index and using the global indices (i,j) as the counter allows
+// each process (and thread) to generate exactly the entries of a random
+// distributed matrix which it owns, with results that are independent of the
+// grid shape and distribution.
+
+typedef std::array<std::uint32_t,4> PhiloxCounter;
+typedef std::array<std::uint32_t,2> PhiloxKey;
+
+PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key ) EL_NO_EXCEPT;
+
+// The key of the 'stream'-th random matrix generated from 'seed'
+PhiloxKey CounterKey
+( unsigned long long seed, unsigned long long stream ) EL_NO_EXCEPT;
+
+// The seed of the distributed random matrix generators
+void SetCounterSeed( unsigned long long seed );
+unsigned long long CounterSeed();
+
+// Returns the index of the next stream, agreed upon over the communicator
+// (every process of which must call this routine)
+unsigned long long NextCounterStream( mpi::Comm comm );
+
+// Analogues of SampleNormal and SampleBall which are deterministic functions
+// of the key and the indices (for float, double, and their complex types)
+template<typename F>
+F CounterSampleNormal
+( const PhiloxKey& key, Int i, Int j,
+  const F& mean=F(0), const Base<F>& stddev=Base<F>(1) ) EL_NO_EXCEPT;
+template<typename F>
+F CounterSampleBall
+( const PhiloxKey& key, Int i, Int j,
+  const F& center=F(0), const Base<F>& radius=Base<F>(1) ) EL_NO_EXCEPT;
+
+// Set each local entry A(i,j) to sample(key,i,j) using a freshly agreed upon
+// stream of the counter-based generator
+template<typename T,class Sampler>
+void CounterFill( AbstractDistMatrix<T>& A, Sampler sample );
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_DECL_HPP
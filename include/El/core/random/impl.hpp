@@ -197,6 +197,119 @@ template<typename Real,typename>
 Real SampleBall( const Real& center, const Real& radius )
 { return SampleUniform<Real>(center-radius,center+radius); }
 
+inline PhiloxCounter
+Philox4x32( PhiloxCounter ctr, PhiloxKey key ) EL_NO_EXCEPT
+{
+    const std::uint64_t M0=0xD2511F53, M1=0xCD9E8D57;
+    const std::uint32_t W0=0x9E3779B9, W1=0xBB67AE85;
+    for( Int round=0; round<10; ++round )
+    {
+        const std::uint64_t prod0 = M0*ctr[0];
+        const std::uint64_t prod1 = M1*ctr[2];
+        const std::uint32_t hi0 = std::uint32_t(prod0>>32),
+                            lo0 = std::uint32_t(prod0);
+        const std::uint32_t hi1 = std::uint32_t(prod1>>32),
+                            lo1 = std::uint32_t(prod1);
+        ctr = {{ hi1^ctr[1]^key[0], lo1, hi0^ctr[3]^key[1], lo0 }};
+        key[0] += W0;
+        key[1] += W1;
+    }
+    return ctr;
+}
+
+namespace counter_random {
+
+// The pair of 53-bit uniform samples in (0,1] and [0,1) generated at (i,j)
+inline std::pair<double,double>
+Uniforms( const PhiloxKey& key, Int i, Int j ) EL_NO_EXCEPT
+{
+    const std::uint64_t iBits = i, jBits = j;
+    const PhiloxCounter ctr =
+      {{ std::uint32_t(iBits), std::uint32_t(iBits>>32),
+         std::uint32_t(jBits), std::uint32_t(jBits>>32) }};
+    const PhiloxCounter bits = Philox4x32( ctr, key );
+    const std::uint64_t a = (std::uint64_t(bits[0])<<32) | bits[1];
+    const std::uint64_t b = (std::uint64_t(bits[2])<<32) | bits[3];
+    const double scale = 1./9007199254740992.; // 2^-53
+    return std::make_pair( ((a>>11)+1)*scale, (b>>11)*scale );
+}
+
+} // namespace counter_random
+
+template<typename F>
+F CounterSampleNormal
+( const PhiloxKey& key, Int i, Int j,
+  const F& mean, const Base<F>& stddev ) EL_NO_EXCEPT
+{
+    typedef Base<F> Real;
+    // Box-Muller yields a pair of independent normal samples
+    const auto u = counter_random::Uniforms( key, i, j );
+    const double radius = std::sqrt(-2*std::log(u.first));
+    const double angle = 2*3.14159265358979323846*u.second;
+
+    F sample;
+    if( IsComplex<F>::value )
+    {
+        const Real stddevAdj = stddev / Sqrt(Real(2));
+        SetRealPart
+        ( sample, RealPart(mean) + stddevAdj*Real(radius*std::cos(angle)) );
+        SetImagPart
+        ( sample, ImagPart(mean) + stddevAdj*Real(radius*std::sin(angle)) );
+    }
+    else
+        SetRealPart
+        ( sample, RealPart(mean) + stddev*Real(radius*std::cos(angle)) );
+    return sample;
+}
+
+template<typename F>
+F CounterSampleBall
+( const PhiloxKey& key, Int i, Int j,
+  const F& center, const Base<F>& radius ) EL_NO_EXCEPT
+{
+    typedef Base<F> Real;
+    const auto u = counter_random::Uniforms( key, i, j );
+    F sample;
+    if( IsComplex<F>::value )
+    {
+        // Mirror SampleBall by drawing the radius and angle uniformly
+        const Real r = radius*Real(u.second);
+        const double angle = 2*3.14159265358979323846*u.first;
+        SetRealPart( sample, RealPart(center) + r*Real(std::cos(angle)) );
+        SetImagPart( sample, ImagPart(center) + r*Real(std::sin(angle)) );
+    }
+    else
+        SetRealPart
+        ( sample, RealPart(center) + radius*Real(2*u.second-1) );
+    return sample;
+}
+
+template<typename T,class Sampler>
+void CounterFill( AbstractDistMatrix<T>& A, Sampler sample )
+{
+    DEBUG_ONLY(CSE cse("CounterFill"))
+    const PhiloxKey key =
+      CounterKey( CounterSeed(), NextCounterStream(A.Grid().ViewingComm()) );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+
+    // Avoid a virtual call per entry
+    vector<Int> globalRows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        T* ACol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            ACol[iLoc] = sample( key, globalRows[iLoc], j );
+    }
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
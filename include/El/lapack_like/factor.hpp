@@ -23,6 +23,11 @@ void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack=false );
 template<typename F>
 void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
+// Factors A directly in its block-cyclic distribution unless ScaLAPACK is
+// requested
+template<typename F>
+void Cholesky
+( UpperOrLower uplo, BlockMatrix<F>& A, bool scalapack=false );
 
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A );
@@ -479,6 +484,8 @@ template<typename F>
 void LU( ElementalMatrix<F>& A );
 template<typename F>
 void LU( DistMatrix<F,STAR,STAR>& A );
+template<typename F>
+void LU( BlockMatrix<F>& A );
 
 // LU with partial pivoting
 // ------------------------
@@ -486,6 +493,8 @@ template<typename F>
 void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
 void LU( ElementalMatrix<F>& A, DistPermutation& P );
+template<typename F>
+void LU( BlockMatrix<F>& A, DistPermutation& P );
 
 // LU with full pivoting
 // ---------------------
@@ -683,6 +692,12 @@ void QR
 ( ElementalMatrix<F>& A,
   ElementalMatrix<F>& t, 
   ElementalMatrix<Base<F>>& d );
+// Factors block-cyclic matrices directly with the same conventions
+template<typename F>
+void QR
+( BlockMatrix<F>& A,
+  ElementalMatrix<F>& t, 
+  ElementalMatrix<Base<F>>& d );
 // NOTE: This is a ScaLAPACK wrapper, and ScaLAPACK uses a different convention
 //       for Householder transformations (that includes identity matrices,
 //       which are not representable as Householder transformations)
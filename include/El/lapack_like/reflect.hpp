@@ -95,6 +95,9 @@ F RightReflector( ElementalMatrix<F>& chi, ElementalMatrix<F>& x );
 
 namespace reflector {
 
+// x is the local portion of a column vector distributed over colComm
+template<typename F>
+F Col( F& chi, Matrix<F>& x, mpi::Comm colComm );
 template<typename F>
 F Col( F& chi, ElementalMatrix<F>& x );
 template<typename F>
@@ -39,11 +39,10 @@ inline Int Single
 
     // A z_j and A x_0
     const bool saveProducts = true;
-    const bool time = false;
+    ProfileRegion region("FGMRES");
 
     typedef Base<F> Real;
     const Int n = b.Height();
-    Timer iterTimer;
 
     // x := 0
     // ======
@@ -117,8 +116,7 @@ inline Int Single
         {
             if( progress )
                 Output("Starting inner FGMRES iteration ",j);
-            if( time )
-                iterTimer.Start();
+            PushProfileRegion("FGMRES iteration");
             const Int innerIndent = PushIndent();
 
             // z_j := inv(M) v_j
@@ -237,8 +235,7 @@ inline Int Single
                 applyA( F(-1), x, F(1), w );
             }
 
-            if( time )
-                Output("iter took ",iterTimer.Stop()," secs");
+            PopProfileRegion();
 
             // Residual checks
             // ---------------
@@ -320,13 +317,12 @@ inline Int Single
     // Avoid half of the matrix-vector products by keeping the results of
     // A z_j and A x_0
     const bool saveProducts = true;
-    const bool time = false;
+    ProfileRegion region("FGMRES");
 
     typedef Base<F> Real;
     const Int n = b.Height();
     mpi::Comm comm = b.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer iterTimer;
 
     // x := 0
     // ======
@@ -407,8 +403,7 @@ inline Int Single
         {
             if( progress && commRank == 0 )
                 Output("Starting inner FGMRES iteration ",j);
-            if( time && commRank == 0 )
-                iterTimer.Start();
+            PushProfileRegion("FGMRES iteration");
             const Int innerIndent = PushIndent();
 
             // z_j := inv(M) v_j
@@ -531,8 +526,7 @@ inline Int Single
                 applyA( F(-1), x, F(1), w );
             }
 
-            if( time && commRank == 0 )
-                Output("iter took ",iterTimer.Stop()," secs");
+            PopProfileRegion();
 
             // Residual checks
             // ---------------
@@ -13,8 +13,6 @@ namespace El {
 
 namespace bkz {
 
-static Timer enumTimer, bkzTimer;
-
 template<typename F>
 bool TrivialCoordinates( const Matrix<F>& v )
 {
@@ -250,11 +248,8 @@ BKZInfo<Base<F>> BKZWithQ
         Output("Warning: Computation of U not yet supported for recursive BKZ");
     }
 
-    if( ctrl.time )
-    {
-        bkz::enumTimer.Reset();
-        bkz::bkzTimer.Reset();
-    }
+    ScopedProfile profile( ctrl.time, mpi::COMM_SELF );
+    ProfileRegion region("BKZWithQ");
 
     // TODO: Add optional logging
 
@@ -268,11 +263,9 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
+        PushProfileRegion("Initial LLL");
         auto lllInfo = LLLWithQ( B, U, QR, t, d, lllCtrl );
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        PopProfileRegion();
         BKZInfo<Real> info;
         info.delta = lllInfo.delta;
         info.eta = lllInfo.eta;
@@ -303,13 +296,11 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
+        PushProfileRegion("Initial LLL");
         lllInfo = LLLWithQ( B, U, QR, t, d, lllCtrl );
         if( ctrl.progress )
             Output("Initial LLL applied ",lllInfo.numSwaps," swaps");
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        PopProfileRegion();
         numSwaps = lllInfo.numSwaps;
     }
     // The zero columns should be at the end of B
@@ -366,8 +357,7 @@ BKZInfo<Base<F>> BKZWithQ
         auto BEnum = B( ALL, IR(j,k+1) );
         auto UEnum = U( ALL, IR(j,k+1) );
         auto QREnum = QR( IR(j,k+1), IR(j,k+1) );
-        if( ctrl.time )
-            bkz::enumTimer.Start();
+        PushProfileRegion("Enumeration");
         if( ctrl.variableEnumType )
             enumCtrl.enumType = ctrl.enumTypeFunc(j);
         const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
@@ -376,8 +366,7 @@ BKZInfo<Base<F>> BKZWithQ
         const auto minPair = 
           MultiShortestVectorEnrichment
           ( BEnum, UEnum, QREnum, normUpperBounds, v, enumCtrl );
-        if( ctrl.time )
-            Output("Enum/enrich time: ",bkz::enumTimer.Stop()," seconds");
+        PopProfileRegion();
         ++numEnums;
 
         const Real minProjNorm = minPair.first;
@@ -427,8 +416,7 @@ BKZInfo<Base<F>> BKZWithQ
         auto QRSub = QR( ALL, subInd );
         auto tSub = t( subInd, ALL );
         auto dSub = d( subInd, ALL );
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
+        PushProfileRegion("Sub-BKZ");
         if( ctrl.subBKZ )
         {
             BKZCtrl<Real> subCtrl( ctrl );
@@ -479,8 +467,7 @@ BKZInfo<Base<F>> BKZWithQ
         auto USub = U( ALL, subInd );
         auto USubCopy( USub );
         Gemm( NORMAL, NORMAL, F(1), USubCopy, W, USub );
-        if( ctrl.time )
-            Output("BKZ time: ",bkz::bkzTimer.Stop()," seconds");
+        PopProfileRegion();
         if( !keptMin )
         {
             if( changed )
@@ -523,12 +510,6 @@ BKZInfo<Base<F>> BKZWithQ
     if( ctrl.logNontrivialCoords )
         nontrivialCoordsFile.close();
 
-    if( ctrl.time )
-    {
-        Output("Total enumeration time: ",bkz::enumTimer.Total()," seconds");
-        Output("Total sub-BKZ time:     ",bkz::bkzTimer.Total()," seconds");
-    }
-
     BKZInfo<Real> info;
     info.delta = lllInfo.delta;
     info.eta = lllInfo.eta;
@@ -759,11 +740,8 @@ BKZInfo<Base<F>> BKZWithQ
         !ctrl.jumpstart )
         return RecursiveBKZWithQ( B, QR, t, d, ctrl );
 
-    if( ctrl.time )
-    {
-        bkz::enumTimer.Reset();
-        bkz::bkzTimer.Reset();
-    }
+    ScopedProfile profile( ctrl.time, mpi::COMM_SELF );
+    ProfileRegion region("BKZWithQ");
 
     // TODO: Add optional logging
 
@@ -777,11 +755,9 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
+        PushProfileRegion("Initial LLL");
         auto lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        PopProfileRegion();
         BKZInfo<Real> info;
         info.delta = lllInfo.delta;
         info.eta = lllInfo.eta;
@@ -811,11 +787,9 @@ BKZInfo<Base<F>> BKZWithQ
             lllCtrl.jumpstart = true;
             lllCtrl.startCol = 0;
         }
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
+        PushProfileRegion("Initial LLL");
         lllInfo = LLLWithQ( B, QR, t, d, lllCtrl );
-        if( ctrl.time )
-            Output("Initial LLL time: ",bkz::bkzTimer.Stop()," seconds");
+        PopProfileRegion();
         if( ctrl.progress )
             Output("Initial LLL applied ",lllInfo.numSwaps," swaps");
         numSwaps = lllInfo.numSwaps;
@@ -873,8 +847,7 @@ BKZInfo<Base<F>> BKZWithQ
         Matrix<F> v;
         auto BEnum = B( ALL, IR(j,k+1) );
         auto QREnum = QR( IR(j,k+1), IR(j,k+1) );
-        if( ctrl.time )
-            bkz::enumTimer.Start();
+        PushProfileRegion("Enumeration");
         if( ctrl.variableEnumType )
             enumCtrl.enumType = ctrl.enumTypeFunc(j);
         const Range<Int> windowInd = IR(j,Min(j+ctrl.multiEnumWindow,k+1));
@@ -883,8 +856,7 @@ BKZInfo<Base<F>> BKZWithQ
         const auto minPair =
           MultiShortestVectorEnrichment
           ( BEnum, QREnum, normUpperBounds, v, enumCtrl );
-        if( ctrl.time )
-            Output("Enum/enrich time: ",bkz::enumTimer.Stop()," seconds");
+        PopProfileRegion();
         ++numEnums;
 
         const Real minProjNorm = minPair.first;
@@ -931,8 +903,7 @@ BKZInfo<Base<F>> BKZWithQ
         auto QRSub = QR( ALL, subInd );
         auto tSub = t( subInd, ALL );
         auto dSub = d( subInd, ALL );
-        if( ctrl.time )
-            bkz::bkzTimer.Start();
+        PushProfileRegion("Sub-BKZ");
         if( ctrl.subBKZ )
         {
             BKZCtrl<Real> subCtrl( ctrl );
@@ -980,8 +951,7 @@ BKZInfo<Base<F>> BKZWithQ
                 changed = true;
             numSwaps += lllInfo.numSwaps;
         }
-        if( ctrl.time )
-            Output("BKZ time: ",bkz::bkzTimer.Stop()," seconds");
+        PopProfileRegion();
         if( !keptMin )
         {
             if( changed )
@@ -1025,12 +995,6 @@ BKZInfo<Base<F>> BKZWithQ
     if( ctrl.logProjNorms )
         projNormsFile.close();
 
-    if( ctrl.time )
-    {
-        Output("Total enumeration time: ",bkz::enumTimer.Total()," seconds");
-        Output("Total sub-BKZ time:     ",bkz::bkzTimer.Total()," seconds");
-    }
-
     BKZInfo<Real> info;
     info.delta = lllInfo.delta;
     info.eta = lllInfo.eta;
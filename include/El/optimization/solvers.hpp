@@ -99,7 +99,8 @@ struct MehrotraCtrl
     // Print the progress of the Interior Point Method?
     bool print=false;
 
-    // Time the components of the Interior Point Method?
+    // Profile the components of the Interior Point Method and print the
+    // resulting report (see El/core/Profile.hpp)?
     bool time=false;
 
     // A lower bound on the maximum entry in the Nesterov-Todd scaling point
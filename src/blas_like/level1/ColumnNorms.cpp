@@ -39,10 +39,8 @@ void ColumnMaxNorms( const Matrix<F>& X, Matrix<Base<F>>& norms )
     Base<F>* normBuf = norms.Buffer();
     for( Int j=0; j<n; ++j )
     {
-        Real colMax = 0;
-        for( Int i=0; i<m; ++i )
-            colMax = Max(colMax,Abs(XBuf[i+j*XLDim]));
-        normBuf[j] = colMax;
+        const Int i = simd::MaxAbsInd( m, &XBuf[j*XLDim] );
+        normBuf[j] = ( i >= 0 ? Abs(XBuf[i+j*XLDim]) : Real(0) );
     }
 }
 
@@ -102,14 +100,9 @@ void ColumnTwoNorms( const DistMultiVec<F>& X, Matrix<Base<F>>& norms )
                  localScaledSquares( width );
     for( Int j=0; j<width; ++j )
     {
-        Real localScale = 0;
-        Real localScaledSquare = 1;
-        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-            UpdateScaledSquare
-            ( XBuf[iLoc+j*XLDim], localScale, localScaledSquare );
-
-        localScales[j] = localScale;
-        localScaledSquares[j] = localScaledSquare;
+        // The local norm is used as the scale of a unit scaled square
+        localScales[j] = blas::Nrm2( localHeight, &XBuf[j*XLDim], 1 );
+        localScaledSquares[j] = 1;
     }
 
     // Find the maximum relative scales
@@ -32,8 +32,8 @@ T HilbertSchmidt( const Matrix<T>& A, const Matrix<T>& B )
     else
     {
         for( Int j=0; j<width; ++j )
-            for( Int i=0; i<height; ++i )
-                innerProd += Conj(ABuf[i+j*ALDim])*BBuf[i+j*BLDim];
+            innerProd +=
+              blas::Dot( height, &ABuf[j*ALDim], 1, &BBuf[j*BLDim], 1 );
     }
     return innerProd;
 }
@@ -71,9 +71,9 @@ T HilbertSchmidt
         else
         {
             for( Int jLoc=0; jLoc<localWidth; ++jLoc )
-                for( Int iLoc=0; iLoc<localHeight; ++iLoc )
-                    localInnerProd += Conj(ABuf[iLoc+jLoc*ALDim])*
-                                           BBuf[iLoc+jLoc*BLDim];
+                localInnerProd +=
+                  blas::Dot
+                  ( localHeight, &ABuf[jLoc*ALDim], 1, &BBuf[jLoc*BLDim], 1 );
         }
         innerProd = mpi::AllReduce( localInnerProd, A.DistComm() );
     }
@@ -36,14 +36,11 @@ ValueInt<Base<T>> VectorMaxAbsLoc( const Matrix<T>& x )
     pivot.index = 0;
     if( n == 1 )
     {
-        for( Int i=0; i<m; ++i )
+        const Int i = simd::MaxAbsInd( m, x.LockedBuffer() );
+        if( i >= 0 && Abs(x.Get(i,0)) > pivot.value )
         {
-            const Real absVal = Abs(x.Get(i,0));
-            if( absVal > pivot.value )
-            {
-                pivot.index = i;
-                pivot.value = absVal;
-            }
+            pivot.index = i;
+            pivot.value = Abs(x.Get(i,0));
         }
     }
     else
@@ -92,14 +89,11 @@ ValueInt<Base<T>> VectorMaxAbsLoc( const AbstractDistMatrix<T>& x )
             if( x.RowRank() == x.RowAlign() )
             {
                 const Int mLocal = x.LocalHeight();
-                for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+                const Int iLoc = simd::MaxAbsInd( mLocal, x.LockedBuffer() );
+                if( iLoc >= 0 && Abs(x.GetLocal(iLoc,0)) > localPivot.value )
                 {
-                    const Real absVal = Abs(x.GetLocal(iLoc,0));
-                    if( absVal > localPivot.value )
-                    {
-                        localPivot.index = x.GlobalRow(iLoc);
-                        localPivot.value = absVal;
-                    }
+                    localPivot.index = x.GlobalRow(iLoc);
+                    localPivot.value = Abs(x.GetLocal(iLoc,0));
                 }
             }
         }
@@ -146,17 +140,16 @@ Entry<Base<T>> MaxAbsLoc( const Matrix<T>& A )
     pivot.i = 0;
     pivot.j = 0;
     pivot.value = 0;
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
     for( Int j=0; j<n; ++j )
     {
-        for( Int i=0; i<m; ++i )
+        const Int i = simd::MaxAbsInd( m, &ABuf[j*ALDim] );
+        if( i >= 0 && Abs(ABuf[i+j*ALDim]) > pivot.value )
         {
-            const Real absVal = Abs(A.Get(i,j));
-            if( absVal > pivot.value )
-            {
-                pivot.i = i;
-                pivot.j = j;
-                pivot.value = absVal;
-            }
+            pivot.i = i;
+            pivot.j = j;
+            pivot.value = Abs(ABuf[i+j*ALDim]);
         }
     }
     return pivot;
@@ -189,19 +182,19 @@ Entry<Base<T>> MaxAbsLoc( const AbstractDistMatrix<T>& A )
         localPivot.value = 0;
         const Int mLocal = A.LocalHeight();
         const Int nLocal = A.LocalWidth();
+        const T* ABuf = A.LockedBuffer();
+        const Int ALDim = A.LDim();
         for( Int jLoc=0; jLoc<nLocal; ++jLoc )
         {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            const Int iLoc = simd::MaxAbsInd( mLocal, &ABuf[jLoc*ALDim] );
+            if( iLoc < 0 )
+                continue;
+            const Real value = Abs(ABuf[iLoc+jLoc*ALDim]);
+            if( value > localPivot.value )
             {
-                const Real value = Abs(A.GetLocal(iLoc,jLoc));
-                if( value > localPivot.value )
-                {
-                    const Int i = A.GlobalRow(iLoc);
-                    localPivot.i = i;
-                    localPivot.j = j;
-                    localPivot.value = value;
-                }
+                localPivot.i = A.GlobalRow(iLoc);
+                localPivot.j = A.GlobalCol(jLoc);
+                localPivot.value = value;
             }
         }
 
@@ -17,6 +17,11 @@ void Transform2x2
   T* a1, Int inc1,
   T* a2, Int inc2 )
 {
+    if( inc1 == 1 && inc2 == 1 )
+    {
+        simd::Transform2x2( n, gamma11, gamma12, gamma21, gamma22, a1, a2 );
+        return;
+    }
     T temp;
     for( Int i=0; i<n; ++i )
     {
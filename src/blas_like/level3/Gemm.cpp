@@ -8,13 +8,41 @@
 */
 #include "El.hpp"
 
+#include "./Gemm/CostModel.hpp"
+#include "./Gemm/Pipeline.hpp"
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
+#include "./Gemm/Block.hpp"
+
+namespace {
+
+El::Int gemmReplicationFactor = 0;
+
+} // anonymous namespace
 
 namespace El {
 
+Int GemmReplicationFactor() { return ::gemmReplicationFactor; }
+
+void SetGemmReplicationFactor( Int c )
+{
+    if( c < 0 )
+        LogicError("Replication factor must be non-negative");
+    ::gemmReplicationFactor = c;
+}
+
+template<typename T>
+GemmAlgorithm DefaultGemmAlgorithm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("DefaultGemmAlgorithm"))
+    return gemm::SelectAlgorithm<T>( orientA, orientB, m, n, k, g );
+}
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -94,7 +122,11 @@ void Gemm
 {
     DEBUG_ONLY(CSE cse("Gemm"))
     C *= beta;
-    if( orientA == NORMAL && orientB == NORMAL )
+    if( alg == GEMM_SUMMA_25D )
+    {
+        gemm::SUMMA25D( orientA, orientB, alpha, A, B, C );
+    }
+    else if( orientA == NORMAL && orientB == NORMAL )
     {
         if( alg == GEMM_CANNON )
             gemm::Cannon_NN( alpha, A, B, C );
@@ -129,6 +161,32 @@ void Gemm
     Gemm( orientA, orientB, alpha, A, B, T(0), C, alg );
 }
 
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BlockMatrix<T>& A,
+           const BlockMatrix<T>& B,
+  T beta,        BlockMatrix<T>& C )
+{
+    DEBUG_ONLY(CSE cse("Gemm"))
+    C *= beta;
+    gemm::SUMMA_Block( orientA, orientB, alpha, A, B, C );
+}
+
+template<typename T>
+void Gemm
+( Orientation orientA, Orientation orientB,
+  T alpha, const BlockMatrix<T>& A,
+           const BlockMatrix<T>& B,
+                 BlockMatrix<T>& C )
+{
+    DEBUG_ONLY(CSE cse("Gemm"))
+    const Int m = ( orientA==NORMAL ? A.Height() : A.Width() );
+    const Int n = ( orientB==NORMAL ? B.Width() : B.Height() );
+    Zeros( C, m, n );
+    Gemm( orientA, orientB, alpha, A, B, T(0), C );
+}
+
 template<typename T>
 void LocalGemm
 ( Orientation orientA, Orientation orientB,
@@ -255,6 +313,9 @@ void LocalGemm
 }
 
 #define PROTO(T) \
+  template GemmAlgorithm DefaultGemmAlgorithm<T> \
+  ( Orientation orientA, Orientation orientB, Int m, Int n, Int k, \
+    const Grid& g ); \
   template void Gemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const Matrix<T>& A, \
@@ -275,6 +336,16 @@ void LocalGemm
     T alpha, const ElementalMatrix<T>& A, \
              const ElementalMatrix<T>& B, \
                    ElementalMatrix<T>& C, GemmAlgorithm alg ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const BlockMatrix<T>& A, \
+             const BlockMatrix<T>& B, \
+    T beta,        BlockMatrix<T>& C ); \
+  template void Gemm \
+  ( Orientation orientA, Orientation orientB, \
+    T alpha, const BlockMatrix<T>& A, \
+             const BlockMatrix<T>& B, \
+                   BlockMatrix<T>& C ); \
   template void LocalGemm \
   ( Orientation orientA, Orientation orientB, \
     T alpha, const ElementalMatrix<T>& A, \
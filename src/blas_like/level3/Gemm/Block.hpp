@@ -0,0 +1,170 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Block-cyclic SUMMA
+// ==================
+// C[MC,MR] += alpha A[MC,MR] B[MC,MR], where the rows of A are distributed
+// exactly as those of C and the columns of B exactly as those of C. Each
+// block column of A lives within a single process column and each block row
+// of B within a single process row, so they are respectively broadcast within
+// the process rows and columns (as in PBLAS) and consecutive blocks are
+// accumulated into panels of roughly Blocksize<T>("Gemm") before each local
+// update.
+template<typename T>
+inline void
+SUMMA_NNBlock
+( T alpha,
+  const BlockMatrix<T>& A,
+  const BlockMatrix<T>& B,
+        BlockMatrix<T>& C )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA_NNBlock");
+      if( A.BlockHeight() != C.BlockHeight() ||
+          A.ColAlign() != C.ColAlign() || A.ColCut() != C.ColCut() )
+          LogicError("A's rows must be distributed like C's rows");
+      if( B.BlockWidth() != C.BlockWidth() ||
+          B.RowAlign() != C.RowAlign() || B.RowCut() != C.RowCut() )
+          LogicError("B's columns must be distributed like C's columns");
+    )
+    const Int sumDim = A.Width();
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    const Int bsize = Blocksize<T>( "Gemm", C.Grid() );
+    const int colRank = C.ColRank();
+    const int rowRank = C.RowRank();
+
+    Matrix<T> A1, B1, B1Block;
+    for( Int k=0; k<sumDim; )
+    {
+        // Each panel spans at least one block of A and of B
+        Int kEnd = k;
+        do
+        {
+            const Int nbA = BlockRemainder( kEnd, A.BlockWidth(), A.RowCut() );
+            const Int nbB = BlockRemainder( kEnd, B.BlockHeight(), B.ColCut() );
+            kEnd += Min( Min(nbA,nbB), sumDim-kEnd );
+        } while( kEnd < sumDim && kEnd-k < bsize );
+        const Int nbPanel = kEnd - k;
+
+        A1.Resize( localHeight, nbPanel, Max(localHeight,Int(1)) );
+        B1.Resize( nbPanel, localWidth );
+        for( Int s=k; s<kEnd; )
+        {
+            const Int nbA = BlockRemainder( s, A.BlockWidth(), A.RowCut() );
+            const Int nbB = BlockRemainder( s, B.BlockHeight(), B.ColCut() );
+            const Int nb = Min( Min(nbA,nbB), kEnd-s );
+
+            // A1[MC,* ] <- A(:,s:s+nb)[MC,MR]
+            const int ownerA = A.ColOwner( s );
+            if( rowRank == ownerA )
+                copy::util::InterleaveMatrix
+                ( localHeight, nb,
+                  A.LockedBuffer(0,A.LocalColOffset(s)), 1, A.LDim(),
+                  A1.Buffer(0,s-k),                      1, A1.LDim() );
+            mpi::Broadcast
+            ( A1.Buffer(0,s-k), localHeight*nb, ownerA, A.RowComm() );
+
+            // B1[* ,MR] <- B(s:s+nb,:)[MC,MR]
+            const int ownerB = B.RowOwner( s );
+            B1Block.Resize( nb, localWidth, nb );
+            if( colRank == ownerB )
+                copy::util::InterleaveMatrix
+                ( nb, localWidth,
+                  B.LockedBuffer(B.LocalRowOffset(s),0), 1, B.LDim(),
+                  B1Block.Buffer(),                      1, B1Block.LDim() );
+            mpi::Broadcast
+            ( B1Block.Buffer(), nb*localWidth, ownerB, B.ColComm() );
+            copy::util::InterleaveMatrix
+            ( nb, localWidth,
+              B1Block.LockedBuffer(), 1, B1Block.LDim(),
+              B1.Buffer(s-k,0),       1, B1.LDim() );
+
+            s += nb;
+        }
+
+        // C[MC,MR] += alpha A1[MC,* ] B1[* ,MR]
+        Gemm( NORMAL, NORMAL, alpha, A1, B1, T(1), C.Matrix() );
+        k = kEnd;
+    }
+}
+
+// Redistribute op(A) and op(B) (if necessary) so that they conform with the
+// block-cyclic distribution of C and then run SUMMA_NNBlock. At no point are
+// any of the matrices converted to an element-cyclic distribution.
+template<typename T>
+inline void
+SUMMA_Block
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const BlockMatrix<T>& APre,
+  const BlockMatrix<T>& BPre,
+        BlockMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA_Block");
+      AssertSameGrids( APre, BPre, CPre );
+      const Int mA = ( orientA==NORMAL ? APre.Height() : APre.Width() );
+      const Int kA = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+      const Int kB = ( orientB==NORMAL ? BPre.Height() : BPre.Width() );
+      const Int nB = ( orientB==NORMAL ? BPre.Width() : BPre.Height() );
+      if( mA != CPre.Height() || nB != CPre.Width() || kA != kB )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Grid& g = CPre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR,BLOCK> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true;
+    ctrlA.blockHeight = C.BlockHeight();
+    ctrlA.colAlign = C.ColAlign();
+    ctrlA.colCut = C.ColCut();
+    ctrlB.rowConstrain = true;
+    ctrlB.blockWidth = C.BlockWidth();
+    ctrlB.rowAlign = C.RowAlign();
+    ctrlB.rowCut = C.RowCut();
+
+    // Explicitly form the (conjugate-)transposes directly in the conforming
+    // distributions
+    DistMatrix<T,MC,MR,BLOCK> ATrans(g), BTrans(g);
+    const BlockMatrix<T>* AOp = &APre;
+    const BlockMatrix<T>* BOp = &BPre;
+    if( orientA != NORMAL )
+    {
+        ATrans.AlignCols( C.BlockHeight(), C.ColAlign(), C.ColCut() );
+        Transpose( APre, ATrans, orientA==ADJOINT );
+        AOp = &ATrans;
+    }
+    if( orientB != NORMAL )
+    {
+        BTrans.AlignRows( C.BlockWidth(), C.RowAlign(), C.RowCut() );
+        Transpose( BPre, BTrans, orientB==ADJOINT );
+        BOp = &BTrans;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR,BLOCK> AProx( *AOp, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR,BLOCK> BProx( *BOp, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    if( C.Participating() )
+        SUMMA_NNBlock( alpha, A, B, C );
+}
+
+} // namespace gemm
+} // namespace El
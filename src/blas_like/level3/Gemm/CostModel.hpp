@@ -0,0 +1,162 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Predictions of the per-process runtimes of the SUMMA variants under the
+// alpha-beta-gamma model returned by GetCostModel. The collectives are
+// modeled as follows for a team of q processes which each end up with (or
+// start with) N bytes:
+//
+//   AllGather/ReduceScatter: ceil(log2(q)) alpha + ((q-1)/q) N beta,
+//   AllToAll:                (q-1) alpha + ((q-1)/q) N beta.
+//
+// The redistributions of the transposed variants move the same volumes as
+// those of the normal variants, so the same predictions are used for all
+// orientations.
+
+inline double CollectiveLatency( Int q )
+{
+    double numStages = 0;
+    for( Int stride=1; stride<q; stride*=2 )
+        ++numStages;
+    return numStages;
+}
+
+inline double AllGatherCost( Int q, double numBytes )
+{
+    const CostModel& model = GetCostModel();
+    if( q == 1 )
+        return 0;
+    return CollectiveLatency(q)*model.alpha +
+           (double(q-1)/q)*numBytes*model.beta;
+}
+
+inline double ReduceScatterCost( Int q, double numBytes )
+{ return AllGatherCost( q, numBytes ); }
+
+inline double AllToAllCost( Int q, double numBytes )
+{
+    const CostModel& model = GetCostModel();
+    if( q == 1 )
+        return 0;
+    return (q-1)*model.alpha + (double(q-1)/q)*numBytes*model.beta;
+}
+
+template<typename T>
+inline double PredictedCost
+( Orientation orientA, Orientation orientB, GemmAlgorithm alg,
+  Int m, Int n, Int k, const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("gemm::PredictedCost"))
+    const double r = g.Height();
+    const double c = g.Width();
+    const double p = g.Size();
+    const double bsize = Blocksize<T>( "Gemm", g );
+    const double w = sizeof(T);
+    const double flops = ( IsComplex<T>::value ? 8. : 2. )*m*n*k;
+    const double computeCost = GetCostModel().gamma*flops/p;
+    auto numPanels = [&]( Int dim ) { return std::ceil(dim/bsize); };
+
+    // Each panel of the summation dimension is gathered within the grid rows
+    // (for A) and within the grid columns (for B)
+    const double stationaryCComm =
+      numPanels(k)*
+      (AllGatherCost( c, w*(m/r)*bsize ) + AllGatherCost( r, w*bsize*(n/c) ));
+
+    switch( alg )
+    {
+    case GEMM_SUMMA_A:
+    {
+        // Each panel of B is redistributed, gathered within the grid columns,
+        // and the product is summed within the grid rows
+        const double commCost =
+          numPanels(n)*
+          (AllToAllCost( r, w*k*bsize/p ) +
+           AllGatherCost( r, w*k*bsize/c ) +
+           ReduceScatterCost( c, w*(m/r)*bsize ));
+        return commCost + computeCost;
+    }
+    case GEMM_SUMMA_B:
+    {
+        const double commCost =
+          numPanels(m)*
+          (AllToAllCost( c, w*bsize*k/p ) +
+           AllGatherCost( c, w*bsize*k/r ) +
+           ReduceScatterCost( r, w*bsize*(n/c) ));
+        return commCost + computeCost;
+    }
+    case GEMM_SUMMA_C:
+        return stationaryCComm + computeCost;
+    case GEMM_SUMMA_C_PIPELINED:
+    {
+        // All but the first panel's communication can be hidden behind the
+        // local updates, but A and B are first aligned with C (and any
+        // transposed operand is redistributed into [MR,MC]) in full
+        const double redistCost =
+          AllToAllCost( p, w*m*k/p ) + AllToAllCost( p, w*k*n/p );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        const double firstPanel = stationaryCComm / Max(numPanels(k),1.);
+        return redistCost + firstPanel +
+               Max( stationaryCComm-firstPanel, computeCost );
+#else
+        return redistCost + stationaryCComm + computeCost;
+#endif
+    }
+    case GEMM_SUMMA_DOT:
+    {
+        if( orientA != NORMAL || orientB != NORMAL )
+            return std::numeric_limits<double>::infinity();
+        // The panels of the larger dimension are redistributed once, those of
+        // the smaller dimension once per outer panel, and each block of C is
+        // summed over the entire grid
+        const Int outerDim = Max(m,n);
+        const Int innerDim = Min(m,n);
+        const double numBlocks = numPanels(outerDim)*numPanels(innerDim);
+        const double commCost =
+          numPanels(outerDim)*AllToAllCost( p, w*bsize*k/p ) +
+          numBlocks*
+          (AllToAllCost( p, w*k*bsize/p ) +
+           ReduceScatterCost( p, w*bsize*bsize ));
+        return commCost + computeCost;
+    }
+    default:
+        return std::numeric_limits<double>::infinity();
+    }
+}
+
+// The SUMMA variant with the smallest predicted cost (ties are broken in
+// favor of the earlier variants of the list). GEMM_SUMMA_C_PIPELINED, which
+// requires twice the panel workspace, is only run when explicitly requested.
+template<typename T>
+inline GemmAlgorithm SelectAlgorithm
+( Orientation orientA, Orientation orientB, Int m, Int n, Int k,
+  const Grid& g )
+{
+    DEBUG_ONLY(CSE cse("gemm::SelectAlgorithm"))
+    const GemmAlgorithm candidates[] =
+      { GEMM_SUMMA_C, GEMM_SUMMA_A, GEMM_SUMMA_B, GEMM_SUMMA_DOT };
+    GemmAlgorithm bestAlg = GEMM_SUMMA_C;
+    double bestCost = std::numeric_limits<double>::infinity();
+    for( const GemmAlgorithm alg : candidates )
+    {
+        const double cost =
+          PredictedCost<T>( orientA, orientB, alg, m, n, k, g );
+        if( cost < bestCost )
+        {
+            bestCost = cost;
+            bestAlg = alg;
+        }
+    }
+    return bestAlg;
+}
+
+} // namespace gemm
+} // namespace El
@@ -118,7 +118,7 @@ SUMMA_NNA
            DimsString(CPre,"C"));
     )
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -173,7 +173,7 @@ SUMMA_NNB
            DimsString(CPre,"C"));
     )
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -225,7 +225,7 @@ SUMMA_NNC
            DimsString(CPre,"C"));
     )
     const Int sumDim = APre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -278,7 +278,7 @@ SUMMA_NNDot
     )
     const Int m = CPre.Height();
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -357,6 +357,80 @@ SUMMA_NNDot
     }
 }
 
+// Normal Normal Gemm that avoids communicating the matrix C and overlaps
+// the gathering of the next pair of panels with the current local update
+template<typename T>
+inline void
+SUMMA_NNCPipelined
+( T alpha,
+  const ElementalMatrix<T>& APre,
+  const ElementalMatrix<T>& BPre,
+        ElementalMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA_NNCPipelined");
+      AssertSameGrids( APre, BPre, CPre );
+      if( APre.Height() != CPre.Height() || BPre.Width() != CPre.Width() ||
+          APre.Width() != BPre.Height() )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Align A and B with C so that each panel only requires an AllGather
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions (double-buffered)
+    DistMatrix<T,MC,STAR> A1Even_MC_STAR(g), A1Odd_MC_STAR(g);
+    DistMatrix<T,STAR,MR> B1Even_STAR_MR(g), B1Odd_STAR_MR(g);
+    DistMatrix<T,MC,STAR>* A1_MC_STAR[2] = { &A1Even_MC_STAR, &A1Odd_MC_STAR };
+    DistMatrix<T,STAR,MR>* B1_STAR_MR[2] = { &B1Even_STAR_MR, &B1Odd_STAR_MR };
+    PanelAllGather<T> gatherA[2], gatherB[2];
+    for( Int slot=0; slot<2; ++slot )
+    {
+        A1_MC_STAR[slot]->AlignWith( C );
+        B1_STAR_MR[slot]->AlignWith( C );
+    }
+
+    auto startPanels = [&]( Int k, Int slot )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A( ALL,        IR(k,k+nb) );
+        auto B1 = B( IR(k,k+nb), ALL        );
+        gatherA[slot].Start( A1, *A1_MC_STAR[slot] );
+        gatherB[slot].Start( B1, *B1_STAR_MR[slot] );
+    };
+
+    if( sumDim > 0 )
+        startPanels( 0, 0 );
+    for( Int k=0, slot=0; k<sumDim; k+=bsize, slot=1-slot )
+    {
+        gatherA[slot].Finish();
+        gatherB[slot].Finish();
+        if( k+bsize < sumDim )
+            startPanels( k+bsize, 1-slot );
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        LocalGemm
+        ( NORMAL, NORMAL,
+          alpha, *A1_MC_STAR[slot], *B1_STAR_MR[slot], T(1), C );
+    }
+}
+
 template<typename T>
 inline void
 SUMMA_NN
@@ -370,25 +444,16 @@ SUMMA_NN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Width();
-    const double weightTowardsC = 2.;
-    const double weightAwayFromDot = 10.;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( NORMAL, NORMAL, m, n, sumDim, C.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( weightAwayFromDot*m <= sumDim && weightAwayFromDot*n <= sumDim )
-            SUMMA_NNDot( alpha, A, B, C );
-        else if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_NNB( alpha, A, B, C );    
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_NNA( alpha, A, B, C );
-        else
-            SUMMA_NNC( alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:   SUMMA_NNA( alpha, A, B, C ); break;
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_PIPELINED: SUMMA_NNCPipelined( alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -33,7 +33,7 @@ SUMMA_NTA
             DimsString(CPre,"C"));
     )
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
     const bool conjugate = ( orientB == ADJOINT );
 
@@ -90,7 +90,7 @@ SUMMA_NTB
            DimsString(CPre,"C"));
     )
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -149,7 +149,7 @@ SUMMA_NTC
            DimsString(CPre,"C"));
     )
     const Int sumDim = APre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
     const bool conjugate = ( orientB == ADJOINT );
 
@@ -185,6 +185,85 @@ SUMMA_NTC
     }
 }
 
+// Normal Transpose Gemm that avoids communicating the matrix C and overlaps
+// the gathering of the next pair of panels with the current local update
+template<typename T>
+inline void
+SUMMA_NTCPipelined
+( Orientation orientB,
+  T alpha,
+  const ElementalMatrix<T>& APre,
+  const ElementalMatrix<T>& BPre,
+        ElementalMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA_NTCPipelined");
+      AssertSameGrids( APre, BPre, CPre );
+      if( orientB == NORMAL )
+          LogicError("B must be (Conjugate)Transposed");
+      if( APre.Height() != CPre.Height() ||
+          BPre.Height() != CPre.Width() ||
+          APre.Width() != BPre.Width() )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Align A with C and redistribute B once into an aligned [MR,MC] so that
+    // each panel only requires an AllGather
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.colConstrain = true; ctrlB.colAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MR,MC> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions (double-buffered)
+    DistMatrix<T,MC,STAR> A1Even_MC_STAR(g), A1Odd_MC_STAR(g);
+    DistMatrix<T,MR,STAR> B1Even_MR_STAR(g), B1Odd_MR_STAR(g);
+    DistMatrix<T,MC,STAR>* A1_MC_STAR[2] = { &A1Even_MC_STAR, &A1Odd_MC_STAR };
+    DistMatrix<T,MR,STAR>* B1_MR_STAR[2] = { &B1Even_MR_STAR, &B1Odd_MR_STAR };
+    PanelAllGather<T> gatherA[2], gatherB[2];
+    for( Int slot=0; slot<2; ++slot )
+    {
+        A1_MC_STAR[slot]->AlignWith( C );
+        B1_MR_STAR[slot]->AlignCols( C.RowAlign() );
+    }
+
+    auto startPanels = [&]( Int k, Int slot )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A( ALL, IR(k,k+nb) );
+        auto B1 = B( ALL, IR(k,k+nb) );
+        gatherA[slot].Start( A1, *A1_MC_STAR[slot] );
+        gatherB[slot].Start( B1, *B1_MR_STAR[slot] );
+    };
+
+    if( sumDim > 0 )
+        startPanels( 0, 0 );
+    for( Int k=0, slot=0; k<sumDim; k+=bsize, slot=1-slot )
+    {
+        gatherA[slot].Finish();
+        gatherB[slot].Finish();
+        if( k+bsize < sumDim )
+            startPanels( k+bsize, 1-slot );
+
+        // C[MC,MR] += alpha A1[MC,*] (B1[MR,*])^{T/H}
+        LocalGemm
+        ( NORMAL, orientB,
+          alpha, *A1_MC_STAR[slot], *B1_MR_STAR[slot], T(1), C );
+    }
+}
+
 template<typename T>
 inline void
 SUMMA_NT
@@ -199,21 +278,17 @@ SUMMA_NT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = A.Width();
-    const double weightTowardsC = 2.;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( NORMAL, orientB, m, n, k, C.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( m <= n && weightTowardsC*m <= k )
-            SUMMA_NTB( orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= k )
-            SUMMA_NTA( orientB, alpha, A, B, C );
-        else
-            SUMMA_NTC( orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_NTA( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_NTCPipelined( orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// An AllGather of a panel within its row (or column) team, e.g.,
+// [MC,MR] -> [MC,* ], which is split into a non-blocking start and a
+// finish so that the next panel of a SUMMA can be communicated while the
+// current panel is multiplied. B must already be aligned with A in the
+// dimension which is not being gathered.
+//
+// NOTE: Without non-blocking collectives the AllGather is performed within
+//       Start and there is no overlap.
+template<typename T>
+class PanelAllGather
+{
+public:
+    void Start( const ElementalMatrix<T>& A, ElementalMatrix<T>& B )
+    {
+        DEBUG_ONLY(
+          CSE cse("gemm::PanelAllGather::Start");
+          AssertSameGrids( A, B );
+          if( pending_ )
+              LogicError("The previous panel was not finished");
+        )
+        const Int height = A.Height();
+        const Int width = A.Width();
+        B_ = &B;
+        rowGather_ = ( B.ColDist() == A.ColDist() );
+        DEBUG_ONLY(
+          if( rowGather_ && B.RowDist() != Collect(A.RowDist()) )
+              LogicError("Incompatible distributions");
+          if( !rowGather_ &&
+              (B.ColDist() != Collect(A.ColDist()) ||
+               B.RowDist() != A.RowDist()) )
+              LogicError("Incompatible distributions");
+        )
+        if( rowGather_ )
+            B.AlignColsAndResize( A.ColAlign(), height, width, false, false );
+        else
+            B.AlignRowsAndResize( A.RowAlign(), height, width, false, false );
+        DEBUG_ONLY(
+          if( (rowGather_ && B.ColAlign() != A.ColAlign()) ||
+              (!rowGather_ && B.RowAlign() != A.RowAlign()) )
+              LogicError("Panel was not aligned");
+        )
+        if( !A.Participating() )
+            return;
+
+        stride_ = ( rowGather_ ? A.RowStride() : A.ColStride() );
+        align_ = ( rowGather_ ? A.RowAlign() : A.ColAlign() );
+        if( stride_ == 1 )
+        {
+            Copy( A.LockedMatrix(), B.Matrix() );
+            return;
+        }
+
+        const Int localHeight = A.LocalHeight();
+        const Int localWidth = A.LocalWidth();
+        if( rowGather_ )
+            portionSize_ = mpi::Pad( localHeight*MaxLength(width,stride_) );
+        else
+            portionSize_ = mpi::Pad( MaxLength(height,stride_)*localWidth );
+        T* sendBuf = buffer_.Require( (stride_+1)*portionSize_ );
+        T* recvBuf = &sendBuf[portionSize_];
+
+        // Pack
+        copy::util::InterleaveMatrix
+        ( localHeight, localWidth,
+          A.LockedBuffer(), 1, A.LDim(),
+          sendBuf,          1, localHeight );
+
+        // Communicate
+        mpi::Comm comm = ( rowGather_ ? A.RowComm() : A.ColComm() );
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        mpi::IAllGather
+        ( sendBuf, portionSize_, recvBuf, portionSize_, comm, request_ );
+#else
+        mpi::AllGather( sendBuf, portionSize_, recvBuf, portionSize_, comm );
+#endif
+        pending_ = true;
+    }
+
+    void Finish()
+    {
+        DEBUG_ONLY(CSE cse("gemm::PanelAllGather::Finish"))
+        if( !pending_ )
+            return;
+        mpi::Wait( request_ );
+        pending_ = false;
+
+        // Unpack
+        const T* recvBuf = &buffer_.Buffer()[portionSize_];
+        if( rowGather_ )
+            copy::util::RowStridedUnpack
+            ( B_->LocalHeight(), B_->Width(), align_, stride_,
+              recvBuf,     portionSize_,
+              B_->Buffer(), B_->LDim() );
+        else
+            copy::util::ColStridedUnpack
+            ( B_->Height(), B_->LocalWidth(), align_, stride_,
+              recvBuf,     portionSize_,
+              B_->Buffer(), B_->LDim() );
+    }
+
+private:
+    ElementalMatrix<T>* B_=nullptr;
+    bool rowGather_=true, pending_=false;
+    Int stride_=1, align_=0, portionSize_=0;
+    Memory<T> buffer_;
+    mpi::Request<T> request_;
+};
+
+} // namespace gemm
+} // namespace El
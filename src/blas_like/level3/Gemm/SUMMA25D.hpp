@@ -0,0 +1,151 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// The largest c <= p^(1/3) which divides p
+inline Int DefaultReplicationFactor( Int p )
+{
+    Int c = 1;
+    for( Int d=2; d*d*d<=p; ++d )
+        if( p % d == 0 )
+            c = d;
+    return c;
+}
+
+// A 2.5D (replicated) Gemm: the p processes of the grid are split into c
+// layers of p/c processes which each form the contribution to C from 1/c
+// of the summation dimension with a 2D SUMMA, before the contributions are
+// summed across the layers. Relative to a 2D SUMMA over all p processes, the
+// bandwidth cost of each process is reduced by a factor of sqrt(c) at the
+// expense of translating A and B into the layers and reducing C.
+//
+// This was originally prototyped by Martin Schatz in experimental/g3d.
+template<typename T>
+inline void
+SUMMA25D
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const ElementalMatrix<T>& APre,
+  const ElementalMatrix<T>& BPre,
+        ElementalMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA25D");
+      AssertSameGrids( APre, BPre, CPre );
+    )
+    const Grid& g = CPre.Grid();
+    const int p = g.Size();
+    Int depth = GemmReplicationFactor();
+    if( depth == 0 )
+        depth = DefaultReplicationFactor( p );
+    if( depth == 1 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), CPre );
+        return;
+    }
+    if( depth > p || p % depth != 0 )
+        LogicError
+        ("Replication factor, ",depth,", must divide the number of processes, ",
+         p);
+    if( g.HaveViewers() )
+        LogicError("2.5D Gemm does not yet support grids with viewers");
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int sumDim = ( orientA == NORMAL ? A.Width() : A.Height() );
+    const int layerSize = p / depth;
+    const int layer = g.Rank() / layerSize;
+
+    // The grids over the layers are viewed by the entire original grid so
+    // that the slices of A and B can be translated into them
+    const Grid& layerGrid = g.LayerGrid( depth, layer );
+
+    // Translate the l'th slices of A and B into the l'th layer
+    DistMatrix<T> ALayer(layerGrid), BLayer(layerGrid);
+    for( Int l=0; l<depth; ++l )
+    {
+        const Range<Int> ind( (l*sumDim)/depth, ((l+1)*sumDim)/depth );
+        DistMatrix<T> A1(g), B1(g);
+        if( orientA == NORMAL )
+            LockedView( A1, A, ALL, ind );
+        else
+            LockedView( A1, A, ind, ALL );
+        if( orientB == NORMAL )
+            LockedView( B1, B, ind, ALL );
+        else
+            LockedView( B1, B, ALL, ind );
+
+        if( l == layer )
+        {
+            ALayer = A1;
+            BLayer = B1;
+        }
+        else
+        {
+            const Grid& otherGrid = g.LayerGrid( depth, l );
+            DistMatrix<T> AOther(otherGrid), BOther(otherGrid);
+            AOther = A1;
+            BOther = B1;
+        }
+    }
+
+    // Form this layer's contribution
+    DistMatrix<T> CLayer(layerGrid);
+    Gemm( orientA, orientB, alpha, ALayer, BLayer, CLayer );
+    ALayer.Empty();
+    BLayer.Empty();
+
+    // Sum the contributions onto the first layer. Since every layer has the
+    // same shape, each process's local data lines up with that of the
+    // processes with the same rank in the other layers.
+    mpi::Comm depthComm = g.DepthComm( depth );
+    const Int localHeight = CLayer.LocalHeight();
+    const Int localWidth = CLayer.LocalWidth();
+    if( localHeight == CLayer.LDim() )
+    {
+        mpi::Reduce( CLayer.Buffer(), localHeight*localWidth, 0, depthComm );
+    }
+    else
+    {
+        vector<T> buf;
+        FastResize( buf, localHeight*localWidth );
+        copy::util::InterleaveMatrix
+        ( localHeight, localWidth,
+          CLayer.LockedBuffer(), 1, CLayer.LDim(),
+          buf.data(),            1, localHeight );
+        mpi::Reduce( buf.data(), localHeight*localWidth, 0, depthComm );
+        copy::util::InterleaveMatrix
+        ( localHeight, localWidth,
+          buf.data(),      1, localHeight,
+          CLayer.Buffer(), 1, CLayer.LDim() );
+    }
+
+    // Translate the sum back into the original grid and update C
+    DistMatrix<T> CFirst(g.LayerGrid(depth,0)), CSum(g);
+    if( layer == 0 )
+        LockedView( CFirst, CLayer );
+    else
+        CFirst.Resize( m, n );
+    CSum.AlignWith( C );
+    CSum = CFirst;
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
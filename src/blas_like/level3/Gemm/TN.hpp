@@ -33,7 +33,7 @@ SUMMA_TNA
            DimsString(CPre,"C"));
     )
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -91,7 +91,7 @@ SUMMA_TNB
            DimsString(CPre,"C"));
     )
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
     const bool conjugate = ( orientA == ADJOINT );
 
@@ -146,7 +146,7 @@ SUMMA_TNC
            DimsString(CPre,"C"));
     )
     const Int sumDim = BPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -178,6 +178,84 @@ SUMMA_TNC
     }
 }
 
+// Transpose Normal Gemm that avoids communicating the matrix C and overlaps
+// the gathering of the next pair of panels with the current local update
+template<typename T>
+inline void
+SUMMA_TNCPipelined
+( Orientation orientA,
+  T alpha,
+  const ElementalMatrix<T>& APre,
+  const ElementalMatrix<T>& BPre,
+        ElementalMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA_TNCPipelined");
+      AssertSameGrids( APre, BPre, CPre );
+      if( orientA == NORMAL )
+          LogicError("A must be (Conjugate)Transposed");
+      if( APre.Width() != CPre.Height() || BPre.Width() != CPre.Width() ||
+          APre.Height() != BPre.Height() )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Int sumDim = BPre.Height();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Redistribute A once into an aligned [MR,MC] and align B with C so that
+    // each panel only requires an AllGather
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.rowConstrain = true; ctrlA.rowAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MR,MC> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions (double-buffered)
+    DistMatrix<T,STAR,MC> A1Even_STAR_MC(g), A1Odd_STAR_MC(g);
+    DistMatrix<T,STAR,MR> B1Even_STAR_MR(g), B1Odd_STAR_MR(g);
+    DistMatrix<T,STAR,MC>* A1_STAR_MC[2] = { &A1Even_STAR_MC, &A1Odd_STAR_MC };
+    DistMatrix<T,STAR,MR>* B1_STAR_MR[2] = { &B1Even_STAR_MR, &B1Odd_STAR_MR };
+    PanelAllGather<T> gatherA[2], gatherB[2];
+    for( Int slot=0; slot<2; ++slot )
+    {
+        A1_STAR_MC[slot]->AlignRows( C.ColAlign() );
+        B1_STAR_MR[slot]->AlignWith( C );
+    }
+
+    auto startPanels = [&]( Int k, Int slot )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A( IR(k,k+nb), ALL );
+        auto B1 = B( IR(k,k+nb), ALL );
+        gatherA[slot].Start( A1, *A1_STAR_MC[slot] );
+        gatherB[slot].Start( B1, *B1_STAR_MR[slot] );
+    };
+
+    if( sumDim > 0 )
+        startPanels( 0, 0 );
+    for( Int k=0, slot=0; k<sumDim; k+=bsize, slot=1-slot )
+    {
+        gatherA[slot].Finish();
+        gatherB[slot].Finish();
+        if( k+bsize < sumDim )
+            startPanels( k+bsize, 1-slot );
+
+        // C[MC,MR] += alpha (A1[*,MC])^{T/H} B1[*,MR]
+        LocalGemm
+        ( orientA, NORMAL,
+          alpha, *A1_STAR_MC[slot], *B1_STAR_MR[slot], T(1), C );
+    }
+}
+
 template<typename T>
 inline void
 SUMMA_TN
@@ -192,21 +270,17 @@ SUMMA_TN
     const Int m = C.Height();
     const Int n = C.Width();
     const Int k = A.Height();
-    const double weightTowardsC = 2.;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( orientA, NORMAL, m, n, k, C.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( m <= n && weightTowardsC*m <= k )
-            SUMMA_TNB( orientA, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= k )
-            SUMMA_TNA( orientA, alpha, A, B, C );
-        else
-            SUMMA_TNC( orientA, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A: SUMMA_TNA( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_TNCPipelined( orientA, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -34,7 +34,7 @@ SUMMA_TTA
            DimsString(CPre,"C"));
     )
     const Int n = CPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
 
     DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
@@ -94,7 +94,7 @@ SUMMA_TTB
            DimsString(CPre,"C"));
     )
     const Int m = CPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
     const bool conjugateA = ( orientA == ADJOINT ); 
 
@@ -157,7 +157,7 @@ SUMMA_TTC
            DimsString(CPre,"C"));
     )
     const Int sumDim = APre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
     const Grid& g = APre.Grid();
     const bool conjugateB = ( orientB == ADJOINT );
 
@@ -194,6 +194,86 @@ SUMMA_TTC
     }
 }
 
+// Transpose Transpose Gemm that avoids communicating the matrix C and
+// overlaps the gathering of the next pair of panels with the current local
+// update
+template<typename T>
+inline void
+SUMMA_TTCPipelined
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const ElementalMatrix<T>& APre,
+  const ElementalMatrix<T>& BPre,
+        ElementalMatrix<T>& CPre )
+{
+    DEBUG_ONLY(
+      CSE cse("gemm::SUMMA_TTCPipelined");
+      AssertSameGrids( APre, BPre, CPre );
+      if( orientA == NORMAL || orientB == NORMAL )
+          LogicError("A and B must be (Conjugate)Transposed");
+      if( APre.Width() != CPre.Height() || BPre.Height() != CPre.Width() ||
+          APre.Height() != BPre.Width() )
+          LogicError
+          ("Nonconformal matrices:\n",
+           DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
+           DimsString(CPre,"C"));
+    )
+    const Int sumDim = APre.Height();
+    const Int bsize = Blocksize<T>( "Gemm", APre.Grid() );
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    // Redistribute A and B once into aligned [MR,MC] matrices so that each
+    // panel only requires an AllGather
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.rowConstrain = true; ctrlA.rowAlign = C.ColAlign();
+    ctrlB.colConstrain = true; ctrlB.colAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MR,MC> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MR,MC> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    // Temporary distributions (double-buffered)
+    DistMatrix<T,STAR,MC> A1Even_STAR_MC(g), A1Odd_STAR_MC(g);
+    DistMatrix<T,MR,STAR> B1Even_MR_STAR(g), B1Odd_MR_STAR(g);
+    DistMatrix<T,STAR,MC>* A1_STAR_MC[2] = { &A1Even_STAR_MC, &A1Odd_STAR_MC };
+    DistMatrix<T,MR,STAR>* B1_MR_STAR[2] = { &B1Even_MR_STAR, &B1Odd_MR_STAR };
+    PanelAllGather<T> gatherA[2], gatherB[2];
+    for( Int slot=0; slot<2; ++slot )
+    {
+        A1_STAR_MC[slot]->AlignRows( C.ColAlign() );
+        B1_MR_STAR[slot]->AlignCols( C.RowAlign() );
+    }
+
+    auto startPanels = [&]( Int k, Int slot )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        auto A1 = A( IR(k,k+nb), ALL        );
+        auto B1 = B( ALL,        IR(k,k+nb) );
+        gatherA[slot].Start( A1, *A1_STAR_MC[slot] );
+        gatherB[slot].Start( B1, *B1_MR_STAR[slot] );
+    };
+
+    if( sumDim > 0 )
+        startPanels( 0, 0 );
+    for( Int k=0, slot=0; k<sumDim; k+=bsize, slot=1-slot )
+    {
+        gatherA[slot].Finish();
+        gatherB[slot].Finish();
+        if( k+bsize < sumDim )
+            startPanels( k+bsize, 1-slot );
+
+        // C[MC,MR] += alpha (A1[*,MC])^{T/H} (B1[MR,*])^{T/H}
+        LocalGemm
+        ( orientA, orientB,
+          alpha, *A1_STAR_MC[slot], *B1_MR_STAR[slot], T(1), C );
+    }
+}
+
 template<typename T>
 inline void
 SUMMA_TT
@@ -209,18 +289,11 @@ SUMMA_TT
     const Int m = C.Height();
     const Int n = C.Width();
     const Int sumDim = A.Height();
-    const double weightTowardsC = 2.;
 
+    if( alg == GEMM_DEFAULT )
+        alg = SelectAlgorithm<T>( orientA, orientB, m, n, sumDim, C.Grid() );
     switch( alg )
     {
-    case GEMM_DEFAULT:
-        if( m <= n && weightTowardsC*m <= sumDim )
-            SUMMA_TTB( orientA, orientB, alpha, A, B, C );
-        else if( n <= m && weightTowardsC*n <= sumDim )
-            SUMMA_TTA( orientA, orientB, alpha, A, B, C );
-        else
-            SUMMA_TTC( orientA, orientB, alpha, A, B, C );
-        break;
     case GEMM_SUMMA_A:
         SUMMA_TTA( orientA, orientB, alpha, A, B, C );
         break;
@@ -230,6 +303,9 @@ SUMMA_TT
     case GEMM_SUMMA_C:
         SUMMA_TTC( orientA, orientB, alpha, A, B, C );
         break;
+    case GEMM_SUMMA_C_PIPELINED:
+        SUMMA_TTCPipelined( orientA, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
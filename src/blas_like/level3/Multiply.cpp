@@ -569,17 +569,12 @@ void Multiply
           LogicError("Communicators did not match");
     )
 
-    const bool time = false;
+    ProfileRegion region("Multiply");
 
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm );
     // TODO: Use sequential implementation if commSize = 1?
 
-    Timer totalTimer, timer;
-    if( time && commRank == 0 )
-        totalTimer.Start();
-
     // Y := beta Y
     Y *= beta;
 
@@ -587,11 +582,12 @@ void Multiply
     const auto& meta = A.multMeta;
 
     // Convert the sizes and offsets to be compatible with the current width
+    // (which requires Int, rather than int, for wide X)
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
+    vector<Int> recvSizes( meta.recvSizes.begin(), meta.recvSizes.end() ),
+                recvOffs( meta.recvOffs.begin(), meta.recvOffs.end() ),
+                sendSizes( meta.sendSizes.begin(), meta.sendSizes.end() ),
+                sendOffs( meta.sendOffs.begin(), meta.sendOffs.end() );
     for( int q=0; q<commSize; ++q )
     {
         recvSizes[q] *= b;    
@@ -629,8 +625,7 @@ void Multiply
           recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
      
         // Perform the local multiply-accumulate, y := alpha A x + y
-        if( time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("MultiplyCSRInterX");
         MultiplyCSRInterX
         ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
           alpha, A.LockedOffsetBuffer(), 
@@ -638,8 +633,7 @@ void Multiply
                  A.LockedValueBuffer(),
                  recvVals.data(), 
           T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+        PopProfileRegion();
     }
     else
     {
@@ -649,8 +643,7 @@ void Multiply
             LogicError("The height of A must match the height of X");
 
         // Form and pack the updates to Y
-        if( time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("MultiplyCSRInterY");
         vector<T> sendVals( meta.numRecvInds*b, 0 );
         MultiplyCSRInterY
         ( orientation, A.LocalHeight(), meta.numRecvInds, b,
@@ -659,8 +652,7 @@ void Multiply
                  A.LockedValueBuffer(),
                  X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
           T(1),  sendVals.data() );
-        if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
+        PopProfileRegion();
 
         // Inject the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
@@ -682,8 +674,6 @@ void Multiply
                 YBuffer[iLoc+t*ldY] += recvVals[s*b+t];
         }
     }
-    if( time && commRank == 0 )
-        Output("Multiply total time: ",totalTimer.Stop());
 }
 
 #define PROTO(T) \
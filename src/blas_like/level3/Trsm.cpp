@@ -16,6 +16,7 @@
 #include "./Trsm/RLT.hpp"
 #include "./Trsm/RUN.hpp"
 #include "./Trsm/RUT.hpp"
+#include "./Trsm/Block.hpp"
 
 namespace El {
 
@@ -372,6 +373,37 @@ void Trsm
     }
 }
 
+template<typename F>
+void Trsm
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  F alpha,
+  const BlockMatrix<F>& A,
+        BlockMatrix<F>& B,
+  bool checkIfSingular )
+{
+    DEBUG_ONLY(
+      CSE cse("Trsm");
+      AssertSameGrids( A, B );
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( side == LEFT )
+      {
+          if( A.Height() != B.Height() )
+              LogicError("Nonconformal Trsm");
+      }
+      else
+      {
+          if( A.Height() != B.Width() )
+              LogicError("Nonconformal Trsm");
+      }
+    )
+    B *= alpha;
+    trsm::Block( side, uplo, orientation, diag, A, B, checkIfSingular );
+}
+
 template<typename F>
 void LocalTrsm
 ( LeftOrRight side,
@@ -415,6 +447,15 @@ void LocalTrsm
           AbstractDistMatrix<F>& B, \
     bool checkIfSingular, \
     TrsmAlgorithm alg ); \
+  template void Trsm \
+  ( LeftOrRight side, \
+    UpperOrLower uplo, \
+    Orientation orientation, \
+    UnitOrNonUnit diag, \
+    F alpha, \
+    const BlockMatrix<F>& A, \
+          BlockMatrix<F>& B, \
+    bool checkIfSingular ); \
   template void LocalTrsm \
   ( LeftOrRight side, \
     UpperOrLower uplo, \
@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace trsm {
+
+// Left (Lower or Upper) NORMAL (Non)Unit Trsm over block-cyclic distributions
+//   X := tril(L)^-1 X, X := trilu(L)^-1 X, X := triu(U)^-1 X, or
+//   X := triuu(U)^-1 X,
+// where the triangular matrix has square blocks and its rows are distributed
+// exactly as those of X. Each diagonal block is broadcast within the process
+// row which owns the matching block row of X, the solved block row is then
+// broadcast within the process columns, and the rest of the block column of
+// the triangular matrix within the process rows before a local update.
+template<typename F>
+inline void
+LNBlock
+( UpperOrLower uplo,
+  UnitOrNonUnit diag,
+  const BlockMatrix<F>& A,
+        BlockMatrix<F>& X,
+  bool checkIfSingular )
+{
+    DEBUG_ONLY(
+      CSE cse("trsm::LNBlock");
+      if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+          LogicError("A must have square diagonal blocks");
+      if( A.BlockHeight() != X.BlockHeight() ||
+          A.ColAlign() != X.ColAlign() || A.ColCut() != X.ColCut() )
+          LogicError("X's rows must be distributed like A's rows");
+    )
+    const Int m = X.Height();
+    const Int localHeight = X.LocalHeight();
+    const Int localWidth = X.LocalWidth();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    const int colRank = A.ColRank();
+    const int rowRank = A.RowRank();
+    auto& XLoc = X.Matrix();
+
+    // The first indices of the diagonal blocks in their order of elimination
+    vector<Int> starts;
+    for( Int k=0; k<m; k+=BlockRemainder(k,bsize,cut) )
+        starts.push_back( k );
+    if( uplo == UPPER )
+        std::reverse( starts.begin(), starts.end() );
+
+    // Each diagonal block only reaches a single process row, so the pivots
+    // are checked up front in order for every process to throw
+    if( checkIfSingular && diag != UNIT )
+    {
+        int singular = 0;
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = A.GlobalCol( jLoc );
+            if( A.RowOwner(j) == colRank &&
+                A.GetLocal(A.LocalRowOffset(j),jLoc) == F(0) )
+                singular = 1;
+        }
+        if( mpi::AllReduce( singular, mpi::MAX, A.Grid().VCComm() ) )
+            throw SingularMatrixException();
+    }
+
+    Matrix<F> A11, A21, X1;
+    for( const Int k : starts )
+    {
+        const Int nb = Min( BlockRemainder(k,bsize,cut), m-k );
+        const int ownerRow = A.RowOwner( k );
+        const int ownerCol = A.ColOwner( k );
+        const Int iLoc1 = A.LocalRowOffset( k );
+        // The local rows of X which have yet to be solved for
+        const Int iLocBeg = ( uplo==LOWER ? A.LocalRowOffset(k+nb) : 0 );
+        const Int iLocEnd = ( uplo==LOWER ? localHeight : iLoc1 );
+        const Int localHeight2 = iLocEnd - iLocBeg;
+
+        // X1[MC,MR] := A11^-1[* ,* ] X1[MC,MR] within the owning process row
+        if( colRank == ownerRow )
+        {
+            A11.Resize( nb, nb, nb );
+            if( rowRank == ownerCol )
+                copy::util::InterleaveMatrix
+                ( nb, nb,
+                  A.LockedBuffer(iLoc1,A.LocalColOffset(k)), 1, A.LDim(),
+                  A11.Buffer(),                              1, nb );
+            mpi::Broadcast( A11.Buffer(), nb*nb, ownerCol, A.RowComm() );
+            auto X1Loc = XLoc( IR(iLoc1,iLoc1+nb), ALL );
+            Trsm( LEFT, uplo, NORMAL, diag, F(1), A11, X1Loc );
+        }
+
+        // X1[* ,MR] <- X1[MC,MR]
+        X1.Resize( nb, localWidth, nb );
+        if( colRank == ownerRow )
+            copy::util::InterleaveMatrix
+            ( nb, localWidth,
+              X.LockedBuffer(iLoc1,0), 1, X.LDim(),
+              X1.Buffer(),             1, nb );
+        mpi::Broadcast( X1.Buffer(), nb*localWidth, ownerRow, X.ColComm() );
+
+        // A21[MC,* ] <- A21[MC,MR] (or A01[MC,* ] <- A01[MC,MR])
+        A21.Resize( localHeight2, nb, Max(localHeight2,Int(1)) );
+        if( rowRank == ownerCol )
+            copy::util::InterleaveMatrix
+            ( localHeight2, nb,
+              A.LockedBuffer(iLocBeg,A.LocalColOffset(k)), 1, A.LDim(),
+              A21.Buffer(),                                1, A21.LDim() );
+        mpi::Broadcast( A21.Buffer(), localHeight2*nb, ownerCol, A.RowComm() );
+
+        // X2[MC,MR] -= A21[MC,* ] X1[* ,MR]
+        auto X2Loc = XLoc( IR(iLocBeg,iLocEnd), ALL );
+        Gemm( NORMAL, NORMAL, F(-1), A21, X1, F(1), X2Loc );
+    }
+}
+
+// Reduce to a left-sided solve against an explicitly formed (and conforming)
+// op(A). Right-sided solves, X op(A) = B, are transposed into
+// op(A)^T X^T = B^T. No element-cyclic proxies are formed.
+template<typename F>
+inline void
+Block
+( LeftOrRight side,
+  UpperOrLower uplo,
+  Orientation orientation,
+  UnitOrNonUnit diag,
+  const BlockMatrix<F>& APre,
+        BlockMatrix<F>& BPre,
+  bool checkIfSingular )
+{
+    DEBUG_ONLY(CSE cse("trsm::Block"))
+    const Grid& g = APre.Grid();
+
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> BProx( BPre );
+    auto& B = BProx.Get();
+
+    DistMatrix<F,MC,MR,BLOCK> BTrans(g);
+    BlockMatrix<F>* X = &B;
+    if( side == RIGHT )
+    {
+        Transpose( B, BTrans );
+        X = &BTrans;
+    }
+    const Int bsize = X->BlockHeight();
+    const Int cut = X->ColCut();
+
+    // op(A) (or op(A)^T for right-sided solves) with square blocks and its
+    // rows distributed like those of X
+    const bool transposeA =
+      ( side == LEFT ? orientation != NORMAL : orientation == NORMAL );
+    const bool conjugateA = ( orientation == ADJOINT );
+    DistMatrix<F,MC,MR,BLOCK> AOp(g);
+    const BlockMatrix<F>* AOpPtr = &APre;
+    if( transposeA || conjugateA )
+    {
+        AOp.Align( bsize, bsize, X->ColAlign(), 0, cut, cut );
+        if( transposeA )
+            Transpose( APre, AOp, conjugateA );
+        else
+        {
+            Copy( APre, AOp );
+            Conjugate( AOp );
+        }
+        AOpPtr = &AOp;
+    }
+    const UpperOrLower uploOp =
+      ( transposeA ? (uplo==LOWER ? UPPER : LOWER) : uplo );
+
+    ProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    ctrl.blockHeight = bsize;
+    ctrl.blockWidth = bsize;
+    ctrl.colAlign = X->ColAlign();
+    if( AOpPtr->ColDist() == MC && AOpPtr->RowDist() == MR )
+        ctrl.rowAlign = AOpPtr->RowAlign();
+    ctrl.colCut = cut;
+    ctrl.rowCut = cut;
+    DistMatrixReadProxy<F,F,MC,MR,BLOCK> AProx( *AOpPtr, ctrl );
+    auto& A = AProx.GetLocked();
+
+    if( X->Participating() )
+        LNBlock( uploOp, diag, A, *X, checkIfSingular );
+    if( side == RIGHT )
+        Transpose( BTrans, B );
+}
+
+} // namespace trsm
+} // namespace El
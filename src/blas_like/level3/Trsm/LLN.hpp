@@ -25,7 +25,7 @@ LLNLarge
 {
     DEBUG_ONLY(CSE cse("trsm::LLNLarge"))
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -81,7 +81,7 @@ LLNMedium
 {
     DEBUG_ONLY(CSE cse("trsm::LLNMedium"))
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -140,7 +140,7 @@ LLNSmall
           LogicError("L and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", L.Grid() );
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
@@ -32,7 +32,7 @@ LLTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -96,7 +96,7 @@ LLTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -167,7 +167,7 @@ LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", L.Grid() );
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
@@ -221,7 +221,7 @@ LLTSmall
           LogicError("L and X must be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", L.Grid() );
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
@@ -24,7 +24,7 @@ LUNLarge
 {
     DEBUG_ONLY(CSE cse("trsm::LUNLarge"))
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -80,7 +80,7 @@ LUNMedium
 {
     DEBUG_ONLY(CSE cse("trsm::LUNMedium"))
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -144,7 +144,7 @@ LUNSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", U.Grid() );
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
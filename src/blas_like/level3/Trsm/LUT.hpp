@@ -32,7 +32,7 @@ LUTLarge
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -95,7 +95,7 @@ LUTMedium
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int m = XPre.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -165,7 +165,7 @@ LUTSmall
           LogicError("U and X are assumed to be aligned");
     )
     const Int m = X.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", U.Grid() );
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
@@ -26,7 +26,7 @@ RLN
 {
     DEBUG_ONLY(CSE cse("trsm::RLN"))
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
@@ -30,7 +30,7 @@ RLT
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", LPre.Grid() );
     const Grid& g = LPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> LProx( LPre );
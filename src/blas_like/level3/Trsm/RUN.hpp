@@ -23,7 +23,7 @@ RUN
 {
     DEBUG_ONLY(CSE cse("trsm::RUN"))
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
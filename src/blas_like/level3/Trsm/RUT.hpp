@@ -30,7 +30,7 @@ RUT
           LogicError("Expected (Conjugate)Transpose option");
     )
     const Int n = XPre.Width();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Trsm", UPre.Grid() );
     const Grid& g = UPre.Grid();
 
     DistMatrixReadProxy<F,F,MC,MR> UProx( UPre );
@@ -80,10 +80,16 @@ DistGraph::DistGraph( const DistGraph& graph )
     )
 }
 
+DistGraph::DistGraph( DistGraph&& graph )
+: numSources_(0), numTargets_(0), comm_(mpi::COMM_SELF),
+  commSize_(1), commRank_(0), blocksize_(1), numLocalSources_(0),
+  localSourceOffsets_(1,0)
+{ *this = std::move(graph); }
+
 DistGraph::~DistGraph()
 { 
     if( !mpi::Finalized() )
-        if( comm_ != mpi::COMM_WORLD )
+        if( comm_ != mpi::COMM_WORLD && comm_ != mpi::COMM_SELF )
             mpi::Free( comm_ );
 } 
 
@@ -106,6 +112,39 @@ const DistGraph& DistGraph::operator=( const DistGraph& graph )
     return *this;
 }
 
+// Move assignment
+// ---------------
+DistGraph& DistGraph::operator=( DistGraph&& graph )
+{
+    DEBUG_ONLY(CSE cse("DistGraph::operator=( DistGraph&& )"))
+    if( &graph == this )
+        return *this;
+
+    // Exchanging the communicators avoids freeing and duplicating them
+    std::swap( comm_, graph.comm_ );
+    std::swap( commSize_, graph.commSize_ );
+    std::swap( commRank_, graph.commRank_ );
+
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    blocksize_ = graph.blocksize_;
+    numLocalSources_ = graph.numLocalSources_;
+    frozenSparsity_ = graph.frozenSparsity_;
+    locallyConsistent_ = graph.locallyConsistent_;
+    sources_ = std::move(graph.sources_);
+    targets_ = std::move(graph.targets_);
+    markedForRemoval_ = std::move(graph.markedForRemoval_);
+    remoteSources_ = std::move(graph.remoteSources_);
+    remoteTargets_ = std::move(graph.remoteTargets_);
+    remoteRemovals_ = std::move(graph.remoteRemovals_);
+    localSourceOffsets_ = std::move(graph.localSourceOffsets_);
+
+    graph.Empty();
+    graph.markedForRemoval_.clear();
+    SwapClear( graph.remoteRemovals_ );
+    return *this;
+}
+
 // Make a copy of a contiguous subgraph
 // ------------------------------------
 DistGraph DistGraph::operator()( Range<Int> I, Range<Int> J ) const
@@ -215,7 +254,7 @@ void DistGraph::SetComm( mpi::Comm comm )
     if( comm == comm_ )
         return;
 
-    if( comm_ != mpi::COMM_WORLD )
+    if( comm_ != mpi::COMM_WORLD && comm_ != mpi::COMM_SELF )
         mpi::Free( comm_ );
     if( comm == mpi::COMM_WORLD )
         comm_ = comm;
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+template<typename T>
+RemoteAccumulator<T>::RemoteAccumulator
+( AbstractDistMatrix<T>& A, Int capacity )
+: A_(&A), capacity_(capacity)
+{
+    DEBUG_ONLY(
+      CSE cse("RemoteAccumulator::RemoteAccumulator");
+      A.AssertNotLocked();
+    )
+    if( capacity < 1 || capacity > mpi::MaxCount() )
+        LogicError("Invalid capacity of ",capacity);
+#ifdef EL_HAVE_MPI3_RMA
+    const Grid& g = A.Grid();
+    comm_ = g.ViewingComm();
+    const int commSize = mpi::Size( comm_ );
+    const bool partic = A.Participating();
+    const Int localSize = ( partic ? A.LDim()*A.LocalWidth() : 0 );
+    mpi::WindowCreate
+    ( partic ? A.Buffer() : (T*)0, localSize, comm_, window_ );
+    const Int ldim = ( partic ? A.LDim() : 0 );
+    ldims_.resize( commSize );
+    mpi::AllGather( &ldim, 1, ldims_.data(), 1, comm_ );
+    pending_.resize( commSize );
+    mpi::WindowLockAll( window_ );
+#endif
+}
+
+template<typename T>
+RemoteAccumulator<T>::~RemoteAccumulator()
+{
+    if( Open() )
+    {
+        try { Close(); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+}
+
+template<typename T>
+bool RemoteAccumulator<T>::Open() const { return A_ != nullptr; }
+
+template<typename T>
+void RemoteAccumulator<T>::QueueUpdate( const Entry<T>& entry )
+{
+    DEBUG_ONLY(
+      CSE cse("RemoteAccumulator::QueueUpdate");
+      if( !Open() )
+          LogicError("The accumulator was already closed");
+      A_->AssertValidEntry( entry.i, entry.j );
+    )
+#ifdef EL_HAVE_MPI3_RMA
+    const Grid& g = A_->Grid();
+    const int rowOwner = A_->RowOwner( entry.i );
+    const int colOwner = A_->ColOwner( entry.j );
+    const Int iLoc = A_->LocalRow( entry.i, rowOwner );
+    const Int jLoc = A_->LocalCol( entry.j, colOwner );
+    const int distOwner = rowOwner + colOwner*A_->ColStride();
+
+    // Every redundant copy of the entry is updated
+    const int redundantSize = A_->RedundantSize();
+    for( int r=0; r<redundantSize; ++r )
+    {
+        const int vcOwner =
+          g.CoordsToVC
+          ( A_->ColDist(), A_->RowDist(), distOwner, A_->Root(), r );
+        const int target = g.VCToViewing( vcOwner );
+        auto& pending = pending_[target];
+        pending.push_back( ValueInt<T>{entry.value,iLoc+jLoc*ldims_[target]} );
+        if( Int(pending.size()) >= capacity_ )
+            Send( target );
+    }
+#else
+    A_->QueueUpdate( entry );
+#endif
+}
+
+template<typename T>
+void RemoteAccumulator<T>::QueueUpdate( Int i, Int j, T value )
+{ QueueUpdate( Entry<T>{i,j,value} ); }
+
+#ifdef EL_HAVE_MPI3_RMA
+template<typename T>
+void RemoteAccumulator<T>::Send( int target )
+{
+    DEBUG_ONLY(CSE cse("RemoteAccumulator::Send"))
+    auto& pending = pending_[target];
+    if( pending.empty() )
+        return;
+
+    // Combine the updates to the same entry
+    std::sort
+    ( pending.begin(), pending.end(),
+      []( const ValueInt<T>& a, const ValueInt<T>& b )
+      { return a.index < b.index; } );
+    sendOffsets_.resize( 0 );
+    sendValues_.resize( 0 );
+    for( const auto& update : pending )
+    {
+        if( !sendOffsets_.empty() && sendOffsets_.back() == update.index )
+        {
+            sendValues_.back() += update.value;
+        }
+        else
+        {
+            sendOffsets_.push_back( update.index );
+            sendValues_.push_back( update.value );
+        }
+    }
+    pending.resize( 0 );
+
+    mpi::Accumulate
+    ( sendValues_.data(), sendOffsets_.data(), sendValues_.size(), target,
+      window_ );
+    // Wait until the send buffers may be reused (but not for the target)
+    mpi::WindowFlushLocal( target, window_ );
+}
+#endif
+
+template<typename T>
+void RemoteAccumulator<T>::Flush()
+{
+    DEBUG_ONLY(CSE cse("RemoteAccumulator::Flush"))
+    if( !Open() )
+        return;
+#ifdef EL_HAVE_MPI3_RMA
+    const int commSize = pending_.size();
+    for( int q=0; q<commSize; ++q )
+        Send( q );
+    mpi::WindowFlushAll( window_ );
+#endif
+}
+
+template<typename T>
+void RemoteAccumulator<T>::Fence()
+{
+    DEBUG_ONLY(CSE cse("RemoteAccumulator::Fence"))
+    if( !Open() )
+        return;
+#ifdef EL_HAVE_MPI3_RMA
+    Flush();
+    // Once every process has flushed, the local buffer is up to date
+    mpi::WindowSync( window_ );
+    mpi::Barrier( comm_ );
+    mpi::WindowSync( window_ );
+#else
+    A_->ProcessQueues();
+#endif
+}
+
+template<typename T>
+void RemoteAccumulator<T>::Close()
+{
+    DEBUG_ONLY(CSE cse("RemoteAccumulator::Close"))
+    if( !Open() )
+        return;
+    Fence();
+#ifdef EL_HAVE_MPI3_RMA
+    mpi::WindowUnlockAll( window_ );
+    mpi::WindowFree( window_ );
+    SwapClear( pending_ );
+    SwapClear( sendOffsets_ );
+    SwapClear( sendValues_ );
+#endif
+    A_ = nullptr;
+}
+
+// The one-sided accumulations are restricted to the predefined datatypes
+#define PROTO(T) template class RemoteAccumulator<T>;
+
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+template<typename T>
+SharedReplica<T>::SharedReplica( const El::Grid& g )
+: grid_(&g), view_(g)
+{
+    DEBUG_ONLY(CSE cse("SharedReplica::SharedReplica"))
+#ifdef EL_HAVE_MPI3_RMA
+    nodeComm_ = mpi::COMM_NULL;
+    leaderComm_ = mpi::COMM_NULL;
+    if( !g.InGrid() )
+        return;
+
+    const int vcRank = g.VCRank();
+    mpi::SplitShared( g.VCComm(), vcRank, nodeComm_ );
+    const int nodeRank = mpi::Rank( nodeComm_ );
+    mpi::Split
+    ( g.VCComm(), nodeRank==0 ? 0 : mpi::UNDEFINED, vcRank, leaderComm_ );
+    int node = ( nodeRank == 0 ? mpi::Rank(leaderComm_) : 0 );
+    mpi::Broadcast( node, 0, nodeComm_ );
+
+    const int p = g.Size();
+    nodes_.resize( p );
+    mpi::AllGather( &node, 1, nodes_.data(), 1, g.VCComm() );
+    for( int q=1; q<p; ++q )
+        if( nodes_[q] != nodes_[q-1] && nodes_[q] != nodes_[q-1]+1 )
+            contiguous_ = false;
+#endif
+}
+
+template<typename T>
+SharedReplica<T>::SharedReplica( const AbstractDistMatrix<T>& A )
+: SharedReplica( A.Grid() )
+{ Set( A ); }
+
+template<typename T>
+SharedReplica<T>::~SharedReplica()
+{
+#ifdef EL_HAVE_MPI3_RMA
+    if( !mpi::Finalized() )
+    {
+        if( capacity_ > 0 )
+        {
+            mpi::WindowUnlockAll( window_ );
+            mpi::WindowFree( window_ );
+        }
+        if( leaderComm_ != mpi::COMM_NULL )
+            mpi::Free( leaderComm_ );
+        if( nodeComm_ != mpi::COMM_NULL )
+            mpi::Free( nodeComm_ );
+    }
+#endif
+}
+
+#ifdef EL_HAVE_MPI3_RMA
+template<typename T>
+void SharedReplica<T>::Reserve( Int size )
+{
+    DEBUG_ONLY(CSE cse("SharedReplica::Reserve"))
+    if( size <= capacity_ )
+        return;
+    view_.Empty();
+    if( capacity_ > 0 )
+    {
+        mpi::WindowUnlockAll( window_ );
+        mpi::WindowFree( window_ );
+    }
+    // Only the leader of each node allocates memory
+    const bool leader = ( mpi::Rank(nodeComm_) == 0 );
+    mpi::WindowAllocateShared
+    ( leader ? size : Int(0), nodeComm_, buffer_, window_ );
+    buffer_ = mpi::WindowSharedQuery<T>( 0, window_ );
+    mpi::WindowLockAll( window_ );
+    capacity_ = size;
+}
+#endif
+
+template<typename T>
+void SharedReplica<T>::Set( const AbstractDistMatrix<T>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("SharedReplica::Set");
+      AssertSameGrids( A.Grid(), *grid_ );
+    )
+#ifdef EL_HAVE_MPI3_RMA
+    const El::Grid& g = *grid_;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    view_.Empty();
+    if( !g.InGrid() || m*n == 0 )
+    {
+        view_.Resize( m, n );
+        return;
+    }
+
+    // Give each process a contiguous (column-major) range of the entries
+    const int p = g.Size();
+    const Int blockWidth = Max( (n+p-1)/p, Int(1) );
+    DistMatrix<T,STAR,VC,BLOCK> A_STAR_VC(g);
+    A_STAR_VC.Align( blockWidth, blockWidth, 0, 0 );
+    A_STAR_VC = A;
+    auto rangeBeg = [&]( int q ) { return Min(q*blockWidth,n)*m; };
+    auto rangeEnd = [&]( int q ) { return Min((q+1)*blockWidth,n)*m; };
+
+    // Write the local entries directly into the window of the node
+    Reserve( m*n );
+    const int vcRank = g.VCRank();
+    copy::util::InterleaveMatrix
+    ( m, A_STAR_VC.LocalWidth(),
+      A_STAR_VC.LockedBuffer(), 1, A_STAR_VC.LDim(),
+      &buffer_[rangeBeg(vcRank)], 1, m );
+    mpi::WindowSync( window_ );
+    mpi::Barrier( nodeComm_ );
+    mpi::WindowSync( window_ );
+
+    // Exchange the entries of each node between the leaders
+    if( leaderComm_ != mpi::COMM_NULL )
+    {
+        const int numNodes = mpi::Size( leaderComm_ );
+        const int node = nodes_[vcRank];
+        vector<Int> counts( numNodes, 0 ), offsets( numNodes, 0 );
+        if( contiguous_ )
+        {
+            for( int q=p-1; q>=0; --q )
+            {
+                counts[nodes_[q]] += rangeEnd(q) - rangeBeg(q);
+                offsets[nodes_[q]] = rangeBeg(q);
+            }
+            // The range of this node already lies at offsets[node]
+            mpi::AllGather
+            ( buffer_, counts.data(), offsets.data(), leaderComm_ );
+        }
+        else
+        {
+            // Concatenate the ranges of the processes of each node
+            for( int q=0; q<p; ++q )
+                counts[nodes_[q]] += rangeEnd(q) - rangeBeg(q);
+            for( int k=1; k<numNodes; ++k )
+                offsets[k] = offsets[k-1] + counts[k-1];
+            vector<T> sendBuf, recvBuf( m*n );
+            sendBuf.reserve( counts[node] );
+            for( int q=0; q<p; ++q )
+                if( nodes_[q] == node )
+                    sendBuf.insert
+                    ( sendBuf.end(),
+                      &buffer_[rangeBeg(q)], &buffer_[rangeEnd(q)] );
+            mpi::AllGather
+            ( sendBuf.data(), counts[node],
+              recvBuf.data(), counts.data(), offsets.data(), leaderComm_ );
+            for( int q=0; q<p; ++q )
+            {
+                const Int count = rangeEnd(q) - rangeBeg(q);
+                if( nodes_[q] != node )
+                    std::copy
+                    ( &recvBuf[offsets[nodes_[q]]],
+                      &recvBuf[offsets[nodes_[q]]+count],
+                      &buffer_[rangeBeg(q)] );
+                offsets[nodes_[q]] += count;
+            }
+        }
+    }
+    mpi::WindowSync( window_ );
+    mpi::Barrier( nodeComm_ );
+    mpi::WindowSync( window_ );
+
+    view_.LockedAttach( m, n, g, 0, 0, buffer_, Max(m,Int(1)) );
+#else
+    view_ = A;
+#endif
+}
+
+template<typename T>
+const DistMatrix<T,STAR,STAR>& SharedReplica<T>::Matrix() const EL_NO_EXCEPT
+{ return view_; }
+
+template<typename T>
+const El::Grid& SharedReplica<T>::Grid() const EL_NO_EXCEPT
+{ return *grid_; }
+
+#define PROTO(T) template class SharedReplica<T>;
+
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -54,6 +54,10 @@ Graph::Graph( const DistGraph& graph )
     *this = graph;
 }
 
+Graph::Graph( Graph&& graph ) EL_NO_EXCEPT
+: numSources_(0), numTargets_(0)
+{ *this = std::move(graph); }
+
 Graph::~Graph() { }
 
 // Assignment and reconfiguration
@@ -75,6 +79,34 @@ const Graph& Graph::operator=( const DistGraph& graph )
     return *this;
 }
 
+// Move assignment
+// ---------------
+Graph& Graph::operator=( Graph&& graph ) EL_NO_EXCEPT
+{
+    if( &graph == this )
+        return *this;
+
+    numSources_ = graph.numSources_;
+    numTargets_ = graph.numTargets_;
+    frozenSparsity_ = graph.frozenSparsity_;
+    consistent_ = graph.consistent_;
+    sources_ = std::move(graph.sources_);
+    targets_ = std::move(graph.targets_);
+    sourceOffsets_ = std::move(graph.sourceOffsets_);
+    markedForRemoval_ = std::move(graph.markedForRemoval_);
+
+    // Leave the moved-from graph in its default-constructed state
+    graph.numSources_ = 0;
+    graph.numTargets_ = 0;
+    graph.frozenSparsity_ = false;
+    graph.consistent_ = true;
+    graph.sources_.clear();
+    graph.targets_.clear();
+    graph.sourceOffsets_.clear();
+    graph.markedForRemoval_.clear();
+    return *this;
+}
+
 // Make a copy of a contiguous subgraph
 // ------------------------------------
 Graph Graph::operator()( Range<Int> I, Range<Int> J ) const
@@ -20,7 +20,7 @@ int Grid::FindFactor( int p ) EL_NO_EXCEPT
 }
 
 Grid::Grid( mpi::Comm comm, GridOrder order )
-: haveViewers_(false), order_(order)
+: haveViewers_(false), order_(order), nodeAware_(false)
 {
     DEBUG_ONLY(CSE cse("Grid::Grid"))
 
@@ -37,13 +37,25 @@ Grid::Grid( mpi::Comm comm, GridOrder order )
     SetUpGrid();
 }
 
-Grid::Grid( mpi::Comm comm, int height, GridOrder order )
-: haveViewers_(false), order_(order)
+Grid::Grid( mpi::Comm comm, int height, GridOrder order, bool nodeAware )
+: haveViewers_(false), order_(order), nodeAware_(nodeAware)
 {
     DEBUG_ONLY(CSE cse("Grid::Grid"))
 
     // Extract our rank, the underlying group, and the number of processes
-    mpi::Dup( comm, viewingComm_ );
+    if( nodeAware )
+    {
+        // Order the processes by the lowest rank on their node (MPI breaks
+        // the ties using the original ranks)
+        mpi::Comm nodeComm;
+        int nodeLeader = mpi::Rank( comm );
+        mpi::SplitShared( comm, nodeLeader, nodeComm );
+        mpi::Broadcast( nodeLeader, 0, nodeComm );
+        mpi::Free( nodeComm );
+        mpi::Split( comm, 0, nodeLeader, viewingComm_ );
+    }
+    else
+        mpi::Dup( comm, viewingComm_ );
     mpi::CommGroup( viewingComm_, viewingGroup_ );
     size_ = mpi::Size( viewingComm_ );
 
@@ -73,6 +85,7 @@ void Grid::SetUpGrid()
 
     // Create the communicator for the owning group (mpi::COMM_NULL otherwise)
     mpi::Create( viewingComm_, owningGroup_, owningComm_ );
+    mpi::SetCommName( viewingComm_, "Viewing" );
 
     vcToViewing_.resize(size_);
     diagsAndRanks_.resize(2*size_);
@@ -149,6 +162,23 @@ void Grid::SetUpGrid()
         mpi::Split( cartComm_, mdPerpRank_, mdRank_,     mdComm_     );
         mpi::Split( cartComm_, mdRank_,     mdPerpRank_, mdPerpComm_ );
 
+        // Label the communicators for the MPI traffic counters
+        mpi::SetCommName( owningComm_, "Owning" );
+        mpi::SetCommName( mcComm_,     "MC" );
+        mpi::SetCommName( mrComm_,     "MR" );
+        mpi::SetCommName( vcComm_,     "VC" );
+        mpi::SetCommName( vrComm_,     "VR" );
+        mpi::SetCommName( mdComm_,     "MD" );
+        mpi::SetCommName( mdPerpComm_, "MDPerp" );
+
+        if( nodeAware_ )
+        {
+            mpi::CreateHierarchy( mcComm_ );
+            mpi::CreateHierarchy( mrComm_ );
+            mpi::CreateHierarchy( vcComm_ );
+            mpi::CreateHierarchy( vrComm_ );
+        }
+
         DEBUG_ONLY(
           mpi::ErrorHandlerSet( mcComm_,     mpi::ERRORS_RETURN );
           mpi::ErrorHandlerSet( mrComm_,     mpi::ERRORS_RETURN );
@@ -185,10 +215,26 @@ void Grid::SetUpGrid()
 
 Grid::~Grid()
 {
+    // The layer grids view our viewing communicator, so free them first
+    for( auto& entry : layers_ )
+    {
+        entry.second->grids.clear();
+        if( !mpi::Finalized() && entry.second->depthComm != mpi::COMM_NULL )
+            mpi::Free( entry.second->depthComm );
+    }
+    layers_.clear();
+
     if( !mpi::Finalized() )
     {
         if( InGrid() )
         {
+            if( nodeAware_ )
+            {
+                mpi::FreeHierarchy( mcComm_ );
+                mpi::FreeHierarchy( mrComm_ );
+                mpi::FreeHierarchy( vcComm_ );
+                mpi::FreeHierarchy( vrComm_ );
+            }
             mpi::Free( mdComm_ );
             mpi::Free( mdPerpComm_ );
             mpi::Free( mcComm_ );
@@ -234,6 +280,7 @@ int Grid::Size()   const EL_NO_EXCEPT { return VCSize(); }
 int Grid::Rank()   const EL_NO_RELEASE_EXCEPT { return OwningRank(); }
 
 GridOrder Grid::Order() const EL_NO_EXCEPT { return order_; }
+bool Grid::NodeAware() const EL_NO_EXCEPT { return nodeAware_; }
 
 int Grid::Row() const EL_NO_RELEASE_EXCEPT { return MCRank(); }
 int Grid::Col() const EL_NO_RELEASE_EXCEPT { return MRRank(); }
@@ -247,7 +294,7 @@ mpi::Comm Grid::Comm() const EL_NO_EXCEPT
 
 // Currently forces a columnMajor absolute rank on the grid
 Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
-: haveViewers_(true), order_(order)
+: haveViewers_(true), order_(order), nodeAware_(false)
 {
     DEBUG_ONLY(CSE cse("Grid::Grid"))
 
@@ -266,6 +313,59 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, GridOrder order )
     SetUpGrid();
 }
 
+const Grid::Layers& Grid::GetLayers( int depth ) const
+{
+    DEBUG_ONLY(CSE cse("Grid::GetLayers"))
+    auto it = layers_.find( depth );
+    if( it != layers_.end() )
+        return *it->second;
+
+    if( depth < 1 || size_ % depth != 0 )
+        LogicError
+        ("The number of layers, ",depth,", must divide the number of "
+         "processes, ",size_);
+    const int layerSize = size_ / depth;
+    unique_ptr<Layers> layers( new Layers );
+    layers->grids.resize( depth );
+    vector<int> layerRanks(layerSize);
+    for( int l=0; l<depth; ++l )
+    {
+        for( int q=0; q<layerSize; ++q )
+            layerRanks[q] = l*layerSize + q;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, layerRanks.data(), layerGroup );
+        layers->grids[l].reset
+        ( new Grid
+          ( viewingComm_, layerGroup, FindFactor(layerSize), order_ ) );
+        mpi::Free( layerGroup );
+    }
+    layers->depthComm = mpi::COMM_NULL;
+    if( inGrid_ )
+        mpi::Split
+        ( owningComm_, owningRank_ % layerSize, owningRank_ / layerSize,
+          layers->depthComm );
+
+    const Layers& result = *layers;
+    layers_[depth] = std::move( layers );
+    return result;
+}
+
+const Grid& Grid::LayerGrid( int depth, int layer ) const
+{
+    DEBUG_ONLY(
+      CSE cse("Grid::LayerGrid");
+      if( layer < 0 || layer >= depth )
+          LogicError("Invalid layer ",layer," of ",depth);
+    )
+    return *GetLayers( depth ).grids[layer];
+}
+
+mpi::Comm Grid::DepthComm( int depth ) const
+{
+    DEBUG_ONLY(CSE cse("Grid::DepthComm"))
+    return GetLayers( depth ).depthComm;
+}
+
 int Grid::GCD() const EL_NO_EXCEPT { return gcd_; }
 int Grid::LCM() const EL_NO_EXCEPT { return size_/gcd_; }
 
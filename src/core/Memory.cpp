@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+namespace {
+using namespace El;
+
+// The cache of freed blocks, indexed by their size class
+std::map<size_t,vector<void*>> freeBlocks;
+size_t cachedBytes = 0;
+size_t poolCapacity = size_t(1) << 30;
+std::mutex poolMutex;
+
+// The number of MemoryArena's active on the calling thread and on all threads
+thread_local Int threadArenaDepth = 0;
+Int numActiveArenas = 0;
+
+NumaPolicy defaultNumaPolicy = NUMA_DEFAULT;
+
+// Round the request up to one of four size classes per power of two (so that
+// at most a quarter of each block is wasted) and to a multiple of the alignment
+size_t SizeClass( size_t numBytes )
+{
+    const size_t alignment = EL_MEMORY_ALIGNMENT;
+    if( numBytes <= alignment )
+        return alignment;
+
+    size_t power = 1;
+    while( power < (numBytes-1)/2+1 )
+        power <<= 1;
+    const size_t step = std::max( power/4, alignment );
+    return ((numBytes+step-1)/step)*step;
+}
+
+// Overallocate by the alignment and stash the raw pointer immediately before
+// the aligned buffer (malloc guarantees at least sizeof(void*) of slack)
+void* SystemAlloc( size_t classBytes )
+{
+    const size_t alignment = EL_MEMORY_ALIGNMENT;
+    void* raw = std::malloc( classBytes+alignment );
+    if( raw == nullptr )
+        return nullptr;
+    const std::uintptr_t rawInt = reinterpret_cast<std::uintptr_t>(raw);
+    const std::uintptr_t alignedInt = (rawInt+alignment) & ~(alignment-1);
+    void* aligned = reinterpret_cast<void*>(alignedInt);
+    static_cast<void**>(aligned)[-1] = raw;
+    return aligned;
+}
+
+void SystemFree( void* aligned )
+{ std::free( static_cast<void**>(aligned)[-1] ); }
+
+// Return the largest cached blocks to the system until the cache fits
+// within the given number of bytes (the pool mutex must be held)
+void TrimCache( size_t maxBytes )
+{
+    auto it = freeBlocks.end();
+    while( cachedBytes > maxBytes && it != freeBlocks.begin() )
+    {
+        --it;
+        auto& blocks = it->second;
+        while( cachedBytes > maxBytes && !blocks.empty() )
+        {
+            SystemFree( blocks.back() );
+            blocks.pop_back();
+            cachedBytes -= it->first;
+        }
+    }
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void* AlignedAlloc( size_t numBytes, bool cached )
+{
+    if( numBytes == 0 )
+        return nullptr;
+    const size_t classBytes = SizeClass( numBytes );
+    if( cached )
+    {
+        std::lock_guard<std::mutex> lock( ::poolMutex );
+        auto it = ::freeBlocks.find( classBytes );
+        if( it != ::freeBlocks.end() && !it->second.empty() )
+        {
+            void* buffer = it->second.back();
+            it->second.pop_back();
+            ::cachedBytes -= classBytes;
+            return buffer;
+        }
+    }
+
+    void* buffer = SystemAlloc( classBytes );
+    if( buffer == nullptr )
+    {
+        // Give the cached blocks back to the system and try once more
+        ReleaseMemoryPool();
+        buffer = SystemAlloc( classBytes );
+        if( buffer == nullptr )
+            throw std::bad_alloc();
+    }
+    return buffer;
+}
+
+void AlignedFree( void* buffer, size_t numBytes )
+{
+    if( buffer == nullptr )
+        return;
+    const size_t classBytes = SizeClass( numBytes );
+    {
+        std::lock_guard<std::mutex> lock( ::poolMutex );
+        if( ::threadArenaDepth > 0 ||
+            ::cachedBytes+classBytes <= ::poolCapacity )
+        {
+            ::freeBlocks[classBytes].push_back( buffer );
+            ::cachedBytes += classBytes;
+            return;
+        }
+    }
+    SystemFree( buffer );
+}
+
+void SetMemoryPoolCapacity( size_t numBytes )
+{
+    std::lock_guard<std::mutex> lock( ::poolMutex );
+    ::poolCapacity = numBytes;
+    TrimCache( numBytes );
+}
+
+size_t MemoryPoolCapacity()
+{
+    std::lock_guard<std::mutex> lock( ::poolMutex );
+    return ::poolCapacity;
+}
+
+size_t MemoryPoolCachedBytes()
+{
+    std::lock_guard<std::mutex> lock( ::poolMutex );
+    return ::cachedBytes;
+}
+
+void ReleaseMemoryPool()
+{
+    std::lock_guard<std::mutex> lock( ::poolMutex );
+    TrimCache( 0 );
+    ::freeBlocks.clear();
+}
+
+MemoryArena::MemoryArena()
+{
+    std::lock_guard<std::mutex> lock( ::poolMutex );
+    ++::threadArenaDepth;
+    ++::numActiveArenas;
+}
+
+MemoryArena::~MemoryArena()
+{
+    std::lock_guard<std::mutex> lock( ::poolMutex );
+    --::threadArenaDepth;
+    // Only the last active arena trims the blocks retained beyond the capacity
+    if( --::numActiveArenas == 0 )
+        TrimCache( ::poolCapacity );
+}
+
+void SetDefaultNumaPolicy( NumaPolicy policy )
+{ ::defaultNumaPolicy = policy; }
+
+NumaPolicy DefaultNumaPolicy()
+{ return ::defaultNumaPolicy; }
+
+} // namespace El
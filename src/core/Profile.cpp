@@ -0,0 +1,535 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+
+namespace {
+using namespace El;
+
+// Separates the names of the nested regions within a path
+const char pathSep = '\x1F';
+
+struct ProfileNode
+{
+    string name;
+    Int parent;
+    vector<Int> children;
+    Int numCalls=0;
+    double childTime=0;
+    Timer timer;
+
+    ProfileNode( const string& nodeName, Int nodeParent )
+    : name(nodeName), parent(nodeParent)
+    { }
+};
+
+struct TraceEvent
+{
+    Int node;
+    double start, duration;
+};
+
+struct ProfileState
+{
+    // nodes[0] is an unnamed root which is never entered
+    vector<ProfileNode> nodes;
+    // The currently open regions (and when they were entered)
+    vector<std::pair<Int,double>> stack;
+    vector<TraceEvent> events;
+    Timer epoch;
+
+    ProfileState() { Reset(); }
+
+    void Reset()
+    {
+        nodes.clear();
+        nodes.emplace_back( string(), -1 );
+        stack.clear();
+        events.clear();
+        epoch.Reset();
+        epoch.Start();
+    }
+
+    Int Current() const { return stack.empty() ? 0 : stack.back().first; }
+};
+
+std::atomic<bool> profilingEnabled(false);
+std::atomic<bool> profilingTrace(false);
+
+thread_local ProfileState profile;
+
+string EscapeJSON( const string& str )
+{
+    std::ostringstream os;
+    for( const char& c : str )
+    {
+        switch( c )
+        {
+        case '"':  os << "\\\""; break;
+        case '\\': os << "\\\\"; break;
+        case '\n': os << "\\n";  break;
+        case '\t': os << "\\t";  break;
+        default:
+            if( static_cast<unsigned char>(c) < 0x20 )
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                   << int(c) << std::dec << std::setfill(' ');
+            else
+                os << c;
+        }
+    }
+    return os.str();
+}
+
+string PathToString( const string& path )
+{
+    string str = path;
+    std::replace( str.begin(), str.end(), pathSep, '/' );
+    return str;
+}
+
+void Flatten
+( Int node, const string& path,
+  vector<string>& paths,
+  vector<double>& stats )
+{
+    const ProfileNode& profNode = ::profile.nodes[node];
+    if( node != 0 )
+    {
+        const double inclusive = profNode.timer.Total();
+        paths.push_back( path );
+        stats.push_back( double(profNode.numCalls) );
+        stats.push_back( inclusive );
+        stats.push_back( inclusive-profNode.childTime );
+    }
+    for( const Int child : profNode.children )
+    {
+        const string& childName = ::profile.nodes[child].name;
+        const string childPath =
+          ( node == 0 ? childName : path + pathSep + childName );
+        Flatten( child, childPath, paths, stats );
+    }
+}
+
+vector<byte> Pack( const vector<string>& strs, char delim )
+{
+    vector<byte> packed;
+    for( const string& str : strs )
+    {
+        packed.insert( packed.end(), str.begin(), str.end() );
+        packed.push_back( delim );
+    }
+    return packed;
+}
+
+vector<string> Unpack( const byte* buf, Int size, char delim )
+{
+    vector<string> strs;
+    string str;
+    for( Int k=0; k<size; ++k )
+    {
+        if( buf[k] == byte(delim) )
+        {
+            strs.push_back( str );
+            str.clear();
+        }
+        else
+            str.push_back( char(buf[k]) );
+    }
+    return strs;
+}
+
+// Gather the variable-length buffers of each process onto the root
+vector<byte> GatherBytes
+( const vector<byte>& sendBuf, vector<int>& sizes, vector<int>& offs,
+  int root, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int sendSize = sendBuf.size();
+    sizes.resize( commRank == root ? commSize : 0 );
+    mpi::Gather( &sendSize, 1, sizes.data(), 1, root, comm );
+
+    vector<byte> recvBuf;
+    if( commRank == root )
+    {
+        const int totalSize = Scan( sizes, offs );
+        recvBuf.resize( totalSize );
+    }
+    mpi::Gather
+    ( sendBuf.data(), sendSize,
+      recvBuf.data(), sizes.data(), offs.data(), root, comm );
+    return recvBuf;
+}
+
+// The statistics of a region aggregated over a communicator
+struct RegionStats
+{
+    string path, name;
+    Int depth;
+    // The minimum, average, and maximum over the processes
+    double calls[3], inclusive[3], exclusive[3];
+};
+
+// Form the union of the region trees of the processes (in the order in which
+// they were first encountered) and reduce the statistics of each region onto
+// the root. Regions which a process never entered count as zero.
+vector<RegionStats> AggregateProfile( int root, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    vector<string> localPaths;
+    vector<double> localStats;
+    Flatten( 0, string(), localPaths, localStats );
+
+    vector<int> sizes, offs;
+    vector<byte> allPaths =
+      GatherBytes( Pack(localPaths,'\n'), sizes, offs, root, comm );
+
+    vector<byte> unionBuf;
+    if( commRank == root )
+    {
+        // Merge the trees so that children remain adjacent to their parents
+        vector<string> names(1);
+        vector<vector<Int>> children(1);
+        for( int q=0; q<commSize; ++q )
+        {
+            auto paths = Unpack( allPaths.data()+offs[q], sizes[q], '\n' );
+            for( const string& path : paths )
+            {
+                Int node = 0;
+                std::istringstream pathStream( path );
+                string name;
+                while( std::getline( pathStream, name, pathSep ) )
+                {
+                    Int match = -1;
+                    for( const Int child : children[node] )
+                        if( names[child] == name )
+                            match = child;
+                    if( match == -1 )
+                    {
+                        match = names.size();
+                        names.push_back( name );
+                        children.emplace_back();
+                        children[node].push_back( match );
+                    }
+                    node = match;
+                }
+            }
+        }
+
+        vector<string> unionPaths;
+        function<void(Int,const string&)> traverse =
+          [&]( Int node, const string& path )
+          {
+              if( node != 0 )
+                  unionPaths.push_back( path );
+              for( const Int child : children[node] )
+                  traverse
+                  ( child,
+                    node == 0 ? names[child] : path + pathSep + names[child] );
+          };
+        traverse( 0, string() );
+        unionBuf = Pack( unionPaths, '\n' );
+    }
+    int unionSize = unionBuf.size();
+    mpi::Broadcast( unionSize, root, comm );
+    unionBuf.resize( unionSize );
+    mpi::Broadcast( unionBuf.data(), unionSize, root, comm );
+    const vector<string> unionPaths = Unpack( unionBuf.data(), unionSize, '\n' );
+
+    // Each process contributes its (calls,inclusive,exclusive) triplets
+    const Int numRegions = unionPaths.size();
+    std::map<string,Int> localIndex;
+    for( Int k=0; k<Int(localPaths.size()); ++k )
+        localIndex[localPaths[k]] = k;
+    vector<double> stats( 3*numRegions, 0 );
+    for( Int k=0; k<numRegions; ++k )
+    {
+        auto it = localIndex.find( unionPaths[k] );
+        if( it != localIndex.end() )
+            for( Int j=0; j<3; ++j )
+                stats[3*k+j] = localStats[3*it->second+j];
+    }
+    vector<double> minStats(3*numRegions), maxStats(3*numRegions),
+                   sumStats(3*numRegions);
+    mpi::Reduce( stats.data(), minStats.data(), 3*numRegions,
+                 mpi::MIN, root, comm );
+    mpi::Reduce( stats.data(), maxStats.data(), 3*numRegions,
+                 mpi::MAX, root, comm );
+    mpi::Reduce( stats.data(), sumStats.data(), 3*numRegions,
+                 mpi::SUM, root, comm );
+
+    vector<RegionStats> regions;
+    if( commRank != root )
+        return regions;
+    regions.resize( numRegions );
+    for( Int k=0; k<numRegions; ++k )
+    {
+        RegionStats& region = regions[k];
+        region.path = unionPaths[k];
+        const auto lastSep = region.path.rfind( pathSep );
+        region.name = ( lastSep == string::npos ? region.path
+                                                : region.path.substr(lastSep+1) );
+        region.depth =
+          std::count( region.path.begin(), region.path.end(), pathSep );
+        double* fields[3] =
+          { region.calls, region.inclusive, region.exclusive };
+        for( Int j=0; j<3; ++j )
+        {
+            fields[j][0] = minStats[3*k+j];
+            fields[j][1] = sumStats[3*k+j] / commSize;
+            fields[j][2] = maxStats[3*k+j];
+        }
+    }
+    return regions;
+}
+
+void WriteJSON
+( ostream& file, const vector<RegionStats>& regions, int commSize )
+{
+    auto triplet = []( const double* vals )
+      {
+          std::ostringstream os;
+          os << "{\"min\": " << vals[0] << ", \"avg\": " << vals[1]
+             << ", \"max\": " << vals[2] << "}";
+          return os.str();
+      };
+    file << std::setprecision(9)
+         << "{\n  \"numProcesses\": " << commSize << ",\n"
+         << "  \"regions\": [";
+    for( Int k=0; k<Int(regions.size()); ++k )
+    {
+        const RegionStats& region = regions[k];
+        file << ( k == 0 ? "\n" : ",\n" )
+             << "    {\"path\": \"" << EscapeJSON(PathToString(region.path))
+             << "\", \"name\": \"" << EscapeJSON(region.name)
+             << "\", \"depth\": " << region.depth << ",\n"
+             << "     \"calls\": " << triplet(region.calls) << ",\n"
+             << "     \"inclusive\": " << triplet(region.inclusive) << ",\n"
+             << "     \"exclusive\": " << triplet(region.exclusive) << "}";
+    }
+    file << "\n  ]\n}" << endl;
+}
+
+void WriteChromeTrace( ostream& file, int root, mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+
+    // Each process formats its own events (timestamps are in microseconds)
+    vector<string> localEvents;
+    for( const TraceEvent& event : ::profile.events )
+    {
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(3)
+           << "{\"name\": \""
+           << EscapeJSON(::profile.nodes[event.node].name)
+           << "\", \"cat\": \"El\", \"ph\": \"X\", \"ts\": "
+           << 1e6*event.start << ", \"dur\": " << 1e6*event.duration
+           << ", \"pid\": " << commRank << ", \"tid\": 0}";
+        localEvents.push_back( os.str() );
+    }
+
+    vector<int> sizes, offs;
+    vector<byte> allEvents =
+      GatherBytes( Pack(localEvents,'\n'), sizes, offs, root, comm );
+    if( commRank != root )
+        return;
+
+    file << "{\"traceEvents\": [";
+    bool first = true;
+    for( int q=0; q<commSize; ++q )
+    {
+        file << ( first ? "\n" : ",\n" )
+              << "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": "
+              << q << ", \"args\": {\"name\": \"Rank " << q << "\"}}";
+        first = false;
+        for( const string& event :
+             Unpack( allEvents.data()+offs[q], sizes[q], '\n' ) )
+            file << ",\n  " << event;
+    }
+    file << "\n], \"displayTimeUnit\": \"ms\"}" << endl;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableProfiling( bool trace )
+{
+    ::profilingTrace = trace;
+    ::profilingEnabled = true;
+}
+
+void DisableProfiling()
+{ ::profilingEnabled = false; }
+
+bool ProfilingEnabled()
+{ return ::profilingEnabled; }
+
+void ResetProfile()
+{ ::profile.Reset(); }
+
+void PushProfileRegion( const char* name )
+{
+    if( !::profilingEnabled )
+        return;
+
+    ProfileState& state = ::profile;
+    const Int parent = state.Current();
+    Int node = -1;
+    for( const Int child : state.nodes[parent].children )
+    {
+        if( state.nodes[child].name == name )
+        {
+            node = child;
+            break;
+        }
+    }
+    if( node == -1 )
+    {
+        node = state.nodes.size();
+        state.nodes.emplace_back( string(name), parent );
+        state.nodes[parent].children.push_back( node );
+    }
+
+    ProfileNode& profNode = state.nodes[node];
+    ++profNode.numCalls;
+    const double start = ( ::profilingTrace ? state.epoch.Partial() : 0. );
+    state.stack.emplace_back( node, start );
+    profNode.timer.Start();
+}
+
+void PopProfileRegion()
+{
+    if( !::profilingEnabled )
+        return;
+
+    ProfileState& state = ::profile;
+    if( state.stack.empty() )
+        LogicError("Popped more profile regions than were pushed");
+    const Int node = state.stack.back().first;
+    const double start = state.stack.back().second;
+    state.stack.pop_back();
+
+    ProfileNode& profNode = state.nodes[node];
+    const double duration = profNode.timer.Stop();
+    state.nodes[profNode.parent].childTime += duration;
+    if( ::profilingTrace )
+        state.events.push_back( TraceEvent{node,start,duration} );
+}
+
+ProfileRegion::ProfileRegion( const char* name )
+: depth_(-1)
+{
+    if( ::profilingEnabled )
+    {
+        depth_ = ::profile.stack.size();
+        PushProfileRegion( name );
+    }
+}
+
+ProfileRegion::~ProfileRegion()
+{
+    if( depth_ < 0 || !::profilingEnabled )
+        return;
+    while( Int(::profile.stack.size()) > depth_ )
+        PopProfileRegion();
+}
+
+ScopedProfile::ScopedProfile( bool enable, mpi::Comm comm )
+: active_(enable && !::profilingEnabled), comm_(comm)
+{
+    if( active_ )
+    {
+        ResetProfile();
+        EnableProfiling();
+    }
+}
+
+ScopedProfile::~ScopedProfile()
+{
+    if( !active_ )
+        return;
+    // Avoid entering a collective while an exception is propagating
+    if( !std::uncaught_exception() )
+    {
+        try { PrintProfile( comm_ ); }
+        catch( std::exception& e ) { ReportException(e); }
+    }
+    DisableProfiling();
+    ResetProfile();
+}
+
+void PrintProfile( mpi::Comm comm, ostream& os )
+{
+    DEBUG_ONLY(CSE cse("PrintProfile"))
+    const int root = 0;
+    const auto regions = AggregateProfile( root, comm );
+    if( mpi::Rank(comm) != root )
+        return;
+
+    const int commSize = mpi::Size( comm );
+    const int nameWidth = 36, width = 11;
+    std::ostringstream msg;
+    msg << "Profile over " << commSize << " process"
+        << ( commSize == 1 ? "" : "es" )
+        << " (min/avg/max over processes, in seconds)\n"
+        << std::left << std::setw(nameWidth) << "Region" << std::right
+        << std::setw(width) << "Calls"
+        << std::setw(3*width) << "Inclusive"
+        << std::setw(3*width) << "Exclusive" << "\n"
+        << std::setprecision(4);
+    for( const RegionStats& region : regions )
+    {
+        const string label = string(2*region.depth,' ') + region.name;
+        msg << std::left << std::setw(nameWidth) << label << std::right
+            << std::setw(width) << region.calls[2];
+        for( Int j=0; j<3; ++j )
+            msg << std::setw(width) << region.inclusive[j];
+        for( Int j=0; j<3; ++j )
+            msg << std::setw(width) << region.exclusive[j];
+        msg << "\n";
+    }
+    os << msg.str() << std::flush;
+}
+
+void WriteProfile
+( const string& filename, ProfileFormat format, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("WriteProfile"))
+    const int root = 0;
+    const int commRank = mpi::Rank( comm );
+
+    // Only open the file after the collectives have completed so that a
+    // failure on the root cannot leave the other processes waiting
+    std::ostringstream os;
+    if( format == PROFILE_JSON )
+    {
+        const auto regions = AggregateProfile( root, comm );
+        if( commRank == root )
+            WriteJSON( os, regions, mpi::Size(comm) );
+    }
+    else
+        WriteChromeTrace( os, root, comm );
+
+    if( commRank == root )
+    {
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        file << os.str();
+    }
+}
+
+} // namespace El
@@ -0,0 +1,399 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+// The vectorized kernels are compiled for each instruction set via function
+// target attributes (so that the rest of the library need not be built for a
+// particular instruction set) and selected at runtime
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)) && \
+    !defined(__INTEL_COMPILER)
+# define EL_SIMD_X86
+# include <immintrin.h>
+#endif
+
+namespace El {
+namespace simd {
+
+#ifdef EL_SIMD_X86
+namespace avx2 {
+#define EL_SIMD_TARGET __attribute__((target("avx2,fma")))
+#include "./SIMD/AVX2.hpp"
+#include "./SIMD/kernels.hpp"
+#undef EL_SIMD_TARGET
+} // namespace avx2
+
+namespace avx512 {
+#define EL_SIMD_TARGET __attribute__((target("avx512f,avx2,fma")))
+#include "./SIMD/AVX512.hpp"
+#include "./SIMD/kernels.hpp"
+#undef EL_SIMD_TARGET
+} // namespace avx512
+#endif // ifdef EL_SIMD_X86
+
+namespace {
+
+InstructionSet Detect()
+{
+#ifdef EL_SIMD_X86
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports("avx512f") )
+        return AVX512_INSTRUCTIONS;
+    if( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") )
+        return AVX2_INSTRUCTIONS;
+#endif
+    return SCALAR_INSTRUCTIONS;
+}
+
+InstructionSet& Active()
+{
+    static InstructionSet active = DetectedInstructionSet();
+    return active;
+}
+
+} // anonymous namespace
+
+InstructionSet DetectedInstructionSet()
+{
+    static const InstructionSet detected = Detect();
+    return detected;
+}
+
+InstructionSet ActiveInstructionSet() { return Active(); }
+
+void SetInstructionSet( InstructionSet set )
+{
+    const InstructionSet detected = DetectedInstructionSet();
+    Active() = ( set > detected ? detected : set );
+}
+
+string InstructionSetName( InstructionSet set )
+{
+    switch( set )
+    {
+    case AVX2_INSTRUCTIONS:   return "AVX2";
+    case AVX512_INSTRUCTIONS: return "AVX-512";
+    default:                  return "scalar";
+    }
+}
+
+// Return the result of KERNEL<PACK> ARGS for the active instruction set, if
+// it is vectorized, and otherwise fall through
+#ifdef EL_SIMD_X86
+# define EL_SIMD_DISPATCH(KERNEL,PACK,ARGS) \
+  switch( Active() ) \
+  { \
+  case AVX512_INSTRUCTIONS: return avx512::KERNEL<avx512::PACK> ARGS; \
+  case AVX2_INSTRUCTIONS:   return avx2::KERNEL<avx2::PACK> ARGS; \
+  default: break; \
+  }
+#else
+# define EL_SIMD_DISPATCH(KERNEL,PACK,ARGS)
+#endif
+
+namespace {
+
+template<typename Real>
+const Real* RealPtr( const Complex<Real>* x )
+{ return reinterpret_cast<const Real*>(x); }
+
+template<typename Real>
+Real* RealPtr( Complex<Real>* x )
+{ return reinterpret_cast<Real*>(x); }
+
+double SumOfSquares( Int n, const double* x )
+{
+    EL_SIMD_DISPATCH( Dot, PackD, (n,x,x) )
+    return Dot<double>( n, x, x );
+}
+
+// Returns -1 if there is no vectorized implementation
+double WidenedSumOfSquares( Int n, const float* x )
+{
+    EL_SIMD_DISPATCH( WidenedSumOfSquares, PackF, (n,x) )
+    return -1;
+}
+
+// A sum of the squares of n entries is only accepted if it is finite and
+// large enough that the underflow of the squares of tiny entries is harmless
+bool SafeSumOfSquares( Int n, double sumOfSquares )
+{
+    const double minSafe =
+      double(Max(n,Int(1)))*limits::Min<double>()/limits::Epsilon<double>();
+    return sumOfSquares >= minSafe && sumOfSquares <= limits::Max<double>();
+}
+
+Int ComplexMaxAbsIndKernel( Int n, const float* x )
+{
+    EL_SIMD_DISPATCH( ComplexMaxAbsInd, PackF, (n,x) )
+    return -2;
+}
+
+Int ComplexMaxAbsIndKernel( Int n, const double* x )
+{
+    EL_SIMD_DISPATCH( ComplexMaxAbsInd, PackD, (n,x) )
+    return -2;
+}
+
+} // anonymous namespace
+
+// x^H y
+// =====
+
+float Dot( Int n, const float* x, const float* y )
+{
+    EL_SIMD_DISPATCH( Dot, PackF, (n,x,y) )
+    return Dot<float>( n, x, y );
+}
+
+double Dot( Int n, const double* x, const double* y )
+{
+    EL_SIMD_DISPATCH( Dot, PackD, (n,x,y) )
+    return Dot<double>( n, x, y );
+}
+
+scomplex Dot( Int n, const scomplex* x, const scomplex* y )
+{
+    EL_SIMD_DISPATCH( ComplexDot, PackF, (n,RealPtr(x),RealPtr(y)) )
+    return Dot<scomplex>( n, x, y );
+}
+
+dcomplex Dot( Int n, const dcomplex* x, const dcomplex* y )
+{
+    EL_SIMD_DISPATCH( ComplexDot, PackD, (n,RealPtr(x),RealPtr(y)) )
+    return Dot<dcomplex>( n, x, y );
+}
+
+#ifdef EL_HAVE_QD
+namespace {
+
+// The high and low words of a double-double are stored contiguously
+static_assert
+( sizeof(DoubleDouble) == 2*sizeof(double),
+  "DoubleDouble was not stored as two contiguous doubles" );
+
+const double* DoubleDoublePtr( const DoubleDouble* x )
+{ return reinterpret_cast<const double*>(x); }
+
+bool DoubleDoubleDotKernel
+( Int n, const DoubleDouble* x, const DoubleDouble* y, double* sum )
+{
+#ifdef EL_SIMD_X86
+    switch( Active() )
+    {
+    case AVX512_INSTRUCTIONS:
+        avx512::DoubleDoubleDot<avx512::PackD>
+        ( n, DoubleDoublePtr(x), DoubleDoublePtr(y), sum );
+        return true;
+    case AVX2_INSTRUCTIONS:
+        avx2::DoubleDoubleDot<avx2::PackD>
+        ( n, DoubleDoublePtr(x), DoubleDoublePtr(y), sum );
+        return true;
+    default: break;
+    }
+#endif
+    return false;
+}
+
+} // anonymous namespace
+
+DoubleDouble Dot( Int n, const DoubleDouble* x, const DoubleDouble* y )
+{
+    double sum[2];
+    if( DoubleDoubleDotKernel( n, x, y, sum ) )
+        return DoubleDouble(dd_real(sum[0],sum[1]));
+    return Dot<DoubleDouble>( n, x, y );
+}
+#endif // ifdef EL_HAVE_QD
+
+// || x ||_2
+// =========
+
+float Nrm2( Int n, const float* x )
+{
+    // The squares of single-precision numbers can neither overflow nor
+    // underflow in double precision
+    const double sumOfSquares = WidenedSumOfSquares( n, x );
+    if( sumOfSquares >= 0 )
+        return float(Sqrt(sumOfSquares));
+    return Nrm2<float>( n, x );
+}
+
+double Nrm2( Int n, const double* x )
+{
+    if( Active() != SCALAR_INSTRUCTIONS )
+    {
+        const double sumOfSquares = SumOfSquares( n, x );
+        if( SafeSumOfSquares( n, sumOfSquares ) )
+            return Sqrt(sumOfSquares);
+    }
+    return Nrm2<double>( n, x );
+}
+
+float Nrm2( Int n, const scomplex* x )
+{
+    const double sumOfSquares = WidenedSumOfSquares( 2*n, RealPtr(x) );
+    if( sumOfSquares >= 0 )
+        return float(Sqrt(sumOfSquares));
+    return Nrm2<scomplex>( n, x );
+}
+
+double Nrm2( Int n, const dcomplex* x )
+{
+    if( Active() != SCALAR_INSTRUCTIONS )
+    {
+        const double sumOfSquares = SumOfSquares( 2*n, RealPtr(x) );
+        if( SafeSumOfSquares( 2*n, sumOfSquares ) )
+            return Sqrt(sumOfSquares);
+    }
+    return Nrm2<dcomplex>( n, x );
+}
+
+#ifdef EL_HAVE_QD
+DoubleDouble Nrm2( Int n, const DoubleDouble* x )
+{
+    // The low words of the squares lose accuracy well before the high words
+    // underflow, so the threshold is far more conservative than for doubles
+    double sum[2];
+    if( DoubleDoubleDotKernel( n, x, x, sum ) &&
+        sum[0] >= double(Max(n,Int(1)))*std::ldexp(1.,-900) &&
+        sum[0] <= limits::Max<double>() )
+        return Sqrt(DoubleDouble(dd_real(sum[0],sum[1])));
+    return Nrm2<DoubleDouble>( n, x );
+}
+#endif
+
+// The index of the first entry of maximum absolute value
+// ======================================================
+
+Int MaxAbsInd( Int n, const float* x )
+{
+    EL_SIMD_DISPATCH( MaxAbsInd, PackF, (n,x) )
+    return MaxAbsInd<float>( n, x );
+}
+
+Int MaxAbsInd( Int n, const double* x )
+{
+    EL_SIMD_DISPATCH( MaxAbsInd, PackD, (n,x) )
+    return MaxAbsInd<double>( n, x );
+}
+
+// Squared magnitudes are only compared if the maximum one is a normalized,
+// finite number (and so no other squared magnitude could have rounded to it)
+
+Int MaxAbsInd( Int n, const scomplex* x )
+{
+    const Int i = ComplexMaxAbsIndKernel( n, RealPtr(x) );
+    if( i == -1 )
+        return i;
+    if( i >= 0 )
+    {
+        const float sqVal = RealPart(x[i])*RealPart(x[i]) +
+                            ImagPart(x[i])*ImagPart(x[i]);
+        if( sqVal >= limits::Min<float>() && sqVal <= limits::Max<float>() )
+            return i;
+    }
+    return MaxAbsInd<scomplex>( n, x );
+}
+
+Int MaxAbsInd( Int n, const dcomplex* x )
+{
+    const Int i = ComplexMaxAbsIndKernel( n, RealPtr(x) );
+    if( i == -1 )
+        return i;
+    if( i >= 0 )
+    {
+        const double sqVal = RealPart(x[i])*RealPart(x[i]) +
+                             ImagPart(x[i])*ImagPart(x[i]);
+        if( sqVal >= limits::Min<double>() && sqVal <= limits::Max<double>() )
+            return i;
+    }
+    return MaxAbsInd<dcomplex>( n, x );
+}
+
+// c := a o b
+// ==========
+
+void Hadamard( Int n, const float* a, const float* b, float* c )
+{
+    EL_SIMD_DISPATCH( Hadamard, PackF, (n,a,b,c) )
+    Hadamard<float>( n, a, b, c );
+}
+
+void Hadamard( Int n, const double* a, const double* b, double* c )
+{
+    EL_SIMD_DISPATCH( Hadamard, PackD, (n,a,b,c) )
+    Hadamard<double>( n, a, b, c );
+}
+
+void Hadamard( Int n, const scomplex* a, const scomplex* b, scomplex* c )
+{
+    EL_SIMD_DISPATCH
+    ( ComplexHadamard, PackF, (n,RealPtr(a),RealPtr(b),RealPtr(c)) )
+    Hadamard<scomplex>( n, a, b, c );
+}
+
+void Hadamard( Int n, const dcomplex* a, const dcomplex* b, dcomplex* c )
+{
+    EL_SIMD_DISPATCH
+    ( ComplexHadamard, PackD, (n,RealPtr(a),RealPtr(b),RealPtr(c)) )
+    Hadamard<dcomplex>( n, a, b, c );
+}
+
+// 2x2 transformations of a pair of vectors
+// ========================================
+
+void Transform2x2
+( Int n,
+  float gamma11, float gamma12, float gamma21, float gamma22,
+  float* a1, float* a2 )
+{
+    EL_SIMD_DISPATCH
+    ( Transform2x2, PackF, (n,gamma11,gamma12,gamma21,gamma22,a1,a2) )
+    Transform2x2<float>( n, gamma11, gamma12, gamma21, gamma22, a1, a2 );
+}
+
+void Transform2x2
+( Int n,
+  double gamma11, double gamma12, double gamma21, double gamma22,
+  double* a1, double* a2 )
+{
+    EL_SIMD_DISPATCH
+    ( Transform2x2, PackD, (n,gamma11,gamma12,gamma21,gamma22,a1,a2) )
+    Transform2x2<double>( n, gamma11, gamma12, gamma21, gamma22, a1, a2 );
+}
+
+void Transform2x2
+( Int n,
+  scomplex gamma11, scomplex gamma12, scomplex gamma21, scomplex gamma22,
+  scomplex* a1, scomplex* a2 )
+{
+    const scomplex gamma[4] = { gamma11, gamma12, gamma21, gamma22 };
+    EL_SIMD_DISPATCH
+    ( ComplexTransform2x2, PackF,
+      (n,RealPtr(&gamma[0]),RealPtr(a1),RealPtr(a2)) )
+    Transform2x2<scomplex>( n, gamma11, gamma12, gamma21, gamma22, a1, a2 );
+}
+
+void Transform2x2
+( Int n,
+  dcomplex gamma11, dcomplex gamma12, dcomplex gamma21, dcomplex gamma22,
+  dcomplex* a1, dcomplex* a2 )
+{
+    const dcomplex gamma[4] = { gamma11, gamma12, gamma21, gamma22 };
+    EL_SIMD_DISPATCH
+    ( ComplexTransform2x2, PackD,
+      (n,RealPtr(&gamma[0]),RealPtr(a1),RealPtr(a2)) )
+    Transform2x2<dcomplex>( n, gamma11, gamma12, gamma21, gamma22, a1, a2 );
+}
+
+#undef EL_SIMD_DISPATCH
+
+} // namespace simd
+} // namespace El
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// AVX2/FMA packs of doubles and floats for the kernels in ./kernels.hpp.
+// This file is included (within a namespace) by src/core/SIMD.cpp, which
+// defines EL_SIMD_TARGET.
+
+struct PackD
+{
+    typedef double Real;
+    typedef __m256d Reg;
+    typedef __m256d Mask;
+    static const Int width = 4;
+
+    static EL_SIMD_TARGET Reg Zero() { return _mm256_setzero_pd(); }
+    static EL_SIMD_TARGET Reg Broadcast( Real alpha )
+    { return _mm256_set1_pd(alpha); }
+    static EL_SIMD_TARGET Reg Load( const Real* x )
+    { return _mm256_loadu_pd(x); }
+    static EL_SIMD_TARGET void Store( Real* x, Reg a )
+    { _mm256_storeu_pd(x,a); }
+
+    static EL_SIMD_TARGET Reg Add( Reg a, Reg b ) { return _mm256_add_pd(a,b); }
+    static EL_SIMD_TARGET Reg Sub( Reg a, Reg b ) { return _mm256_sub_pd(a,b); }
+    static EL_SIMD_TARGET Reg Mul( Reg a, Reg b ) { return _mm256_mul_pd(a,b); }
+    // a b + c
+    static EL_SIMD_TARGET Reg FMA( Reg a, Reg b, Reg c )
+    { return _mm256_fmadd_pd(a,b,c); }
+    // a b - c
+    static EL_SIMD_TARGET Reg FMS( Reg a, Reg b, Reg c )
+    { return _mm256_fmsub_pd(a,b,c); }
+    // a b - c in the even lanes and a b + c in the odd lanes
+    static EL_SIMD_TARGET Reg FMAddSub( Reg a, Reg b, Reg c )
+    { return _mm256_fmaddsub_pd(a,b,c); }
+    static EL_SIMD_TARGET Reg Abs( Reg a )
+    { return _mm256_andnot_pd(_mm256_set1_pd(-0.),a); }
+
+    static EL_SIMD_TARGET Mask Greater( Reg a, Reg b )
+    { return _mm256_cmp_pd(a,b,_CMP_GT_OQ); }
+    // mask ? a : b
+    static EL_SIMD_TARGET Reg Select( Mask mask, Reg a, Reg b )
+    { return _mm256_blendv_pd(b,a,mask); }
+
+    // Permutations within (real,imaginary) pairs
+    static EL_SIMD_TARGET Reg SwapPairs( Reg a )
+    { return _mm256_permute_pd(a,0x5); }
+    static EL_SIMD_TARGET Reg DupEven( Reg a ) { return _mm256_movedup_pd(a); }
+    static EL_SIMD_TARGET Reg DupOdd( Reg a )
+    { return _mm256_permute_pd(a,0xF); }
+    static EL_SIMD_TARGET Reg UnpackLow( Reg a, Reg b )
+    { return _mm256_unpacklo_pd(a,b); }
+    static EL_SIMD_TARGET Reg UnpackHigh( Reg a, Reg b )
+    { return _mm256_unpackhi_pd(a,b); }
+
+    // (0,1,2,...), (0,0,1,1,...), and (1,-1,1,-1,...)
+    static EL_SIMD_TARGET Reg Iota() { return _mm256_set_pd(3,2,1,0); }
+    static EL_SIMD_TARGET Reg PairIota() { return _mm256_set_pd(1,1,0,0); }
+    static EL_SIMD_TARGET Reg AlternatingSigns()
+    { return _mm256_set_pd(-1,1,-1,1); }
+
+    static EL_SIMD_TARGET Real Sum( Reg a )
+    {
+        __m128d b = _mm_add_pd
+          ( _mm256_castpd256_pd128(a), _mm256_extractf128_pd(a,1) );
+        return _mm_cvtsd_f64( _mm_add_sd(b,_mm_unpackhi_pd(b,b)) );
+    }
+};
+
+struct PackF
+{
+    typedef float Real;
+    typedef __m256 Reg;
+    typedef __m256 Mask;
+    typedef PackD Wide;
+    static const Int width = 8;
+
+    static EL_SIMD_TARGET Reg Zero() { return _mm256_setzero_ps(); }
+    static EL_SIMD_TARGET Reg Broadcast( Real alpha )
+    { return _mm256_set1_ps(alpha); }
+    static EL_SIMD_TARGET Reg Load( const Real* x )
+    { return _mm256_loadu_ps(x); }
+    static EL_SIMD_TARGET void Store( Real* x, Reg a )
+    { _mm256_storeu_ps(x,a); }
+
+    static EL_SIMD_TARGET Reg Add( Reg a, Reg b ) { return _mm256_add_ps(a,b); }
+    static EL_SIMD_TARGET Reg Sub( Reg a, Reg b ) { return _mm256_sub_ps(a,b); }
+    static EL_SIMD_TARGET Reg Mul( Reg a, Reg b ) { return _mm256_mul_ps(a,b); }
+    static EL_SIMD_TARGET Reg FMA( Reg a, Reg b, Reg c )
+    { return _mm256_fmadd_ps(a,b,c); }
+    static EL_SIMD_TARGET Reg FMS( Reg a, Reg b, Reg c )
+    { return _mm256_fmsub_ps(a,b,c); }
+    static EL_SIMD_TARGET Reg FMAddSub( Reg a, Reg b, Reg c )
+    { return _mm256_fmaddsub_ps(a,b,c); }
+    static EL_SIMD_TARGET Reg Abs( Reg a )
+    { return _mm256_andnot_ps(_mm256_set1_ps(-0.f),a); }
+
+    static EL_SIMD_TARGET Mask Greater( Reg a, Reg b )
+    { return _mm256_cmp_ps(a,b,_CMP_GT_OQ); }
+    static EL_SIMD_TARGET Reg Select( Mask mask, Reg a, Reg b )
+    { return _mm256_blendv_ps(b,a,mask); }
+
+    static EL_SIMD_TARGET Reg SwapPairs( Reg a )
+    { return _mm256_permute_ps(a,0xB1); }
+    static EL_SIMD_TARGET Reg DupEven( Reg a ) { return _mm256_moveldup_ps(a); }
+    static EL_SIMD_TARGET Reg DupOdd( Reg a ) { return _mm256_movehdup_ps(a); }
+
+    static EL_SIMD_TARGET Reg Iota() { return _mm256_set_ps(7,6,5,4,3,2,1,0); }
+    static EL_SIMD_TARGET Reg PairIota()
+    { return _mm256_set_ps(3,3,2,2,1,1,0,0); }
+    static EL_SIMD_TARGET Reg AlternatingSigns()
+    { return _mm256_set_ps(-1,1,-1,1,-1,1,-1,1); }
+
+    // Convert the lower and upper halves to double precision
+    static EL_SIMD_TARGET Wide::Reg WidenLow( Reg a )
+    { return _mm256_cvtps_pd(_mm256_castps256_ps128(a)); }
+    static EL_SIMD_TARGET Wide::Reg WidenHigh( Reg a )
+    { return _mm256_cvtps_pd(_mm256_extractf128_ps(a,1)); }
+
+    static EL_SIMD_TARGET Real Sum( Reg a )
+    {
+        __m128 b = _mm_add_ps
+          ( _mm256_castps256_ps128(a), _mm256_extractf128_ps(a,1) );
+        b = _mm_add_ps( b, _mm_movehl_ps(b,b) );
+        return _mm_cvtss_f32( _mm_add_ss(b,_mm_shuffle_ps(b,b,0x55)) );
+    }
+};
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// AVX-512F packs of doubles and floats for the kernels in ./kernels.hpp.
+// This file is included (within a namespace) by src/core/SIMD.cpp, which
+// defines EL_SIMD_TARGET. Only AVX-512 Foundation instructions are used.
+
+struct PackD
+{
+    typedef double Real;
+    typedef __m512d Reg;
+    typedef __mmask8 Mask;
+    static const Int width = 8;
+
+    static EL_SIMD_TARGET Reg Zero() { return _mm512_setzero_pd(); }
+    static EL_SIMD_TARGET Reg Broadcast( Real alpha )
+    { return _mm512_set1_pd(alpha); }
+    static EL_SIMD_TARGET Reg Load( const Real* x )
+    { return _mm512_loadu_pd(x); }
+    static EL_SIMD_TARGET void Store( Real* x, Reg a )
+    { _mm512_storeu_pd(x,a); }
+
+    static EL_SIMD_TARGET Reg Add( Reg a, Reg b ) { return _mm512_add_pd(a,b); }
+    static EL_SIMD_TARGET Reg Sub( Reg a, Reg b ) { return _mm512_sub_pd(a,b); }
+    static EL_SIMD_TARGET Reg Mul( Reg a, Reg b ) { return _mm512_mul_pd(a,b); }
+    // a b + c
+    static EL_SIMD_TARGET Reg FMA( Reg a, Reg b, Reg c )
+    { return _mm512_fmadd_pd(a,b,c); }
+    // a b - c
+    static EL_SIMD_TARGET Reg FMS( Reg a, Reg b, Reg c )
+    { return _mm512_fmsub_pd(a,b,c); }
+    // a b - c in the even lanes and a b + c in the odd lanes
+    static EL_SIMD_TARGET Reg FMAddSub( Reg a, Reg b, Reg c )
+    { return _mm512_fmaddsub_pd(a,b,c); }
+    static EL_SIMD_TARGET Reg Abs( Reg a )
+    {
+        return _mm512_castsi512_pd
+          ( _mm512_and_epi64
+            ( _mm512_castpd_si512(a),
+              _mm512_set1_epi64(0x7FFFFFFFFFFFFFFFLL) ) );
+    }
+
+    static EL_SIMD_TARGET Mask Greater( Reg a, Reg b )
+    { return _mm512_cmp_pd_mask(a,b,_CMP_GT_OQ); }
+    // mask ? a : b
+    static EL_SIMD_TARGET Reg Select( Mask mask, Reg a, Reg b )
+    { return _mm512_mask_blend_pd(mask,b,a); }
+
+    // Permutations within (real,imaginary) pairs
+    static EL_SIMD_TARGET Reg SwapPairs( Reg a )
+    { return _mm512_permute_pd(a,0x55); }
+    static EL_SIMD_TARGET Reg DupEven( Reg a ) { return _mm512_movedup_pd(a); }
+    static EL_SIMD_TARGET Reg DupOdd( Reg a )
+    { return _mm512_permute_pd(a,0xFF); }
+    static EL_SIMD_TARGET Reg UnpackLow( Reg a, Reg b )
+    { return _mm512_unpacklo_pd(a,b); }
+    static EL_SIMD_TARGET Reg UnpackHigh( Reg a, Reg b )
+    { return _mm512_unpackhi_pd(a,b); }
+
+    // (0,1,2,...), (0,0,1,1,...), and (1,-1,1,-1,...)
+    static EL_SIMD_TARGET Reg Iota()
+    { return _mm512_set_pd(7,6,5,4,3,2,1,0); }
+    static EL_SIMD_TARGET Reg PairIota()
+    { return _mm512_set_pd(3,3,2,2,1,1,0,0); }
+    static EL_SIMD_TARGET Reg AlternatingSigns()
+    { return _mm512_set_pd(-1,1,-1,1,-1,1,-1,1); }
+
+    static EL_SIMD_TARGET Real Sum( Reg a )
+    {
+        const __m256d b = _mm256_add_pd
+          ( _mm512_castpd512_pd256(a), _mm512_extractf64x4_pd(a,1) );
+        __m128d c = _mm_add_pd
+          ( _mm256_castpd256_pd128(b), _mm256_extractf128_pd(b,1) );
+        return _mm_cvtsd_f64( _mm_add_sd(c,_mm_unpackhi_pd(c,c)) );
+    }
+};
+
+struct PackF
+{
+    typedef float Real;
+    typedef __m512 Reg;
+    typedef __mmask16 Mask;
+    typedef PackD Wide;
+    static const Int width = 16;
+
+    static EL_SIMD_TARGET Reg Zero() { return _mm512_setzero_ps(); }
+    static EL_SIMD_TARGET Reg Broadcast( Real alpha )
+    { return _mm512_set1_ps(alpha); }
+    static EL_SIMD_TARGET Reg Load( const Real* x )
+    { return _mm512_loadu_ps(x); }
+    static EL_SIMD_TARGET void Store( Real* x, Reg a )
+    { _mm512_storeu_ps(x,a); }
+
+    static EL_SIMD_TARGET Reg Add( Reg a, Reg b ) { return _mm512_add_ps(a,b); }
+    static EL_SIMD_TARGET Reg Sub( Reg a, Reg b ) { return _mm512_sub_ps(a,b); }
+    static EL_SIMD_TARGET Reg Mul( Reg a, Reg b ) { return _mm512_mul_ps(a,b); }
+    static EL_SIMD_TARGET Reg FMA( Reg a, Reg b, Reg c )
+    { return _mm512_fmadd_ps(a,b,c); }
+    static EL_SIMD_TARGET Reg FMS( Reg a, Reg b, Reg c )
+    { return _mm512_fmsub_ps(a,b,c); }
+    static EL_SIMD_TARGET Reg FMAddSub( Reg a, Reg b, Reg c )
+    { return _mm512_fmaddsub_ps(a,b,c); }
+    static EL_SIMD_TARGET Reg Abs( Reg a )
+    {
+        return _mm512_castsi512_ps
+          ( _mm512_and_epi32
+            ( _mm512_castps_si512(a), _mm512_set1_epi32(0x7FFFFFFF) ) );
+    }
+
+    static EL_SIMD_TARGET Mask Greater( Reg a, Reg b )
+    { return _mm512_cmp_ps_mask(a,b,_CMP_GT_OQ); }
+    static EL_SIMD_TARGET Reg Select( Mask mask, Reg a, Reg b )
+    { return _mm512_mask_blend_ps(mask,b,a); }
+
+    static EL_SIMD_TARGET Reg SwapPairs( Reg a )
+    { return _mm512_permute_ps(a,0xB1); }
+    static EL_SIMD_TARGET Reg DupEven( Reg a ) { return _mm512_moveldup_ps(a); }
+    static EL_SIMD_TARGET Reg DupOdd( Reg a ) { return _mm512_movehdup_ps(a); }
+
+    static EL_SIMD_TARGET Reg Iota()
+    { return _mm512_set_ps(15,14,13,12,11,10,9,8,7,6,5,4,3,2,1,0); }
+    static EL_SIMD_TARGET Reg PairIota()
+    { return _mm512_set_ps(7,7,6,6,5,5,4,4,3,3,2,2,1,1,0,0); }
+    static EL_SIMD_TARGET Reg AlternatingSigns()
+    { return _mm512_set_ps(-1,1,-1,1,-1,1,-1,1,-1,1,-1,1,-1,1,-1,1); }
+
+    // Convert the lower and upper halves to double precision
+    static EL_SIMD_TARGET Wide::Reg WidenLow( Reg a )
+    { return _mm512_cvtps_pd(_mm512_castps512_ps256(a)); }
+    static EL_SIMD_TARGET Wide::Reg WidenHigh( Reg a )
+    {
+        return _mm512_cvtps_pd
+          ( _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a),1)) );
+    }
+
+    static EL_SIMD_TARGET Real Sum( Reg a )
+    {
+        const __m256 b = _mm256_add_ps
+          ( _mm512_castps512_ps256(a),
+            _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a),1)) );
+        __m128 c = _mm_add_ps
+          ( _mm256_castps256_ps128(b), _mm256_extractf128_ps(b,1) );
+        c = _mm_add_ps( c, _mm_movehl_ps(c,c) );
+        return _mm_cvtss_f32( _mm_add_ss(c,_mm_shuffle_ps(c,c,0x55)) );
+    }
+};
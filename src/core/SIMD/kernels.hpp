@@ -0,0 +1,460 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Level-1 kernels written in terms of a pack P of P::width reals (see
+// ./AVX2.hpp and ./AVX512.hpp). This file is included once per instruction
+// set by src/core/SIMD.cpp, with EL_SIMD_TARGET set to the corresponding
+// target attribute, so that every function is compiled for that instruction
+// set alone. Complex data is treated as interleaved (real,imaginary) pairs.
+
+template<class P>
+EL_SIMD_TARGET
+typename P::Real Dot
+( Int n, const typename P::Real* x, const typename P::Real* y )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+
+    Reg acc0=P::Zero(), acc1=P::Zero(), acc2=P::Zero(), acc3=P::Zero();
+    Int i=0;
+    for( ; i+4*w<=n; i+=4*w )
+    {
+        acc0 = P::FMA( P::Load(&x[i    ]), P::Load(&y[i    ]), acc0 );
+        acc1 = P::FMA( P::Load(&x[i+  w]), P::Load(&y[i+  w]), acc1 );
+        acc2 = P::FMA( P::Load(&x[i+2*w]), P::Load(&y[i+2*w]), acc2 );
+        acc3 = P::FMA( P::Load(&x[i+3*w]), P::Load(&y[i+3*w]), acc3 );
+    }
+    for( ; i+w<=n; i+=w )
+        acc0 = P::FMA( P::Load(&x[i]), P::Load(&y[i]), acc0 );
+    Real alpha = P::Sum( P::Add(P::Add(acc0,acc1),P::Add(acc2,acc3)) );
+    for( ; i<n; ++i )
+        alpha += x[i]*y[i];
+    return alpha;
+}
+
+// x^H y for n complex entries
+template<class P>
+EL_SIMD_TARGET
+Complex<typename P::Real> ComplexDot
+( Int n, const typename P::Real* x, const typename P::Real* y )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+    const Int m = 2*n;
+
+    // The even and odd lanes of accRe hold sums of xr yr and xi yi, while
+    // those of accIm hold sums of xr yi and xi yr
+    Reg accRe0=P::Zero(), accRe1=P::Zero(), accIm0=P::Zero(), accIm1=P::Zero();
+    Int i=0;
+    for( ; i+2*w<=m; i+=2*w )
+    {
+        const Reg x0 = P::Load(&x[i]), x1 = P::Load(&x[i+w]);
+        const Reg y0 = P::Load(&y[i]), y1 = P::Load(&y[i+w]);
+        accRe0 = P::FMA( x0, y0, accRe0 );
+        accRe1 = P::FMA( x1, y1, accRe1 );
+        accIm0 = P::FMA( x0, P::SwapPairs(y0), accIm0 );
+        accIm1 = P::FMA( x1, P::SwapPairs(y1), accIm1 );
+    }
+    for( ; i+w<=m; i+=w )
+    {
+        const Reg x0 = P::Load(&x[i]), y0 = P::Load(&y[i]);
+        accRe0 = P::FMA( x0, y0, accRe0 );
+        accIm0 = P::FMA( x0, P::SwapPairs(y0), accIm0 );
+    }
+    Real alphaRe = P::Sum( P::Add(accRe0,accRe1) );
+    Real alphaIm =
+      P::Sum( P::Mul(P::Add(accIm0,accIm1),P::AlternatingSigns()) );
+    for( ; i<m; i+=2 )
+    {
+        alphaRe += x[i]*y[i] + x[i+1]*y[i+1];
+        alphaIm += x[i]*y[i+1] - x[i+1]*y[i];
+    }
+    return Complex<Real>(alphaRe,alphaIm);
+}
+
+// The sum of the squares of n floats, accumulated in double precision
+template<class P>
+EL_SIMD_TARGET
+double WidenedSumOfSquares( Int n, const float* x )
+{
+    typedef typename P::Wide W;
+    const Int w = P::width;
+
+    typename W::Reg acc0=W::Zero(), acc1=W::Zero();
+    Int i=0;
+    for( ; i+w<=n; i+=w )
+    {
+        const typename P::Reg xv = P::Load(&x[i]);
+        const typename W::Reg xLow = P::WidenLow(xv), xHigh = P::WidenHigh(xv);
+        acc0 = W::FMA( xLow, xLow, acc0 );
+        acc1 = W::FMA( xHigh, xHigh, acc1 );
+    }
+    double sum = W::Sum( W::Add(acc0,acc1) );
+    for( ; i<n; ++i )
+        sum += double(x[i])*double(x[i]);
+    return sum;
+}
+
+// Lane indices are tracked in floating-point arithmetic, which is exact for
+// blocks of at most 2^20 entries, and ties are resolved in favor of the
+// smallest index so that the result matches a sequential search
+
+template<class P>
+EL_SIMD_TARGET
+Int MaxAbsInd( Int n, const typename P::Real* x )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+    const Int blocksize = Int(1) << 20;
+    const Int nVec = n - n % w;
+
+    Real maxAbsVal = -1;
+    Int maxAbsInd = -1;
+    Real vals[P::width], inds[P::width];
+    for( Int off=0; off<nVec; off+=blocksize )
+    {
+        const Int offEnd = Min(off+blocksize,nVec);
+        const Reg step = P::Broadcast( Real(w) );
+        Reg bestVal = P::Broadcast(-1), bestInd = P::Zero(), ind = P::Iota();
+        for( Int i=off; i<offEnd; i+=w )
+        {
+            const Reg val = P::Abs( P::Load(&x[i]) );
+            const typename P::Mask mask = P::Greater( val, bestVal );
+            bestVal = P::Select( mask, val, bestVal );
+            bestInd = P::Select( mask, ind, bestInd );
+            ind = P::Add( ind, step );
+        }
+        P::Store( vals, bestVal );
+        P::Store( inds, bestInd );
+        for( Int l=0; l<w; ++l )
+        {
+            const Int i = off + Int(inds[l]);
+            if( vals[l] > maxAbsVal || (vals[l] == maxAbsVal && i < maxAbsInd) )
+            {
+                maxAbsVal = vals[l];
+                maxAbsInd = i;
+            }
+        }
+    }
+    for( Int i=nVec; i<n; ++i )
+    {
+        const Real absVal = Abs(x[i]);
+        if( absVal > maxAbsVal )
+        {
+            maxAbsVal = absVal;
+            maxAbsInd = i;
+        }
+    }
+    return maxAbsInd;
+}
+
+// The comparisons are between squared magnitudes, so the caller is responsible
+// for falling back to a scaled search if the maximum overflowed or underflowed
+template<class P>
+EL_SIMD_TARGET
+Int ComplexMaxAbsInd( Int n, const typename P::Real* x )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width/2;
+    const Int blocksize = Int(1) << 20;
+    const Int nVec = n - n % w;
+
+    Real maxSqVal = -1;
+    Int maxSqInd = -1;
+    Real vals[P::width], inds[P::width];
+    for( Int off=0; off<nVec; off+=blocksize )
+    {
+        const Int offEnd = Min(off+blocksize,nVec);
+        const Reg step = P::Broadcast( Real(w) );
+        Reg bestVal = P::Broadcast(-1), bestInd = P::Zero(),
+            ind = P::PairIota();
+        for( Int i=off; i<offEnd; i+=w )
+        {
+            const Reg xv = P::Load(&x[2*i]);
+            const Reg sq = P::Mul( xv, xv );
+            const Reg val = P::Add( sq, P::SwapPairs(sq) );
+            const typename P::Mask mask = P::Greater( val, bestVal );
+            bestVal = P::Select( mask, val, bestVal );
+            bestInd = P::Select( mask, ind, bestInd );
+            ind = P::Add( ind, step );
+        }
+        P::Store( vals, bestVal );
+        P::Store( inds, bestInd );
+        for( Int l=0; l<P::width; ++l )
+        {
+            const Int i = off + Int(inds[l]);
+            if( vals[l] > maxSqVal || (vals[l] == maxSqVal && i < maxSqInd) )
+            {
+                maxSqVal = vals[l];
+                maxSqInd = i;
+            }
+        }
+    }
+    for( Int i=nVec; i<n; ++i )
+    {
+        const Real sqVal = x[2*i]*x[2*i] + x[2*i+1]*x[2*i+1];
+        if( sqVal > maxSqVal )
+        {
+            maxSqVal = sqVal;
+            maxSqInd = i;
+        }
+    }
+    return maxSqInd;
+}
+
+template<class P>
+EL_SIMD_TARGET
+void Hadamard
+( Int n,
+  const typename P::Real* a,
+  const typename P::Real* b,
+        typename P::Real* c )
+{
+    const Int w = P::width;
+    Int i=0;
+    for( ; i+w<=n; i+=w )
+        P::Store( &c[i], P::Mul(P::Load(&a[i]),P::Load(&b[i])) );
+    for( ; i<n; ++i )
+        c[i] = a[i]*b[i];
+}
+
+template<class P>
+EL_SIMD_TARGET
+void ComplexHadamard
+( Int n,
+  const typename P::Real* a,
+  const typename P::Real* b,
+        typename P::Real* c )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+    const Int m = 2*n;
+    Int i=0;
+    for( ; i+w<=m; i+=w )
+    {
+        const Reg av = P::Load(&a[i]), bv = P::Load(&b[i]);
+        P::Store
+        ( &c[i],
+          P::FMAddSub
+          ( av, P::DupEven(bv), P::Mul(P::SwapPairs(av),P::DupOdd(bv)) ) );
+    }
+    for( ; i<m; i+=2 )
+    {
+        const Real aRe=a[i], aIm=a[i+1], bRe=b[i], bIm=b[i+1];
+        c[i  ] = aRe*bRe - aIm*bIm;
+        c[i+1] = aRe*bIm + aIm*bRe;
+    }
+}
+
+template<class P>
+EL_SIMD_TARGET
+void Transform2x2
+( Int n,
+  typename P::Real gamma11, typename P::Real gamma12,
+  typename P::Real gamma21, typename P::Real gamma22,
+  typename P::Real* a1, typename P::Real* a2 )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+    const Reg g11 = P::Broadcast(gamma11), g12 = P::Broadcast(gamma12),
+              g21 = P::Broadcast(gamma21), g22 = P::Broadcast(gamma22);
+    Int i=0;
+    for( ; i+w<=n; i+=w )
+    {
+        const Reg x1 = P::Load(&a1[i]), x2 = P::Load(&a2[i]);
+        P::Store( &a1[i], P::FMA(g11,x1,P::Mul(g12,x2)) );
+        P::Store( &a2[i], P::FMA(g21,x1,P::Mul(g22,x2)) );
+    }
+    for( ; i<n; ++i )
+    {
+        const Real temp = gamma11*a1[i] + gamma12*a2[i];
+        a2[i] = gamma21*a1[i] + gamma22*a2[i];
+        a1[i] = temp;
+    }
+}
+
+// gamma x for a complex scalar gamma = gammaRe + i gammaIm
+template<class P>
+EL_SIMD_TARGET
+typename P::Reg ComplexScale
+( typename P::Reg gammaRe, typename P::Reg gammaIm, typename P::Reg x )
+{ return P::FMAddSub( x, gammaRe, P::Mul(P::SwapPairs(x),gammaIm) ); }
+
+// The 2x2 transformation is stored as the (real,imaginary) pairs of
+// gamma11, gamma12, gamma21, and gamma22
+template<class P>
+EL_SIMD_TARGET
+void ComplexTransform2x2
+( Int n, const typename P::Real* gamma,
+  typename P::Real* a1, typename P::Real* a2 )
+{
+    typedef typename P::Real Real;
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+    const Int m = 2*n;
+    Reg gRe[4], gIm[4];
+    for( Int k=0; k<4; ++k )
+    {
+        gRe[k] = P::Broadcast(gamma[2*k]);
+        gIm[k] = P::Broadcast(gamma[2*k+1]);
+    }
+    Int i=0;
+    for( ; i+w<=m; i+=w )
+    {
+        const Reg x1 = P::Load(&a1[i]), x2 = P::Load(&a2[i]);
+        P::Store
+        ( &a1[i],
+          P::Add
+          ( ComplexScale<P>(gRe[0],gIm[0],x1),
+            ComplexScale<P>(gRe[1],gIm[1],x2) ) );
+        P::Store
+        ( &a2[i],
+          P::Add
+          ( ComplexScale<P>(gRe[2],gIm[2],x1),
+            ComplexScale<P>(gRe[3],gIm[3],x2) ) );
+    }
+    for( ; i<m; i+=2 )
+    {
+        const Real x1Re=a1[i], x1Im=a1[i+1], x2Re=a2[i], x2Im=a2[i+1];
+        a1[i  ] = gamma[0]*x1Re - gamma[1]*x1Im + gamma[2]*x2Re - gamma[3]*x2Im;
+        a1[i+1] = gamma[0]*x1Im + gamma[1]*x1Re + gamma[2]*x2Im + gamma[3]*x2Re;
+        a2[i  ] = gamma[4]*x1Re - gamma[5]*x1Im + gamma[6]*x2Re - gamma[7]*x2Im;
+        a2[i+1] = gamma[4]*x1Im + gamma[5]*x1Re + gamma[6]*x2Im + gamma[7]*x2Re;
+    }
+}
+
+// Double-double arithmetic
+// ========================
+// Each lane holds an independent (high,low) accumulator which is updated
+// with the same error-free transformations as QD's IEEE-style addition and
+// FMA-based multiplication; the lanes are combined at the end.
+
+template<class P>
+EL_SIMD_TARGET
+void TwoSum
+( typename P::Reg a, typename P::Reg b,
+  typename P::Reg& s, typename P::Reg& e )
+{
+    s = P::Add( a, b );
+    const typename P::Reg bb = P::Sub( s, a );
+    e = P::Add( P::Sub(a,P::Sub(s,bb)), P::Sub(b,bb) );
+}
+
+template<class P>
+EL_SIMD_TARGET
+void QuickTwoSum( typename P::Reg& a, typename P::Reg& b )
+{
+    const typename P::Reg s = P::Add( a, b );
+    b = P::Sub( b, P::Sub(s,a) );
+    a = s;
+}
+
+// (aHi,aLo) := (aHi,aLo) + (bHi,bLo)
+template<class P>
+EL_SIMD_TARGET
+void DoubleDoubleUpdate
+( typename P::Reg& aHi, typename P::Reg& aLo,
+  typename P::Reg  bHi, typename P::Reg  bLo )
+{
+    typename P::Reg s1, s2, t1, t2;
+    TwoSum<P>( aHi, bHi, s1, s2 );
+    TwoSum<P>( aLo, bLo, t1, t2 );
+    s2 = P::Add( s2, t1 );
+    QuickTwoSum<P>( s1, s2 );
+    s2 = P::Add( s2, t2 );
+    QuickTwoSum<P>( s1, s2 );
+    aHi = s1;
+    aLo = s2;
+}
+
+EL_SIMD_TARGET
+inline void TwoSum( double a, double b, double& s, double& e )
+{
+    s = a + b;
+    const double bb = s - a;
+    e = (a-(s-bb)) + (b-bb);
+}
+
+EL_SIMD_TARGET
+inline void QuickTwoSum( double& a, double& b )
+{
+    const double s = a + b;
+    b = b - (s-a);
+    a = s;
+}
+
+EL_SIMD_TARGET
+inline void DoubleDoubleUpdate
+( double& aHi, double& aLo, double bHi, double bLo )
+{
+    double s1, s2, t1, t2;
+    TwoSum( aHi, bHi, s1, s2 );
+    TwoSum( aLo, bLo, t1, t2 );
+    s2 += t1;
+    QuickTwoSum( s1, s2 );
+    s2 += t2;
+    QuickTwoSum( s1, s2 );
+    aHi = s1;
+    aLo = s2;
+}
+
+// sum := x^T y, where x and y are arrays of n (high,low) pairs
+template<class P>
+EL_SIMD_TARGET
+void DoubleDoubleDot( Int n, const double* x, const double* y, double* sum )
+{
+    typedef typename P::Reg Reg;
+    const Int w = P::width;
+
+    Reg accHi=P::Zero(), accLo=P::Zero();
+    Int i=0;
+    for( ; i+w<=n; i+=w )
+    {
+        // Separate the high and low words of w consecutive entries (the
+        // resulting lane order is the same for x and y)
+        const Reg x0 = P::Load(&x[2*i]), x1 = P::Load(&x[2*i+w]);
+        const Reg y0 = P::Load(&y[2*i]), y1 = P::Load(&y[2*i+w]);
+        const Reg xHi = P::UnpackLow(x0,x1), xLo = P::UnpackHigh(x0,x1);
+        const Reg yHi = P::UnpackLow(y0,y1), yLo = P::UnpackHigh(y0,y1);
+
+        // (pHi,pLo) := x y
+        Reg pHi = P::Mul( xHi, yHi );
+        Reg pLo = P::FMS( xHi, yHi, pHi );
+        pLo = P::FMA( xHi, yLo, pLo );
+        pLo = P::FMA( xLo, yHi, pLo );
+        QuickTwoSum<P>( pHi, pLo );
+
+        DoubleDoubleUpdate<P>( accHi, accLo, pHi, pLo );
+    }
+
+    double his[P::width], los[P::width];
+    P::Store( his, accHi );
+    P::Store( los, accLo );
+    double sumHi=0, sumLo=0;
+    for( Int l=0; l<w; ++l )
+        DoubleDoubleUpdate( sumHi, sumLo, his[l], los[l] );
+    for( ; i<n; ++i )
+    {
+        const double xHi=x[2*i], xLo=x[2*i+1], yHi=y[2*i], yLo=y[2*i+1];
+        double pHi = xHi*yHi;
+        double pLo = std::fma( xHi, yHi, -pHi );
+        pLo = std::fma( xHi, yLo, pLo );
+        pLo = std::fma( xLo, yHi, pLo );
+        QuickTwoSum( pHi, pLo );
+        DoubleDoubleUpdate( sumHi, sumLo, pHi, pLo );
+    }
+    sum[0] = sumHi;
+    sum[1] = sumLo;
+}
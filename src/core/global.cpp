@@ -11,8 +11,9 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <atomic>
+#include <cstdlib>
 #include <set>
-#include <stack>
 
 #ifdef EL_HAVE_QT5
  #include <QApplication>
@@ -27,15 +28,43 @@ bool elemInitializedMpi = false;
 unsigned oldControlWord=0;
 #endif
 
-std::stack<Int> blocksizeStack;
 Grid* defaultGrid = 0;
 Args* args = 0;
 
 // Default blocksizes for BlockMatrix
 Int blockHeight=32, blockWidth=32;
 
-// A common Mersenne twister configuration
-std::mt19937 generator;
+// The number of threads for packing redistribution buffers (zero defers to
+// the OpenMP default)
+Int packingThreads = 0;
+
+// Parse a positive number of packing threads from a runtime argument
+Int ParsePackingThreads( const char* str )
+{
+    char* end;
+    const long numThreads = std::strtol( str, &end, 10 );
+    if( end == str || *end != '\0' || numThreads <= 0 )
+        LogicError("Invalid number of packing threads: \"",str,"\"");
+    return numThreads;
+}
+
+// The default algorithmic blocksize
+const Int defaultBlocksize = 128;
+
+// Each thread's own context and the (optional) explicitly installed one
+thread_local Context threadContext;
+thread_local Context* activeContext = nullptr;
+
+// The rank within COMM_WORLD, cached during Initialize so that the contexts
+// lazily created by (non-main) threads never need to query MPI
+int worldRank = 0;
+
+// Used to give each newly created context a distinct random seed
+std::atomic<unsigned long> numContexts(0);
+
+// TODO: Allow for switching on/off reproducibility?
+//const long secs = time(NULL);
+const long secs = 21;
 
 #ifdef EL_HAVE_MPC
 gmp_randstate_t gmpRandState;
@@ -43,10 +72,23 @@ gmp_randstate_t gmpRandState;
 
 // Debugging
 DEBUG_ONLY(
-  std::stack<string> callStack;
   bool tracingEnabled = false;
 )
 
+// Profiling which was requested at runtime and is reported during Finalize
+bool printProfile = false;
+string profileJSONFile, profileTraceFile;
+
+// Whether the MPI traffic counters should be printed during Finalize
+bool printTraffic = false;
+
+// A blocksize tuning file which was requested at runtime
+string blocksizeTuningFile;
+
+// A cost model file, or a calibration of the cost model, requested at runtime
+string costModelFile;
+bool calibrateCostModel = false;
+
 // A (per-process) output file for logging
 std::ofstream logFile;
 
@@ -400,10 +442,10 @@ void Initialize( int& argc, char**& argv )
     }
 #endif
 
+    ::worldRank = mpi::Rank( mpi::COMM_WORLD );
+
     // Queue a default algorithmic blocksize
-    while( ! ::blocksizeStack.empty() )
-        ::blocksizeStack.pop();
-    ::blocksizeStack.push( 128 );
+    ThreadContext().ResetBlocksizeStack();
 
     // Build the default grid
     defaultGrid = new Grid( mpi::COMM_WORLD );
@@ -413,12 +455,9 @@ void Initialize( int& argc, char**& argv )
     fpu_fix_start( &::oldControlWord );
 #endif
 
-    const unsigned rank = mpi::Rank( mpi::COMM_WORLD );
-    // TODO: Allow for switching on/off reproducibility?
-    //const long secs = time(NULL);
-    const long secs = 21;
-    const long seed = (secs<<16) | (rank & 0xFFFF);
-    ::generator.seed( seed );
+    const unsigned rank = ::worldRank;
+    const long seed = (::secs<<16) | (rank & 0xFFFF);
+    ThreadContext().Seed( seed );
     srand( seed );
 #ifdef EL_HAVE_MPC
     mpc::SetMinIntBits( 256 );
@@ -430,6 +469,60 @@ void Initialize( int& argc, char**& argv )
     // Create the types and ops
     // NOTE: mpc::SetPrecision created the BigFloat types
     mpi::CreateCustom();
+
+    // Enable profiling and traffic accounting if they were requested at runtime
+    // (command-line arguments take precedence over the environment)
+    const char* packingThreadsArg = nullptr;
+    for( int i=1; i<argc; ++i )
+    {
+        const string arg = argv[i];
+        if( arg == "--profile" )
+            ::printProfile = true;
+        else if( arg == "--profile-json" && i+1 < argc )
+            ::profileJSONFile = argv[++i];
+        else if( arg == "--profile-trace" && i+1 < argc )
+            ::profileTraceFile = argv[++i];
+        else if( arg == "--mpi-traffic" )
+            ::printTraffic = true;
+        else if( arg == "--blocksize-tuning" && i+1 < argc )
+            ::blocksizeTuningFile = argv[++i];
+        else if( arg == "--cost-model" && i+1 < argc )
+            ::costModelFile = argv[++i];
+        else if( arg == "--calibrate-cost-model" )
+            ::calibrateCostModel = true;
+        else if( arg == "--packing-threads" && i+1 < argc )
+            packingThreadsArg = argv[++i];
+    }
+    if( packingThreadsArg == nullptr )
+        packingThreadsArg = std::getenv("EL_PACKING_THREADS");
+    if( packingThreadsArg != nullptr )
+        SetPackingThreads( ParsePackingThreads(packingThreadsArg) );
+    if( std::getenv("EL_PROFILE") != nullptr )
+        ::printProfile = true;
+    if( std::getenv("EL_MPI_TRAFFIC") != nullptr )
+        ::printTraffic = true;
+    if( ::blocksizeTuningFile.empty() &&
+        std::getenv("EL_BLOCKSIZE_TUNING") != nullptr )
+        ::blocksizeTuningFile = std::getenv("EL_BLOCKSIZE_TUNING");
+    if( ::costModelFile.empty() && std::getenv("EL_COST_MODEL") != nullptr )
+        ::costModelFile = std::getenv("EL_COST_MODEL");
+    if( std::getenv("EL_CALIBRATE_COST_MODEL") != nullptr )
+        ::calibrateCostModel = true;
+    if( ::printProfile || !::profileJSONFile.empty() ||
+        !::profileTraceFile.empty() )
+        EnableProfiling( !::profileTraceFile.empty() );
+    if( ::printTraffic )
+        mpi::EnableTrafficCounters();
+
+    // Load the tuned blocksizes
+    if( !::blocksizeTuningFile.empty() )
+        LoadBlocksizeTuning( ::blocksizeTuningFile );
+
+    // Load (or measure) the machine cost model
+    if( !::costModelFile.empty() )
+        LoadCostModel( ::costModelFile );
+    else if( ::calibrateCostModel )
+        CalibrateCostModel();
 }
 
 void Finalize()
@@ -446,6 +539,28 @@ void Finalize()
         cerr << "Warning: MPI was finalized before Elemental." << endl;
     if( ::numElemInits == 0 )
     {
+        if( ProfilingEnabled() && !mpi::Finalized() )
+        {
+            try
+            {
+                if( ::printProfile )
+                    PrintProfile();
+                if( !::profileJSONFile.empty() )
+                    WriteProfile( ::profileJSONFile, PROFILE_JSON );
+                if( !::profileTraceFile.empty() )
+                    WriteProfile( ::profileTraceFile, PROFILE_CHROME_TRACE );
+            }
+            catch( std::exception& e ) { ReportException(e); }
+            DisableProfiling();
+        }
+        if( ::printTraffic && !mpi::Finalized() )
+        {
+            try { mpi::PrintTrafficCounters(); }
+            catch( std::exception& e ) { ReportException(e); }
+            mpi::DisableTrafficCounters();
+            ::printTraffic = false;
+        }
+
         delete ::args;
         ::args = 0;
        
@@ -475,8 +590,11 @@ void Finalize()
             mpi::Finalize();
 
 
-        while( ! ::blocksizeStack.empty() )
-            ::blocksizeStack.pop();
+        ThreadContext().EmptyBlocksizeStack();
+        ClearTunedBlocksizes();
+
+        // Return the cached workspace blocks to the system
+        ReleaseMemoryPool();
 
 #ifdef EL_HAVE_QD
         // TODO: Enable and disable when entering routines using QD
@@ -498,36 +616,91 @@ Args& GetArgs()
     return *::args; 
 }
 
-Int Blocksize()
+Context::Context()
+{
+    blocksizeStack_.push( 0 );
+
+    // Give each context a distinct (but reproducible per creation order) seed
+    const unsigned long index = ::numContexts++;
+    const unsigned long seed = 
+      ((::secs<<16) | (::worldRank & 0xFFFF)) + 0x9E3779B9UL*index;
+    generator_.seed( seed );
+}
+
+Int Context::Blocksize() const
 { 
     DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack_.empty() )
           LogicError("Attempted to extract blocksize from empty stack");
     )
-    return ::blocksizeStack.top(); 
+    const Int blocksize = blocksizeStack_.top();
+    return blocksize == 0 ? ::defaultBlocksize : blocksize;
 }
 
-void SetBlocksize( Int blocksize )
+bool Context::BlocksizeSpecified() const
+{ return !blocksizeStack_.empty() && blocksizeStack_.top() != 0; }
+
+void Context::SetBlocksize( Int blocksize )
 { 
     DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack_.empty() )
           LogicError("Attempted to set blocksize at top of empty stack");
     )
-    ::blocksizeStack.top() = blocksize; 
+    blocksizeStack_.top() = blocksize; 
 }
 
-void PushBlocksizeStack( Int blocksize )
-{ ::blocksizeStack.push( blocksize ); }
+void Context::PushBlocksizeStack( Int blocksize )
+{ blocksizeStack_.push( blocksize ); }
 
-void PopBlocksizeStack()
+void Context::PopBlocksizeStack()
 {
     DEBUG_ONLY(
-      if( ::blocksizeStack.empty() )
+      if( blocksizeStack_.empty() )
           LogicError("Attempted to pop an empty blocksize stack");
     )
-    ::blocksizeStack.pop();
+    blocksizeStack_.pop();
+}
+
+void Context::ResetBlocksizeStack()
+{
+    EmptyBlocksizeStack();
+    blocksizeStack_.push( 0 );
 }
 
+void Context::EmptyBlocksizeStack()
+{
+    while( ! blocksizeStack_.empty() )
+        blocksizeStack_.pop();
+}
+
+std::mt19937& Context::Generator()
+{ return generator_; }
+
+void Context::Seed( unsigned long seed )
+{ generator_.seed( seed ); }
+
+Context& ThreadContext()
+{
+    if( ::activeContext != nullptr )
+        return *::activeContext;
+    return ::threadContext;
+}
+
+void SetThreadContext( Context* context )
+{ ::activeContext = context; }
+
+Int Blocksize()
+{ return ThreadContext().Blocksize(); }
+
+void SetBlocksize( Int blocksize )
+{ ThreadContext().SetBlocksize( blocksize ); }
+
+void PushBlocksizeStack( Int blocksize )
+{ ThreadContext().PushBlocksizeStack( blocksize ); }
+
+void PopBlocksizeStack()
+{ ThreadContext().PopBlocksizeStack(); }
+
 const Grid& DefaultGrid() EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(
@@ -552,8 +725,24 @@ void SetDefaultBlockHeight( Int mb )
 void SetDefaultBlockWidth( Int nb )
 { ::blockWidth = nb; }
 
+Int PackingThreads()
+{
+#ifdef EL_HYBRID
+    return ::packingThreads > 0 ? ::packingThreads : omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void SetPackingThreads( Int numThreads )
+{
+    if( numThreads < 0 )
+        LogicError("Invalid number of packing threads: ",numThreads);
+    ::packingThreads = numThreads;
+}
+
 std::mt19937& Generator()
-{ return ::generator; }
+{ return ThreadContext().Generator(); }
 
 #ifdef EL_HAVE_MPC
 namespace mpc {
@@ -653,22 +842,18 @@ DEBUG_ONLY(
     void EnableTracing() { ::tracingEnabled = true; }
     void DisableTracing() { ::tracingEnabled = false; }
 
-    void PushCallStack( string s )
+    void Context::PushCallStack( string s )
     { 
-#ifdef EL_HYBRID
-        if( omp_get_thread_num() != 0 )
-            return;
-#endif
         const size_t maxStackSize = 300;
-        if( ::callStack.size() > maxStackSize )
+        if( callStack_.size() > maxStackSize )
         {
             DumpCallStack();
             return;
         }
-        ::callStack.push(s); 
+        callStack_.push(s); 
         if( ::tracingEnabled )
         {
-            const int stackSize = ::callStack.size();
+            const int stackSize = callStack_.size();
             ostringstream os;
             for( int j=0; j<stackSize; ++j )
                 os << " "; 
@@ -677,30 +862,37 @@ DEBUG_ONLY(
         }
     }
 
-    void PopCallStack()
+    void Context::PopCallStack()
     { 
-#ifdef EL_HYBRID
-        if( omp_get_thread_num() != 0 )
-            return;
-#endif
-        if( ::callStack.empty() )
+        if( callStack_.empty() )
             LogicError("Attempted to pop an empty call stack");
-        ::callStack.pop(); 
+        callStack_.pop(); 
     }
 
-    void DumpCallStack( ostream& os )
+    void Context::DumpCallStack( ostream& os )
     {
         ostringstream msg;
-        while( ! ::callStack.empty() )
+        while( ! callStack_.empty() )
         {
-            msg << "[" << ::callStack.size() << "]: " << ::callStack.top() 
+            msg << "[" << callStack_.size() << "]: " << callStack_.top() 
                 << "\n";
-            ::callStack.pop();
+            callStack_.pop();
         }
         os << msg.str();
         os.flush();
     }
 
+    // Since each thread now owns its call stack, the stacks of the threads
+    // of the EL_PARALLEL_FOR loops no longer race with that of the master
+    void PushCallStack( string s )
+    { ThreadContext().PushCallStack( s ); }
+
+    void PopCallStack()
+    { ThreadContext().PopCallStack(); }
+
+    void DumpCallStack( ostream& os )
+    { ThreadContext().DumpCallStack( os ); }
+
 ) // DEBUG_ONLY
 
 void OpenLog( const char* filename )
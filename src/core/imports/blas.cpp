@@ -684,6 +684,8 @@ T Dot
   const T* x, BlasInt incx,
   const T* y, BlasInt incy )
 {
+    if( incx == 1 && incy == 1 )
+        return simd::Dot( Int(n), x, y );
     T alpha = 0;
     for( BlasInt i=0; i<n; ++i )
         alpha += Conj(x[i*incx])*y[i*incy];
@@ -811,6 +813,8 @@ double Dotu
 template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx )
 {
+    if( incx == 1 )
+        return simd::Nrm2( Int(n), x );
     typedef Base<F> Real;
     Real scale = 0; 
     Real scaledSquare = 1;
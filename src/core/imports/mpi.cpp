@@ -10,6 +10,10 @@
 */
 #include "El.hpp"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 // TODO: Introduce macros to shorten the explicit instantiation code
 
 typedef unsigned char* UCP;
@@ -30,6 +34,713 @@ SafeMpi( int mpiError ) EL_NO_RELEASE_EXCEPT
     )
 }
 
+// The largest count passed to a single MPI routine by the large-count variants
+El::Int maxCount = std::numeric_limits<int>::max();
+
+// Traffic accounting
+// ==================
+// Each of the following forwards to the MPI routine of the same name and, if
+// the traffic counters are enabled, records the number of bytes the calling
+// process contributed and received along with the time spent within MPI.
+namespace traffic {
+
+using El::mpi::TrafficRoutine;
+
+class Recorder
+{
+public:
+    Recorder( TrafficRoutine routine, MPI_Comm comm ) EL_NO_EXCEPT
+    : routine_(routine), comm_(comm),
+      active_(El::mpi::TrafficCountersEnabled())
+    {
+        if( active_ )
+            start_ = MPI_Wtime();
+    }
+
+    ~Recorder()
+    {
+        if( !active_ )
+            return;
+        try
+        {
+            El::mpi::RecordTraffic
+            ( routine_, comm_, bytesSent_, bytesRecv_, MPI_Wtime()-start_ );
+        }
+        catch( ... ) { }
+    }
+
+    bool Active() const EL_NO_EXCEPT { return active_; }
+
+    void Count( long long bytesSent, long long bytesRecv ) EL_NO_EXCEPT
+    {
+        bytesSent_ = bytesSent;
+        bytesRecv_ = bytesRecv;
+    }
+
+private:
+    TrafficRoutine routine_;
+    MPI_Comm comm_;
+    bool active_;
+    double start_=0;
+    long long bytesSent_=0, bytesRecv_=0;
+};
+
+inline long long Bytes( int count, MPI_Datatype type ) EL_NO_EXCEPT
+{
+    int typeSize;
+    MPI_Type_size( type, &typeSize );
+    return static_cast<long long>(count)*typeSize;
+}
+
+inline long long
+Bytes( int n, const int* counts, MPI_Datatype type ) EL_NO_EXCEPT
+{
+    long long totalCount = 0;
+    for( int q=0; q<n; ++q )
+        totalCount += counts[q];
+    return totalCount*Bytes( 1, type );
+}
+
+inline int CommSize( MPI_Comm comm ) EL_NO_EXCEPT
+{
+    int commSize;
+    MPI_Comm_size( comm, &commSize );
+    return commSize;
+}
+
+inline int CommRank( MPI_Comm comm ) EL_NO_EXCEPT
+{
+    int commRank;
+    MPI_Comm_rank( comm, &commRank );
+    return commRank;
+}
+
+// Point-to-point
+// --------------
+inline int Send
+( void* buf, int count, MPI_Datatype type, int to, int tag, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_SEND, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(count,type), 0 );
+    return MPI_Send( buf, count, type, to, tag, comm );
+}
+
+inline int Isend
+( void* buf, int count, MPI_Datatype type, int to, int tag, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ISEND, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(count,type), 0 );
+    return MPI_Isend( buf, count, type, to, tag, comm, request );
+}
+
+inline int Issend
+( void* buf, int count, MPI_Datatype type, int to, int tag, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ISEND, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(count,type), 0 );
+    return MPI_Issend( buf, count, type, to, tag, comm, request );
+}
+
+inline int Irsend
+( void* buf, int count, MPI_Datatype type, int to, int tag, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ISEND, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(count,type), 0 );
+    return MPI_Irsend( buf, count, type, to, tag, comm, request );
+}
+
+inline int Recv
+( void* buf, int count, MPI_Datatype type, int from, int tag, MPI_Comm comm,
+  MPI_Status* status )
+{
+    Recorder recorder( El::mpi::TRAFFIC_RECV, comm );
+    if( recorder.Active() )
+        recorder.Count( 0, Bytes(count,type) );
+    return MPI_Recv( buf, count, type, from, tag, comm, status );
+}
+
+inline int Irecv
+( void* buf, int count, MPI_Datatype type, int from, int tag, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IRECV, comm );
+    if( recorder.Active() )
+        recorder.Count( 0, Bytes(count,type) );
+    return MPI_Irecv( buf, count, type, from, tag, comm, request );
+}
+
+inline int Sendrecv
+( void* sbuf, int sc, MPI_Datatype stype, int to,   int stag,
+  void* rbuf, int rc, MPI_Datatype rtype, int from, int rtag,
+  MPI_Comm comm, MPI_Status* status )
+{
+    Recorder recorder( El::mpi::TRAFFIC_SEND_RECV, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(sc,stype), Bytes(rc,rtype) );
+    return MPI_Sendrecv
+    ( sbuf, sc, stype, to, stag, rbuf, rc, rtype, from, rtag, comm, status );
+}
+
+inline int Sendrecv_replace
+( void* buf, int count, MPI_Datatype type,
+  int to, int stag, int from, int rtag, MPI_Comm comm, MPI_Status* status )
+{
+    Recorder recorder( El::mpi::TRAFFIC_SEND_RECV, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(count,type), Bytes(count,type) );
+    return MPI_Sendrecv_replace
+    ( buf, count, type, to, stag, from, rtag, comm, status );
+}
+
+inline int Wait( MPI_Request* request, MPI_Status* status )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WAIT, MPI_COMM_NULL );
+    return MPI_Wait( request, status );
+}
+
+inline int Waitall( int n, MPI_Request* requests, MPI_Status* statuses )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WAIT, MPI_COMM_NULL );
+    return MPI_Waitall( n, requests, statuses );
+}
+
+// Collectives
+// -----------
+inline int Barrier( MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_BARRIER, comm );
+    return MPI_Barrier( comm );
+}
+
+inline int Bcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_BROADCAST, comm );
+    if( recorder.Active() )
+    {
+        const long long bytes = Bytes( count, type );
+        if( CommRank(comm) == root )
+            recorder.Count( bytes, 0 );
+        else
+            recorder.Count( 0, bytes );
+    }
+    return MPI_Bcast( buf, count, type, root, comm );
+}
+
+inline int Gather
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_GATHER, comm );
+    if( recorder.Active() )
+    {
+        const bool isRoot = ( CommRank(comm) == root );
+        recorder.Count
+        ( Bytes(sc,stype), isRoot ? CommSize(comm)*Bytes(rc,rtype) : 0 );
+    }
+    return MPI_Gather( sbuf, sc, stype, rbuf, rc, rtype, root, comm );
+}
+
+inline int Gatherv
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int* rcs, int* rds, MPI_Datatype rtype,
+  int root, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_GATHER, comm );
+    if( recorder.Active() )
+    {
+        const bool isRoot = ( CommRank(comm) == root );
+        recorder.Count
+        ( Bytes(sc,stype), isRoot ? Bytes(CommSize(comm),rcs,rtype) : 0 );
+    }
+    return MPI_Gatherv( sbuf, sc, stype, rbuf, rcs, rds, rtype, root, comm );
+}
+
+inline int Scatter
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_SCATTER, comm );
+    if( recorder.Active() )
+    {
+        const bool isRoot = ( CommRank(comm) == root );
+        recorder.Count
+        ( isRoot ? CommSize(comm)*Bytes(sc,stype) : 0, Bytes(rc,rtype) );
+    }
+    return MPI_Scatter( sbuf, sc, stype, rbuf, rc, rtype, root, comm );
+}
+
+inline int Allgather
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ALL_GATHER, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(sc,stype), CommSize(comm)*Bytes(rc,rtype) );
+    return MPI_Allgather( sbuf, sc, stype, rbuf, rc, rtype, comm );
+}
+
+inline int Allgatherv
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int* rcs, int* rds, MPI_Datatype rtype, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ALL_GATHER, comm );
+    if( recorder.Active() )
+    {
+        // An in-place contribution is described by the receive arguments
+        const long long sent =
+          ( sbuf == MPI_IN_PLACE ? Bytes(rcs[CommRank(comm)],rtype)
+                                 : Bytes(sc,stype) );
+        recorder.Count( sent, Bytes(CommSize(comm),rcs,rtype) );
+    }
+    return MPI_Allgatherv( sbuf, sc, stype, rbuf, rcs, rds, rtype, comm );
+}
+
+inline int Alltoall
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ALL_TO_ALL, comm );
+    if( recorder.Active() )
+    {
+        const int commSize = CommSize( comm );
+        recorder.Count( commSize*Bytes(sc,stype), commSize*Bytes(rc,rtype) );
+    }
+    return MPI_Alltoall( sbuf, sc, stype, rbuf, rc, rtype, comm );
+}
+
+inline int Alltoallv
+( void* sbuf, int* scs, int* sds, MPI_Datatype stype,
+  void* rbuf, int* rcs, int* rds, MPI_Datatype rtype, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ALL_TO_ALL, comm );
+    if( recorder.Active() )
+    {
+        const int commSize = CommSize( comm );
+        recorder.Count
+        ( Bytes(commSize,scs,stype), Bytes(commSize,rcs,rtype) );
+    }
+    return MPI_Alltoallv
+    ( sbuf, scs, sds, stype, rbuf, rcs, rds, rtype, comm );
+}
+
+inline int Reduce
+( void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  int root, MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_REDUCE, comm );
+    if( recorder.Active() )
+    {
+        const long long bytes = Bytes( count, type );
+        recorder.Count( bytes, CommRank(comm) == root ? bytes : 0 );
+    }
+    return MPI_Reduce( sbuf, rbuf, count, type, op, root, comm );
+}
+
+inline int Allreduce
+( void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ALL_REDUCE, comm );
+    if( recorder.Active() )
+    {
+        const long long bytes = Bytes( count, type );
+        recorder.Count( bytes, bytes );
+    }
+    return MPI_Allreduce( sbuf, rbuf, count, type, op, comm );
+}
+
+inline int Reduce_scatter
+( void* sbuf, void* rbuf, int* rcs, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_REDUCE_SCATTER, comm );
+    if( recorder.Active() )
+        recorder.Count
+        ( Bytes(CommSize(comm),rcs,type), Bytes(rcs[CommRank(comm)],type) );
+    return MPI_Reduce_scatter( sbuf, rbuf, rcs, type, op, comm );
+}
+
+inline int Reduce_scatter_block
+( void* sbuf, void* rbuf, int rc, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_REDUCE_SCATTER, comm );
+    if( recorder.Active() )
+        recorder.Count( CommSize(comm)*Bytes(rc,type), Bytes(rc,type) );
+    return MPI_Reduce_scatter_block( sbuf, rbuf, rc, type, op, comm );
+}
+
+inline int Scan
+( void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm )
+{
+    Recorder recorder( El::mpi::TRAFFIC_SCAN, comm );
+    if( recorder.Active() )
+    {
+        const long long bytes = Bytes( count, type );
+        recorder.Count( bytes, bytes );
+    }
+    return MPI_Scan( sbuf, rbuf, count, type, op, comm );
+}
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+inline int Ibcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IBROADCAST, comm );
+    if( recorder.Active() )
+    {
+        const long long bytes = Bytes( count, type );
+        if( CommRank(comm) == root )
+            recorder.Count( bytes, 0 );
+        else
+            recorder.Count( 0, bytes );
+    }
+    return EL_NONBLOCKING_COLL(Ibcast)
+    ( buf, count, type, root, comm, request );
+}
+
+inline int Igather
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, int root, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IGATHER, comm );
+    if( recorder.Active() )
+    {
+        const bool isRoot = ( CommRank(comm) == root );
+        recorder.Count
+        ( Bytes(sc,stype), isRoot ? CommSize(comm)*Bytes(rc,rtype) : 0 );
+    }
+    return EL_NONBLOCKING_COLL(Igather)
+    ( sbuf, sc, stype, rbuf, rc, rtype, root, comm, request );
+}
+
+inline int Iallgather
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IALL_GATHER, comm );
+    if( recorder.Active() )
+        recorder.Count( Bytes(sc,stype), CommSize(comm)*Bytes(rc,rtype) );
+    return EL_NONBLOCKING_COLL(Iallgather)
+    ( sbuf, sc, stype, rbuf, rc, rtype, comm, request );
+}
+
+inline int Ialltoall
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IALL_TO_ALL, comm );
+    if( recorder.Active() )
+    {
+        const int commSize = CommSize( comm );
+        recorder.Count( commSize*Bytes(sc,stype), commSize*Bytes(rc,rtype) );
+    }
+    return EL_NONBLOCKING_COLL(Ialltoall)
+    ( sbuf, sc, stype, rbuf, rc, rtype, comm, request );
+}
+
+inline int Ialltoallv
+( void* sbuf, int* scs, int* sds, MPI_Datatype stype,
+  void* rbuf, int* rcs, int* rds, MPI_Datatype rtype, MPI_Comm comm,
+  MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IALL_TO_ALL, comm );
+    if( recorder.Active() )
+    {
+        const int commSize = CommSize( comm );
+        recorder.Count
+        ( Bytes(commSize,scs,stype), Bytes(commSize,rcs,rtype) );
+    }
+    return EL_NONBLOCKING_COLL(Ialltoallv)
+    ( sbuf, scs, sds, stype, rbuf, rcs, rds, rtype, comm, request );
+}
+
+inline int Iallreduce
+( void* sbuf, void* rbuf, int count, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm, MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IALL_REDUCE, comm );
+    if( recorder.Active() )
+    {
+        const long long bytes = Bytes( count, type );
+        recorder.Count( bytes, bytes );
+    }
+    return EL_NONBLOCKING_COLL(Iallreduce)
+    ( sbuf, rbuf, count, type, op, comm, request );
+}
+
+inline int Ireduce_scatter_block
+( void* sbuf, void* rbuf, int rc, MPI_Datatype type, MPI_Op op,
+  MPI_Comm comm, MPI_Request* request )
+{
+    Recorder recorder( El::mpi::TRAFFIC_IREDUCE_SCATTER, comm );
+    if( recorder.Active() )
+        recorder.Count( CommSize(comm)*Bytes(rc,type), Bytes(rc,type) );
+    return EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+    ( sbuf, rbuf, rc, type, op, comm, request );
+}
+#endif
+
+#ifdef EL_HAVE_MPI3_RMA
+// One-sided communication
+// -----------------------
+inline int Win_create
+( void* base, MPI_Aint size, int dispUnit, MPI_Comm comm, MPI_Win* window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_CREATE, comm );
+    return MPI_Win_create( base, size, dispUnit, MPI_INFO_NULL, comm, window );
+}
+
+inline int Win_allocate_shared
+( MPI_Aint size, int dispUnit, MPI_Comm comm, void* base, MPI_Win* window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_CREATE, comm );
+    return MPI_Win_allocate_shared
+    ( size, dispUnit, MPI_INFO_NULL, comm, base, window );
+}
+
+inline int Win_free( MPI_Win* window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_FREE, MPI_COMM_NULL );
+    return MPI_Win_free( window );
+}
+
+inline int Accumulate
+( void* buf, int count, MPI_Datatype type,
+  int target, MPI_Datatype targetType, MPI_Op op, MPI_Win window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_ACCUMULATE, MPI_COMM_NULL );
+    if( recorder.Active() )
+        recorder.Count( Bytes(count,type), 0 );
+    return MPI_Accumulate
+    ( buf, count, type, target, 0, 1, targetType, op, window );
+}
+
+inline int Win_lock_all( MPI_Win window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_SYNC, MPI_COMM_NULL );
+    return MPI_Win_lock_all( 0, window );
+}
+
+inline int Win_unlock_all( MPI_Win window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_SYNC, MPI_COMM_NULL );
+    return MPI_Win_unlock_all( window );
+}
+
+inline int Win_flush_local( int rank, MPI_Win window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_SYNC, MPI_COMM_NULL );
+    return MPI_Win_flush_local( rank, window );
+}
+
+inline int Win_flush_all( MPI_Win window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_SYNC, MPI_COMM_NULL );
+    return MPI_Win_flush_all( window );
+}
+
+inline int Win_sync( MPI_Win window )
+{
+    Recorder recorder( El::mpi::TRAFFIC_WINDOW_SYNC, MPI_COMM_NULL );
+    return MPI_Win_sync( window );
+}
+#endif
+
+} // namespace traffic
+
+// Node-local hierarchies
+// ======================
+// Broadcasts and AllGathers over a communicator with a hierarchy are split
+// into collectives within each node and between one leader per node, so
+// that the data crosses the network once per node rather than once per
+// process.
+namespace hierarchy {
+
+struct Hierarchy
+{
+    int rank, size;
+    // The processes of the node of this process and, if this process is the
+    // leader of its node (its rank within the node is zero), the leaders of
+    // all of the nodes (ordered by node index)
+    MPI_Comm nodeComm, leaderComm;
+    // The node index of, and rank within the node of, each process
+    std::vector<int> nodes, nodeRanks;
+    // The number of processes within, and first rank of, each node
+    std::vector<int> nodeSizes, nodeOffsets;
+    // Whether every node holds a contiguous range of ranks
+    bool contiguous;
+};
+
+// Grids (and hence hierarchies) may be created from several threads, so the
+// map is guarded by a mutex, and its size is mirrored by an atomic counter so
+// that collectives need not lock when no hierarchies exist. The entries are
+// shared so that a collective keeps its hierarchy alive even if another
+// thread concurrently frees or replaces the map entry.
+std::map<MPI_Comm,std::shared_ptr<const Hierarchy>> hierarchies;
+std::mutex hierarchyMutex;
+std::atomic<int> numHierarchies(0);
+
+inline std::shared_ptr<const Hierarchy> Find( MPI_Comm comm ) EL_NO_EXCEPT
+{
+    if( numHierarchies == 0 )
+        return nullptr;
+    std::lock_guard<std::mutex> lock( hierarchyMutex );
+    auto it = hierarchies.find( comm );
+    return ( it == hierarchies.end() ? nullptr : it->second );
+}
+
+void Free( MPI_Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    if( numHierarchies == 0 )
+        return;
+    MPI_Comm nodeComm, leaderComm;
+    {
+        std::lock_guard<std::mutex> lock( hierarchyMutex );
+        auto it = hierarchies.find( comm );
+        if( it == hierarchies.end() )
+            return;
+        nodeComm = it->second->nodeComm;
+        leaderComm = it->second->leaderComm;
+        hierarchies.erase( it );
+        --numHierarchies;
+    }
+    SafeMpi( MPI_Comm_free( &nodeComm ) );
+    if( leaderComm != MPI_COMM_NULL )
+        SafeMpi( MPI_Comm_free( &leaderComm ) );
+}
+
+// Takes ownership of nodeComm, which must be a split of comm (with the
+// processes ordered by their rank within comm)
+void Create( MPI_Comm comm, MPI_Comm nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    Free( comm );
+
+    Hierarchy h;
+    h.nodeComm = nodeComm;
+    h.rank = traffic::CommRank( comm );
+    h.size = traffic::CommSize( comm );
+    const int nodeRank = traffic::CommRank( nodeComm );
+    SafeMpi
+    ( MPI_Comm_split
+      ( comm, nodeRank==0 ? 0 : MPI_UNDEFINED, h.rank, &h.leaderComm ) );
+    int node = 0;
+    if( h.leaderComm != MPI_COMM_NULL )
+        node = traffic::CommRank( h.leaderComm );
+    SafeMpi( MPI_Bcast( &node, 1, MPI_INT, 0, nodeComm ) );
+
+    int myNodeInfo[2] = { node, nodeRank };
+    std::vector<int> nodeInfo( 2*h.size );
+    SafeMpi
+    ( MPI_Allgather
+      ( myNodeInfo, 2, MPI_INT, nodeInfo.data(), 2, MPI_INT, comm ) );
+    h.nodes.resize( h.size );
+    h.nodeRanks.resize( h.size );
+    int numNodes = 0;
+    for( int q=0; q<h.size; ++q )
+    {
+        h.nodes[q] = nodeInfo[2*q];
+        h.nodeRanks[q] = nodeInfo[2*q+1];
+        numNodes = El::Max( numNodes, h.nodes[q]+1 );
+    }
+    h.nodeSizes.assign( numNodes, 0 );
+    h.nodeOffsets.assign( numNodes, 0 );
+    for( int q=0; q<h.size; ++q )
+    {
+        ++h.nodeSizes[h.nodes[q]];
+        if( h.nodeRanks[q] == 0 )
+            h.nodeOffsets[h.nodes[q]] = q;
+    }
+    h.contiguous = true;
+    for( int q=0; q<h.size; ++q )
+        if( q != h.nodeOffsets[h.nodes[q]]+h.nodeRanks[q] )
+            h.contiguous = false;
+
+    // A hierarchy is of no use with a single node or one process per node
+    if( numNodes == 1 || numNodes == h.size )
+    {
+        SafeMpi( MPI_Comm_free( &h.nodeComm ) );
+        if( h.leaderComm != MPI_COMM_NULL )
+            SafeMpi( MPI_Comm_free( &h.leaderComm ) );
+        return;
+    }
+    std::lock_guard<std::mutex> lock( hierarchyMutex );
+    hierarchies[comm] = std::make_shared<const Hierarchy>( std::move(h) );
+    ++numHierarchies;
+}
+
+inline int Bcast
+( void* buf, int count, MPI_Datatype type, int root, MPI_Comm comm )
+{
+    const auto h = Find( comm );
+    if( h == nullptr )
+        return traffic::Bcast( buf, count, type, root, comm );
+
+    // Within the node of the root (if the root is not its leader), then
+    // between the leaders, and then within the remaining nodes
+    const int rootNode = h->nodes[root];
+    const int rootNodeRank = h->nodeRanks[root];
+    const bool inRootNode = ( h->nodes[h->rank] == rootNode );
+    int error = MPI_SUCCESS;
+    if( inRootNode && rootNodeRank != 0 )
+        error = traffic::Bcast( buf, count, type, rootNodeRank, h->nodeComm );
+    if( error == MPI_SUCCESS && h->leaderComm != MPI_COMM_NULL )
+        error = traffic::Bcast( buf, count, type, rootNode, h->leaderComm );
+    if( error == MPI_SUCCESS && (!inRootNode || rootNodeRank == 0) )
+        error = traffic::Bcast( buf, count, type, 0, h->nodeComm );
+    return error;
+}
+
+inline int Allgather
+( void* sbuf, int sc, MPI_Datatype stype,
+  void* rbuf, int rc, MPI_Datatype rtype, MPI_Comm comm )
+{
+    const auto h = Find( comm );
+    if( h == nullptr || !h->contiguous )
+        return traffic::Allgather( sbuf, sc, stype, rbuf, rc, rtype, comm );
+
+    // Gather onto the leader of each node, exchange between the leaders, and
+    // then broadcast the result within each node
+    MPI_Aint lowerBound, extent;
+    MPI_Type_get_extent( rtype, &lowerBound, &extent );
+    const int node = h->nodes[h->rank];
+    UCP nodeBuf = static_cast<UCP>(rbuf) + h->nodeOffsets[node]*rc*extent;
+    int error =
+      traffic::Gather( sbuf, sc, stype, nodeBuf, rc, rtype, 0, h->nodeComm );
+    if( error == MPI_SUCCESS && h->leaderComm != MPI_COMM_NULL )
+    {
+        const int numNodes = h->nodeSizes.size();
+        std::vector<int> counts( numNodes ), offsets( numNodes );
+        for( int n=0; n<numNodes; ++n )
+        {
+            counts[n] = h->nodeSizes[n]*rc;
+            offsets[n] = h->nodeOffsets[n]*rc;
+        }
+        error =
+          traffic::Allgatherv
+          ( MPI_IN_PLACE, 0, rtype,
+            rbuf, counts.data(), offsets.data(), rtype, h->leaderComm );
+    }
+    if( error == MPI_SUCCESS )
+        error = traffic::Bcast( rbuf, h->size*rc, rtype, 0, h->nodeComm );
+    return error;
+}
+
+} // namespace hierarchy
+
 } // anonymous namespace
 
 namespace El {
@@ -160,6 +871,8 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Free"))
+    // MPI may reuse the handle, so any hierarchy must not outlive it
+    hierarchy::Free( comm.comm );
     SafeMpi( MPI_Comm_free( &comm.comm ) );
 }
 
@@ -182,6 +895,70 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+void SetCommName( Comm comm, const string& name ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::SetCommName"))
+    SafeMpi( MPI_Comm_set_name( comm.comm, const_cast<char*>(name.c_str()) ) );
+}
+
+string CommName( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::CommName"))
+    char name[MPI_MAX_OBJECT_NAME];
+    int length;
+    SafeMpi( MPI_Comm_get_name( comm.comm, name, &length ) );
+    return string( name, length );
+}
+
+void SplitShared( Comm comm, int key, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::SplitShared"))
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    // Fall back to grouping the processes by the name of their processor
+    // (a collision of the hashes would merely merge two nodes)
+    char name[MPI_MAX_PROCESSOR_NAME];
+    int length;
+    SafeMpi( MPI_Get_processor_name( name, &length ) );
+    const size_t hash = std::hash<string>()( string(name,length) );
+    const int color = int(hash % size_t(std::numeric_limits<int>::max()));
+    Split( comm, color, key, nodeComm );
+#endif
+}
+
+void CreateHierarchy( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::CreateHierarchy"))
+    if( comm == COMM_NULL )
+        return;
+    Comm nodeComm;
+    SplitShared( comm, Rank(comm), nodeComm );
+    hierarchy::Create( comm.comm, nodeComm.comm );
+}
+
+void CreateHierarchy( Comm comm, int nodeColor ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::CreateHierarchy"))
+    if( comm == COMM_NULL )
+        return;
+    Comm nodeComm;
+    Split( comm, nodeColor, Rank(comm), nodeComm );
+    hierarchy::Create( comm.comm, nodeComm.comm );
+}
+
+bool HaveHierarchy( Comm comm ) EL_NO_EXCEPT
+{ return hierarchy::Find( comm.comm ) != nullptr; }
+
+void FreeHierarchy( Comm comm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::FreeHierarchy"))
+    hierarchy::Free( comm.comm );
+}
+
 // Cartesian communicator routines 
 // ===============================
 
@@ -379,7 +1156,7 @@ void Translate
 void Barrier( Comm comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Barrier"))
-    SafeMpi( MPI_Barrier( comm.comm ) );
+    SafeMpi( traffic::Barrier( comm.comm ) );
 }
 
 // Test for completion
@@ -407,7 +1184,7 @@ template<typename T>
 void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Wait"))
-    SafeMpi( MPI_Wait( &request.backend, &status ) );
+    SafeMpi( traffic::Wait( &request.backend, &status ) );
 }
 
 // Ensure that several requests finish before continuing
@@ -433,7 +1210,7 @@ EL_NO_RELEASE_EXCEPT
     vector<MPI_Request> backends( numRequests );
     for( Int j=0; j<numRequests; ++j )
         backends[j] = requests[j].backend;
-    SafeMpi( MPI_Waitall( numRequests, backends.data(), statuses ) );
+    SafeMpi( traffic::Waitall( numRequests, backends.data(), statuses ) );
     // NOTE: This write back will almost always be superfluous, but it ensures
     //       that any changes to the pointer are propagated
     for( Int j=0; j<numRequests; ++j )
@@ -442,7 +1219,7 @@ EL_NO_RELEASE_EXCEPT
     for( Int j=0; j<numRequests; ++j )
     {
         Status status;
-        MPI_Wait( &requests[j].backend, &status );
+        traffic::Wait( &requests[j].backend, &status );
     }
 #endif
 }
@@ -452,7 +1229,7 @@ template<typename T>
 void PackedWait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::PackedWait"))
-    SafeMpi( MPI_Wait( &request.backend, &status ) );
+    SafeMpi( traffic::Wait( &request.backend, &status ) );
     if( request.receivingPacked )
     {
         Deserialize
@@ -499,7 +1276,7 @@ EL_NO_RELEASE_EXCEPT
     vector<MPI_Request> backends( numRequests );
     for( Int j=0; j<numRequests; ++j )
         backends[j] = requests[j].backend;
-    SafeMpi( MPI_Waitall( numRequests, backends.data(), statuses ) );
+    SafeMpi( traffic::Waitall( numRequests, backends.data(), statuses ) );
     // NOTE: This write back will almost always be superfluous, but it ensures
     //       that any changes to the pointer are propagated
     for( Int j=0; j<numRequests; ++j )
@@ -508,7 +1285,7 @@ EL_NO_RELEASE_EXCEPT
     for( Int j=0; j<numRequests; ++j )
     {
         Status status;
-        MPI_Wait( &requests[j].backend, &status );
+        traffic::Wait( &requests[j].backend, &status );
     }
 #endif
     for( Int j=0; j<numRequests; ++j )
@@ -579,7 +1356,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_ONLY(CSE cse("mpi::TaggedSend"))
     SafeMpi
-    ( MPI_Send
+    ( traffic::Send
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, tag, comm.comm ) );
 }
 #ifdef EL_HAVE_MPC
@@ -590,7 +1367,7 @@ void PackedTaggedSend( const T* buf, int count, int to, int tag, Comm comm )
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
     SafeMpi
-    ( MPI_Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
+    ( traffic::Send( packedBuf.data(), count, TypeMap<T>(), to, tag, comm.comm ) );
 }
 template<>
 void TaggedSend( const BigInt* buf, int count, int to, int tag, Comm comm )
@@ -649,12 +1426,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::TaggedSend"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Send
+    ( traffic::Send
       ( const_cast<Complex<Real>*>(buf), 2*count, TypeMap<Real>(), to, 
         tag, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Send
+    ( traffic::Send
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm ) );
 #endif
@@ -680,7 +1457,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_ONLY(CSE cse("mpi::ISend"))
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -693,7 +1470,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::PackedTaggedISend"))
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( request.buffer.data(), count, TypeMap<T>(), to, tag, comm.comm,
         &request.backend ) );
 }
@@ -763,12 +1540,12 @@ void TaggedISend
     DEBUG_ONLY(CSE cse("mpi::ISend"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Isend
+    ( traffic::Isend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -798,7 +1575,7 @@ EL_NO_RELEASE_EXCEPT
 { 
     DEBUG_ONLY(CSE cse("mpi::IRSend"))
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -812,7 +1589,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::PackedTaggedIRSend"))
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( request.buffer.data(), count, TypeMap<T>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -882,12 +1659,12 @@ void TaggedIRSend
     DEBUG_ONLY(CSE cse("mpi::IRSend"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irsend
+    ( traffic::Irsend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -916,7 +1693,7 @@ void TaggedISSend
 {
     DEBUG_ONLY(CSE cse("mpi::ISSend"))
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( const_cast<Real*>(buf), count, TypeMap<Real>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -929,7 +1706,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::PackedISSend"))
     Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( request.buffer.data(), count, TypeMap<T>(), to, 
         tag, comm.comm, &request.backend ) );
 }
@@ -994,12 +1771,12 @@ void TaggedISSend
     DEBUG_ONLY(CSE cse("mpi::ISSend"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( const_cast<Complex<Real>*>(buf), 2*count, 
         TypeMap<Real>(), to, tag, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Issend
+    ( traffic::Issend
       ( const_cast<Complex<Real>*>(buf), count, 
         TypeMap<Complex<Real>>(), to, tag, comm.comm, &request.backend ) );
 #endif
@@ -1022,7 +1799,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::TaggedRecv"))
     Status status;
     SafeMpi
-    ( MPI_Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( traffic::Recv( buf, count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 }
 #ifdef EL_HAVE_MPC
 template<typename T>
@@ -1033,7 +1810,7 @@ void PackedTaggedRecv( T* buf, int count, int from, int tag, Comm comm )
     ReserveSerialized( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Recv
+    ( traffic::Recv
       ( packedBuf.data(), count, TypeMap<T>(), from, tag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -1094,10 +1871,10 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
+    ( traffic::Recv( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Recv
+    ( traffic::Recv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm, &status ) );
 #endif
 }
@@ -1124,7 +1901,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::TaggedIRecv"))
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( buf, count, TypeMap<Real>(), from, tag, comm.comm, &request.backend ) );
 }
 #ifdef EL_HAVE_MPC
@@ -1139,7 +1916,7 @@ EL_NO_RELEASE_EXCEPT
     request.unpackedRecvBuf = buf;
     ReserveSerialized( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( request.buffer.data(), count, TypeMap<T>(), from, tag, comm.comm,
         &request.backend ) );
 }
@@ -1208,12 +1985,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::IRecv"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( buf, 2*count, TypeMap<Real>(), from, tag, comm.comm,
         &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Irecv
+    ( traffic::Irecv
       ( buf, count, TypeMap<Complex<Real>>(), from, tag, comm.comm,
         &request.backend ) );
 #endif
@@ -1243,7 +2020,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::TaggedSendRecv"))
     Status status;
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), to,   stag,
         rbuf,                    rc, TypeMap<Real>(), from, rtag, 
         comm.comm, &status ) );
@@ -1260,7 +2037,7 @@ void PackedTaggedSendRecv
     Serialize( sc, sbuf, packedSend );
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( packedSend.data(), sc, TypeMap<T>(), to,   stag,
         packedRecv.data(), rc, TypeMap<T>(), from, rtag, 
         comm.comm, &status ) );
@@ -1328,13 +2105,13 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(), to,   stag,
         rbuf,                             2*rc, TypeMap<Real>(), from, rtag, 
         comm.comm, &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv
+    ( traffic::Sendrecv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc, TypeMap<Complex<Real>>(), to,   stag,
         rbuf,                          
@@ -1371,7 +2148,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::SendRecv"))
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( buf, count, TypeMap<Real>(), to, stag, from, rtag, comm.comm,
         &status ) );
 }
@@ -1387,7 +2164,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedBuf );
     Status status;
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( packedBuf.data(), count, TypeMap<T>(), to, stag, from, rtag,
         comm.comm, &status ) );
     Deserialize( count, packedBuf, buf );
@@ -1458,12 +2235,12 @@ EL_NO_RELEASE_EXCEPT
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( buf, 2*count, TypeMap<Real>(), to, stag, from, rtag, comm.comm, 
         &status ) );
 #else
     SafeMpi
-    ( MPI_Sendrecv_replace
+    ( traffic::Sendrecv_replace
       ( buf, count, TypeMap<Complex<Real>>(), 
         to, stag, from, rtag, comm.comm, &status ) );
 #endif
@@ -1481,7 +2258,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::Broadcast"))
     if( Size(comm) == 1 || count == 0 )
         return;
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi( hierarchy::Bcast( buf, count, TypeMap<Real>(), root, comm.comm ) );
 }
 #ifdef EL_HAVE_MPC
 template<typename T>
@@ -1493,9 +2270,9 @@ EL_NO_RELEASE_EXCEPT
         return;
     std::vector<byte> packedBuf;
     Serialize( count, buf, packedBuf );
-    SafeMpi(
-      MPI_Bcast( packedBuf.data(), count, TypeMap<T>(), root, comm.comm )
-    );
+    SafeMpi
+    ( hierarchy::Bcast
+      ( packedBuf.data(), count, TypeMap<T>(), root, comm.comm ) );
     Deserialize( count, packedBuf, buf );
 }
 
@@ -1552,9 +2329,12 @@ EL_NO_RELEASE_EXCEPT
     if( Size(comm) == 1 )
         return;
 #ifdef EL_AVOID_COMPLEX_MPI
-    SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
+    SafeMpi
+    ( hierarchy::Bcast( buf, 2*count, TypeMap<Real>(), root, comm.comm ) );
 #else
-    SafeMpi( MPI_Bcast( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
+    SafeMpi
+    ( hierarchy::Bcast
+      ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
 }
 
@@ -1569,7 +2349,7 @@ void IBroadcast
     DEBUG_ONLY(CSE cse("mpi::IBroadcast"))
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast
+    ( traffic::Ibcast
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1582,13 +2362,20 @@ void PackedIBroadcast
 {
     DEBUG_ONLY(CSE cse("mpi::PackedIBroadcast"))
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    request.receivingPacked = true;
-    request.recvCount = count;
-    request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    if( mpi::Rank(comm) == root )
+    {
+        Serialize( count, buf, request.buffer );
+    }
+    else
+    {
+        request.receivingPacked = true;
+        request.recvCount = count;
+        request.unpackedRecvBuf = buf;
+        ReserveSerialized( count, buf, request.buffer );
+    }
     SafeMpi
-    ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+    ( traffic::Ibcast
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1653,11 +2440,11 @@ void IBroadcast
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast
+    ( traffic::Ibcast
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( traffic::Ibcast
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
         &request.backend ) );
 #endif
@@ -1678,7 +2465,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -1700,7 +2487,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     if( commRank == root )
@@ -1773,12 +2560,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::Gather"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gather
+    ( traffic::Gather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm ) );
@@ -1795,7 +2582,7 @@ void IGather
     DEBUG_ONLY(CSE cse("mpi::IGather"))
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( traffic::Igather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1812,23 +2599,9 @@ void PackedIGather
   Request<T>& request )
 {
     DEBUG_ONLY(CSE cse("mpi::PackedIGather"))
-#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
-    if( mpi::Rank(comm) == root )
-    {
-        const int commSize = mpi::Size(comm);
-        request.receivingPacked = true;
-        request.recvCount = rc*commSize;
-        request.unpackedRecvBuf = rbuf;
-        ReserveSerialized( rc*commSize, rbuf, request.buffer );
-    }
-    SafeMpi
-    ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
-        &request.backend ) );
-#else
-    LogicError("Elemental was not configured with non-blocking support");
-#endif
+    // The serialized send buffer would have to outlive this call, so the
+    // gather is performed eagerly and the request is left empty
+    Gather( sbuf, sc, rbuf, rc, root, comm );
 }
 
 template<>
@@ -1888,38 +2661,399 @@ void IGather
   int root, Comm comm,
   Request<Entry<BigFloat>>& request )
 {
-    DEBUG_ONLY(CSE cse("mpi::IGather [Entry<BigFloat>]"))
-    PackedIGather( sbuf, sc, rbuf, rc, root, comm, request );
+    DEBUG_ONLY(CSE cse("mpi::IGather [Entry<BigFloat>]"))
+    PackedIGather( sbuf, sc, rbuf, rc, root, comm, request );
+}
+#endif
+
+template<typename Real>
+void IGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc,
+  int root, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IGather"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( traffic::Igather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(), 
+        root, comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( traffic::Igather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(), 
+        root, comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+// Non-blocking AllGather, AllToAll, AllReduce, and ReduceScatter
+// ==============================================================
+
+// The MPI operation which implements 'op' for the given datatype
+template<typename Real>
+MPI_Op NativeOp( Op op )
+{
+    if( op == SUM )
+        return SumOp<Real>().op;
+    else if( op == MAX )
+        return MaxOp<Real>().op;
+    else if( op == MIN )
+        return MinOp<Real>().op;
+    else
+        return op.op;
+}
+
+template<typename Real>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Iallgather
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+#ifdef EL_HAVE_MPC
+template<typename T>
+void PackedIAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::PackedIAllGather"))
+    // As with PackedIGather, the gather is performed eagerly and the request
+    // is left empty
+    AllGather( sbuf, sc, rbuf, rc, comm );
+}
+
+template<>
+void IAllGather
+( const BigInt* sbuf, int sc,
+        BigInt* rbuf, int rc, Comm comm,
+  Request<BigInt>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather [BigInt]"))
+    PackedIAllGather( sbuf, sc, rbuf, rc, comm, request );
+}
+template<>
+void IAllGather
+( const ValueInt<BigInt>* sbuf, int sc,
+        ValueInt<BigInt>* rbuf, int rc, Comm comm,
+  Request<ValueInt<BigInt>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather [ValueInt<BigInt>]"))
+    PackedIAllGather( sbuf, sc, rbuf, rc, comm, request );
+}
+template<>
+void IAllGather
+( const Entry<BigInt>* sbuf, int sc,
+        Entry<BigInt>* rbuf, int rc, Comm comm,
+  Request<Entry<BigInt>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather [Entry<BigInt>]"))
+    PackedIAllGather( sbuf, sc, rbuf, rc, comm, request );
+}
+
+template<>
+void IAllGather
+( const BigFloat* sbuf, int sc,
+        BigFloat* rbuf, int rc, Comm comm,
+  Request<BigFloat>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather [BigFloat]"))
+    PackedIAllGather( sbuf, sc, rbuf, rc, comm, request );
+}
+template<>
+void IAllGather
+( const ValueInt<BigFloat>* sbuf, int sc,
+        ValueInt<BigFloat>* rbuf, int rc, Comm comm,
+  Request<ValueInt<BigFloat>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather [ValueInt<BigFloat>]"))
+    PackedIAllGather( sbuf, sc, rbuf, rc, comm, request );
+}
+template<>
+void IAllGather
+( const Entry<BigFloat>* sbuf, int sc,
+        Entry<BigFloat>* rbuf, int rc, Comm comm,
+  Request<Entry<BigFloat>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather [Entry<BigFloat>]"))
+    PackedIAllGather( sbuf, sc, rbuf, rc, comm, request );
+}
+#endif
+
+template<typename Real>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllGather"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( traffic::Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( traffic::Iallgather
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllToAll"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Ialltoall
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllToAll"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( traffic::Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( traffic::Ialltoall
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllToAll"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Ialltoallv
+      ( const_cast<Real*>(sbuf),
+        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<Real>(),
+        rbuf,
+        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+// NOTE: Since doubling the counts and displacements would require storage
+//       which outlives this call, the complex datatype is always used here
+template<typename Real>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllToAll"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Ialltoallv
+      ( const_cast<Complex<Real>*>(sbuf),
+        const_cast<int*>(scs), const_cast<int*>(sds),
+        TypeMap<Complex<Real>>(),
+        rbuf,
+        const_cast<int*>(rcs), const_cast<int*>(rds),
+        TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllReduce"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Iallreduce
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
+        NativeOp<Real>(op), comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllReduce"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const MPI_Op opC = ( op == SUM ? SumOp<Complex<Real>>().op : op.op );
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        SafeMpi
+        ( traffic::Iallreduce
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*count, TypeMap<Real>(),
+            opC, comm.comm, &request.backend ) );
+        return;
+    }
+#endif
+    SafeMpi
+    ( traffic::Iallreduce
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, count,
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
 }
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
+template<typename Real>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IAllReduce"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( traffic::Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(),
+        NativeOp<Real>(op), comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
 #endif
+}
 
 template<typename Real>
-void IGather
-( const Complex<Real>* sbuf, int sc,
-        Complex<Real>* rbuf, int rc,
-  int root, Comm comm,
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
   Request<Complex<Real>>& request )
 {
-    DEBUG_ONLY(CSE cse("mpi::IGather"))
+    DEBUG_ONLY(CSE cse("mpi::IAllReduce"))
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const MPI_Op opC = ( op == SUM ? SumOp<Complex<Real>>().op : op.op );
 #ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        SafeMpi
+        ( traffic::Iallreduce
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+        return;
+    }
+#endif
     SafeMpi
-    ( MPI_Igather
-      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
-        rbuf,                             2*rc, TypeMap<Real>(), 
-        root, comm.comm, &request.backend ) );
+    ( traffic::Iallreduce
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
 #else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
+template<typename Real>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IReduceScatter"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
-      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
-        rbuf,                             rc, TypeMap<Complex<Real>>(), 
-        root, comm.comm, &request.backend ) );
+    ( traffic::Ireduce_scatter_block
+      ( const_cast<Real*>(sbuf), rbuf, rc, TypeMap<Real>(),
+        NativeOp<Real>(op), comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_ONLY(CSE cse("mpi::IReduceScatter"))
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const MPI_Op opC = ( op == SUM ? SumOp<Complex<Real>>().op : op.op );
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        SafeMpi
+        ( traffic::Ireduce_scatter_block
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*rc, TypeMap<Real>(),
+            opC, comm.comm, &request.backend ) );
+        return;
+    }
 #endif
+    SafeMpi
+    ( traffic::Ireduce_scatter_block
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, rc,
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
 #endif
 }
 
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request )
+{ IReduceScatter( sbuf, rbuf, rc, SUM, comm, request ); }
+
 template<typename Real>
 void Gather
 ( const Real* sbuf, int sc,
@@ -1929,7 +3063,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Gather"))
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( const_cast<Real*>(sbuf), 
         sc,       
         TypeMap<Real>(),
@@ -1961,7 +3095,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -2059,13 +3193,13 @@ EL_NO_RELEASE_EXCEPT
         }
     }
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, rcsDouble.data(), rdsDouble.data(), TypeMap<Real>(),
         root, comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Gatherv
+    ( traffic::Gatherv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc,       
         TypeMap<Complex<Real>>(),
@@ -2087,13 +3221,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( hierarchy::Allgather
       ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf,                    sizeof(Real)*rc, MPI_UNSIGNED_CHAR, 
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgather
+    ( hierarchy::Allgather
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(), 
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 #endif
@@ -2114,7 +3248,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgather
+    ( hierarchy::Allgather
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -2186,7 +3320,7 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::AllGather"))
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
-    ( MPI_Allgather
+    ( hierarchy::Allgather
       ( (UCP)const_cast<Complex<Real>*>(sbuf),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf,
@@ -2195,12 +3329,12 @@ EL_NO_RELEASE_EXCEPT
 #else
  #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Allgather
+    ( hierarchy::Allgather
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgather
+    ( hierarchy::Allgather
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(),
         comm.comm ) );
@@ -2224,13 +3358,13 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( (UCP)const_cast<Real*>(sbuf), sizeof(Real)*sc,   MPI_UNSIGNED_CHAR, 
         (UCP)rbuf, byteRcs.data(), byteRds.data(), MPI_UNSIGNED_CHAR, 
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( const_cast<Real*>(sbuf), 
         sc, 
         TypeMap<Real>(), 
@@ -2257,7 +3391,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( packedSend.data(),
         sc,
         TypeMap<T>(),
@@ -2342,7 +3476,7 @@ EL_NO_RELEASE_EXCEPT
         byteRds[i] = 2*sizeof(Real)*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( (UCP)const_cast<Complex<Real>*>(sbuf),
         2*sizeof(Real)*sc, MPI_UNSIGNED_CHAR, 
         (UCP)rbuf, byteRcs.data(), byteRds.data(),
@@ -2358,12 +3492,12 @@ EL_NO_RELEASE_EXCEPT
         realRds[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf, realRcs.data(), realRds.data(), TypeMap<Real>(), comm.comm ) );
  #else
     SafeMpi
-    ( MPI_Allgatherv
+    ( traffic::Allgatherv
       ( const_cast<Complex<Real>*>(sbuf), 
         sc, 
         TypeMap<Complex<Real>>(),
@@ -2376,6 +3510,18 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+template<typename T>
+void AllGather( T* rbuf, const int* rcs, const int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    SafeMpi
+    ( traffic::Allgatherv
+      ( MPI_IN_PLACE, 0, TypeMap<T>(),
+        rbuf, const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<T>(),
+        comm.comm ) );
+}
+
 template<typename Real>
 void Scatter
 ( const Real* sbuf, int sc,
@@ -2384,7 +3530,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm ) );
 }
@@ -2406,7 +3552,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, rbuf );
@@ -2478,13 +3624,13 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::Scatter"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), root,
         comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm ) );
@@ -2500,14 +3646,14 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( buf,          sc, TypeMap<Real>(), 
             MPI_IN_PLACE, rc, TypeMap<Real>(), root, comm.comm ) );
     }
     else
     {
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( 0,   sc, TypeMap<Real>(), 
             buf, rc, TypeMap<Real>(), root, comm.comm ) );
     }
@@ -2530,7 +3676,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( rc, buf, packedRecv );
     SafeMpi
-    ( MPI_Scatter
+    ( traffic::Scatter
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), root, comm.comm ) );
     Deserialize( rc, packedRecv, buf );
@@ -2591,12 +3737,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( buf,          2*sc, TypeMap<Real>(), 
             MPI_IN_PLACE, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( buf,          sc, TypeMap<Complex<Real>>(), 
             MPI_IN_PLACE, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -2605,12 +3751,12 @@ EL_NO_RELEASE_EXCEPT
     {
 #ifdef EL_AVOID_COMPLEX_MPI
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( 0,   2*sc, TypeMap<Real>(), 
             buf, 2*rc, TypeMap<Real>(), root, comm.comm ) );
 #else
         SafeMpi
-        ( MPI_Scatter
+        ( traffic::Scatter
           ( 0,   sc, TypeMap<Complex<Real>>(), 
             buf, rc, TypeMap<Complex<Real>>(), root, comm.comm ) );
 #endif
@@ -2625,7 +3771,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), comm.comm ) );
 }
@@ -2645,7 +3791,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( packedSend.data(), sc, TypeMap<T>(),
         packedRecv.data(), rc, TypeMap<T>(), comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -2717,12 +3863,12 @@ EL_NO_RELEASE_EXCEPT
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoall
+    ( traffic::Alltoall
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), comm.comm ) );
 #endif
@@ -2736,7 +3882,7 @@ EL_NO_RELEASE_EXCEPT
 {
     DEBUG_ONLY(CSE cse("mpi::AllToAll"))
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( const_cast<Real*>(sbuf), 
         const_cast<int*>(scs), 
         const_cast<int*>(sds), 
@@ -2764,7 +3910,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( packedSend.data(),
         const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
         packedRecv.data(),
@@ -2850,13 +3996,13 @@ EL_NO_RELEASE_EXCEPT
         rdsDoubled[i] = 2*rds[i];
     }
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf),
               scsDoubled.data(), sdsDoubled.data(), TypeMap<Real>(),
         rbuf, rcsDoubled.data(), rdsDoubled.data(), TypeMap<Real>(), comm.comm ) );
 #else
     SafeMpi
-    ( MPI_Alltoallv
+    ( traffic::Alltoallv
       ( const_cast<Complex<Real>*>(sbuf), 
         const_cast<int*>(scs), 
         const_cast<int*>(sds), 
@@ -2909,7 +4055,7 @@ EL_NO_RELEASE_EXCEPT
         opC = op.op;
 
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
         opC, root, comm.comm ) );
 }
@@ -2941,7 +4087,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -3023,7 +4169,7 @@ EL_NO_RELEASE_EXCEPT
     if( op == SUM )
     {
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, 2*count, TypeMap<Real>(), opC, 
             root, comm.comm ) );
@@ -3031,13 +4177,13 @@ EL_NO_RELEASE_EXCEPT
     else
     {
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
     }
 #else
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( const_cast<Complex<Real>*>(sbuf), 
         rbuf, count, TypeMap<Complex<Real>>(), opC, root, comm.comm ) );
 #endif
@@ -3088,13 +4234,13 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
     {
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, root, 
             comm.comm ) );
     }
     else
         SafeMpi
-        ( MPI_Reduce
+        ( traffic::Reduce
           ( buf, 0, count, TypeMap<Real>(), opC, root, comm.comm ) );
 }
 
@@ -3126,7 +4272,7 @@ EL_NO_RELEASE_EXCEPT
     if( commRank == root )
         ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce
+    ( traffic::Reduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, root, comm.comm ) );
     if( commRank == root )
@@ -3200,13 +4346,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, 
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( buf, 0, 2*count, TypeMap<Real>(), opC, root, comm.comm ) );
         }
         else
@@ -3214,13 +4360,13 @@ EL_NO_RELEASE_EXCEPT
             if( commRank == root )
             {
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                     root, comm.comm ) );
             }
             else
                 SafeMpi
-                ( MPI_Reduce
+                ( traffic::Reduce
                   ( buf, 0, count, TypeMap<Complex<Real>>(), opC, 
                     root, comm.comm ) );
         }
@@ -3228,13 +4374,13 @@ EL_NO_RELEASE_EXCEPT
         if( commRank == root )
         {
             SafeMpi
-            ( MPI_Reduce
+            ( traffic::Reduce
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                 root, comm.comm ) );
         }
         else
             SafeMpi
-            ( MPI_Reduce
+            ( traffic::Reduce
               ( buf, 0, count, TypeMap<Complex<Real>>(), opC, root, 
                 comm.comm ) );
 #endif
@@ -3264,7 +4410,7 @@ EL_NO_RELEASE_EXCEPT
             opC = op.op;
 
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC, 
             comm.comm ) );
     }
@@ -3295,7 +4441,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -3374,20 +4520,20 @@ EL_NO_RELEASE_EXCEPT
         if( op == SUM )
         {
             SafeMpi
-            ( MPI_Allreduce
+            ( traffic::Allreduce
                 ( const_cast<Complex<Real>*>(sbuf),
                   rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
         else
         {
             SafeMpi
-            ( MPI_Allreduce
+            ( traffic::Allreduce
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( const_cast<Complex<Real>*>(sbuf), 
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -3428,7 +4574,7 @@ EL_NO_RELEASE_EXCEPT
         opC = op.op;
 
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
 }
 
@@ -3456,7 +4602,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -3525,19 +4671,19 @@ EL_NO_RELEASE_EXCEPT
     if( op == SUM )
     {
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
     }
     else
     {
         SafeMpi
-        ( MPI_Allreduce
+        ( traffic::Allreduce
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), 
             opC, comm.comm ) );
     }
 #else
     SafeMpi
-    ( MPI_Allreduce
+    ( traffic::Allreduce
       ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
         comm.comm ) );
 #endif
@@ -3571,7 +4717,7 @@ EL_NO_RELEASE_EXCEPT
     else
         opC = op.op;
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -3609,7 +4755,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -3695,11 +4841,11 @@ EL_NO_RELEASE_EXCEPT
 #elif defined(EL_HAVE_MPI_REDUCE_SCATTER_BLOCK)
 # ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( sbuf, rbuf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( sbuf, rbuf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -3749,7 +4895,7 @@ EL_NO_RELEASE_EXCEPT
     else
         opC = op.op;
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Real>(), opC, comm.comm ) );
 #else
     const int commSize = Size( comm );
@@ -3787,7 +4933,7 @@ EL_NO_RELEASE_EXCEPT
 
     ReserveSerialized( totalRecv, buf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( packedSend.data(), packedRecv.data(), rc, TypeMap<T>(),
         opC, comm.comm ) );
 
@@ -3866,11 +5012,11 @@ EL_NO_RELEASE_EXCEPT
         opC = op.op;
 # ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, 2*rc, TypeMap<Real>(), opC, comm.comm ) );
 # else
     SafeMpi
-    ( MPI_Reduce_scatter_block
+    ( traffic::Reduce_scatter_block
       ( MPI_IN_PLACE, buf, rc, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 # endif
 #else
@@ -3902,7 +5048,7 @@ EL_NO_RELEASE_EXCEPT
         opC = op.op;
 
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( traffic::Reduce_scatter
       ( const_cast<Real*>(sbuf), 
         rbuf, const_cast<int*>(rcs), TypeMap<Real>(), opC, comm.comm ) );
 }
@@ -3935,7 +5081,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( totalSend, sbuf, packedSend );
     ReserveSerialized( totalRecv, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( traffic::Reduce_scatter
       ( packedSend.data(), packedRecv.data(), const_cast<int*>(rcs),
         TypeMap<T>(), opC, comm.comm ) );
     Deserialize( totalRecv, packedRecv, rbuf );
@@ -4018,21 +5164,21 @@ EL_NO_RELEASE_EXCEPT
         for( int i=0; i<p; ++i )
             rcsDoubled[i] = 2*rcs[i];
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( traffic::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, rcsDoubled.data(), TypeMap<Real>(), opC, comm.comm ) );
     }
     else
     {
         SafeMpi
-        ( MPI_Reduce_scatter
+        ( traffic::Reduce_scatter
           ( const_cast<Complex<Real>*>(sbuf),
             rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), 
             opC, comm.comm ) );
     }
 #else
     SafeMpi
-    ( MPI_Reduce_scatter
+    ( traffic::Reduce_scatter
       ( const_cast<Complex<Real>*>(sbuf), 
         rbuf, const_cast<int*>(rcs), TypeMap<Complex<Real>>(), opC, 
         comm.comm ) );
@@ -4079,7 +5225,7 @@ EL_NO_RELEASE_EXCEPT
             opC = op.op;
 
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(),
             opC, comm.comm ) );
     }
@@ -4108,7 +5254,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, sbuf, packedSend );
     ReserveSerialized( count, rbuf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( traffic::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, rbuf );
@@ -4188,20 +5334,20 @@ EL_NO_RELEASE_EXCEPT
         if( op == SUM )
         {
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
         else
         {
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( const_cast<Complex<Real>*>(sbuf),
                 rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
         }
 #else
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( const_cast<Complex<Real>*>(sbuf), 
             rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm ) );
 #endif
@@ -4249,7 +5395,7 @@ EL_NO_RELEASE_EXCEPT
             opC = op.op;
 
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm ) );
     }
 }
@@ -4277,7 +5423,7 @@ EL_NO_RELEASE_EXCEPT
     Serialize( count, buf, packedSend );
     ReserveSerialized( count, buf, packedRecv );
     SafeMpi
-    ( MPI_Scan
+    ( traffic::Scan
       ( packedSend.data(), packedRecv.data(), count, TypeMap<T>(),
         opC, comm.comm ) );
     Deserialize( count, packedRecv, buf );
@@ -4345,19 +5491,19 @@ EL_NO_RELEASE_EXCEPT
         if( op == SUM )
         {
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm ) );
         }
         else
         {
             SafeMpi
-            ( MPI_Scan
+            ( traffic::Scan
               ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
                 comm.comm ) );
         }
 #else
         SafeMpi
-        ( MPI_Scan
+        ( traffic::Scan
           ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC, 
             comm.comm ) );
 #endif
@@ -4424,6 +5570,367 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+Int MaxCount() { return ::maxCount; }
+
+void SetMaxCount( Int maxCount )
+{
+    if( maxCount < 1 || maxCount > std::numeric_limits<int>::max() )
+        LogicError("Invalid maximum count of ",maxCount);
+    ::maxCount = maxCount;
+}
+
+#ifdef EL_USE_64BIT_INTS
+namespace {
+
+bool CountsFit( const Int* counts, const Int* displs, int n )
+{
+    const Int maxCount = MaxCount();
+    for( int q=0; q<n; ++q )
+        if( counts[q] > maxCount || displs[q] > maxCount )
+            return false;
+    return true;
+}
+
+vector<int> IntCopy( const Int* counts, int n )
+{ return vector<int>( counts, counts+n ); }
+
+// The number of messages needed for sending 'count' entries
+Int NumChunks( Int count )
+{ return ( count == 0 ? 0 : (count+MaxCount()-1)/MaxCount() ); }
+
+// Since messages between a pair of processes are non-overtaking, the
+// chunks of each send match those of the corresponding receive
+template<typename T>
+void ChunkedISend
+( const T* buf, Int count, int to, Comm comm, Request<T>* requests )
+{
+    const Int maxCount = MaxCount();
+    for( Int off=0; off<count; off+=maxCount )
+        ISend
+        ( &buf[off], int(Min(maxCount,count-off)), to, comm, *requests++ );
+}
+
+template<typename T>
+void ChunkedIRecv
+( T* buf, Int count, int from, Comm comm, Request<T>* requests )
+{
+    const Int maxCount = MaxCount();
+    for( Int off=0; off<count; off+=maxCount )
+        IRecv
+        ( &buf[off], int(Min(maxCount,count-off)), from, comm, *requests++ );
+}
+
+} // anonymous namespace
+
+template<typename T>
+void Gather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds,
+  int root, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::Gather"))
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    bool fits = ( sc <= MaxCount() );
+    if( commRank == root )
+        fits = fits && CountsFit( rcs, rds, commSize );
+    if( AllReduce( int(fits), MIN, comm ) )
+    {
+        vector<int> rcsInt, rdsInt;
+        if( commRank == root )
+        {
+            rcsInt = IntCopy( rcs, commSize );
+            rdsInt = IntCopy( rds, commSize );
+        }
+        Gather
+        ( sbuf, int(sc), rbuf, rcsInt.data(), rdsInt.data(), root, comm );
+        return;
+    }
+
+    if( commRank == root )
+    {
+        Int numChunks = 0;
+        for( int q=0; q<commSize; ++q )
+            if( q != root )
+                numChunks += NumChunks( rcs[q] );
+        vector<Request<T>> requests( numChunks );
+        Int offset = 0;
+        for( int q=0; q<commSize; ++q )
+        {
+            if( q == root )
+                continue;
+            ChunkedIRecv
+            ( &rbuf[rds[q]], rcs[q], q, comm, &requests[offset] );
+            offset += NumChunks( rcs[q] );
+        }
+        std::copy( sbuf, sbuf+sc, &rbuf[rds[root]] );
+        WaitAll( int(numChunks), requests.data() );
+    }
+    else
+    {
+        vector<Request<T>> requests( NumChunks(sc) );
+        ChunkedISend( sbuf, sc, root, comm, requests.data() );
+        WaitAll( int(requests.size()), requests.data() );
+    }
+}
+
+template<typename T>
+void AllGather
+( const T* sbuf, Int sc,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    // Every process knows all of the counts, so no agreement is required
+    if( CountsFit( rcs, rds, commSize ) )
+    {
+        auto rcsInt = IntCopy( rcs, commSize );
+        auto rdsInt = IntCopy( rds, commSize );
+        AllGather
+        ( sbuf, int(sc), rbuf, rcsInt.data(), rdsInt.data(), comm );
+        return;
+    }
+
+    Int numChunks = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank )
+            numChunks += NumChunks( rcs[q] ) + NumChunks( sc );
+    vector<Request<T>> requests( numChunks );
+    Int offset = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        ChunkedIRecv( &rbuf[rds[q]], rcs[q], q, comm, &requests[offset] );
+        offset += NumChunks( rcs[q] );
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        ChunkedISend( sbuf, sc, q, comm, &requests[offset] );
+        offset += NumChunks( sc );
+    }
+    std::copy( sbuf, sbuf+sc, &rbuf[rds[commRank]] );
+    WaitAll( int(numChunks), requests.data() );
+}
+
+template<typename T>
+void AllGather( T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::AllGather"))
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    if( CountsFit( rcs, rds, commSize ) )
+    {
+        auto rcsInt = IntCopy( rcs, commSize );
+        auto rdsInt = IntCopy( rds, commSize );
+        AllGather( rbuf, rcsInt.data(), rdsInt.data(), comm );
+        return;
+    }
+
+    const T* sbuf = &rbuf[rds[commRank]];
+    const Int sc = rcs[commRank];
+    Int numChunks = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank )
+            numChunks += NumChunks( rcs[q] ) + NumChunks( sc );
+    vector<Request<T>> requests( numChunks );
+    Int offset = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        ChunkedIRecv( &rbuf[rds[q]], rcs[q], q, comm, &requests[offset] );
+        offset += NumChunks( rcs[q] );
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        ChunkedISend( sbuf, sc, q, comm, &requests[offset] );
+        offset += NumChunks( sc );
+    }
+    WaitAll( int(numChunks), requests.data() );
+}
+
+template<typename T>
+void AllToAll
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::AllToAll"))
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    const bool fits =
+      CountsFit( scs, sds, commSize ) && CountsFit( rcs, rds, commSize );
+    if( AllReduce( int(fits), MIN, comm ) )
+    {
+        auto scsInt = IntCopy( scs, commSize );
+        auto sdsInt = IntCopy( sds, commSize );
+        auto rcsInt = IntCopy( rcs, commSize );
+        auto rdsInt = IntCopy( rds, commSize );
+        AllToAll
+        ( sbuf, scsInt.data(), sdsInt.data(),
+          rbuf, rcsInt.data(), rdsInt.data(), comm );
+        return;
+    }
+
+    Int numChunks = 0;
+    for( int q=0; q<commSize; ++q )
+        if( q != commRank )
+            numChunks += NumChunks( rcs[q] ) + NumChunks( scs[q] );
+    vector<Request<T>> requests( numChunks );
+    Int offset = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        ChunkedIRecv( &rbuf[rds[q]], rcs[q], q, comm, &requests[offset] );
+        offset += NumChunks( rcs[q] );
+    }
+    for( int q=0; q<commSize; ++q )
+    {
+        if( q == commRank )
+            continue;
+        ChunkedISend( &sbuf[sds[q]], scs[q], q, comm, &requests[offset] );
+        offset += NumChunks( scs[q] );
+    }
+    const T* selfSend = &sbuf[sds[commRank]];
+    std::copy( selfSend, selfSend+scs[commRank], &rbuf[rds[commRank]] );
+    WaitAll( int(numChunks), requests.data() );
+}
+
+# define LARGE_COUNT_PROTO(T) \
+  template void Gather \
+  ( const T* sbuf, Int sc, T* rbuf, const Int* rcs, const Int* rds, \
+    int root, Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  template void AllGather \
+  ( const T* sbuf, Int sc, T* rbuf, const Int* rcs, const Int* rds, \
+    Comm comm ) EL_NO_RELEASE_EXCEPT; \
+  template void AllToAll \
+  ( const T* sbuf, const Int* scs, const Int* sds, \
+          T* rbuf, const Int* rcs, const Int* rds, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT;
+#else
+# define LARGE_COUNT_PROTO(T)
+#endif
+
+#ifdef EL_HAVE_MPI3_RMA
+template<typename T>
+void WindowCreate( T* buf, Int size, Comm comm, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowCreate"))
+    SafeMpi
+    ( traffic::Win_create
+      ( buf, MPI_Aint(size)*sizeof(T), sizeof(T), comm.comm, &window ) );
+}
+
+void WindowFree( Window& window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowFree"))
+    SafeMpi( traffic::Win_free( &window ) );
+}
+
+template<typename T>
+void WindowAllocateShared( Int size, Comm comm, T*& buf, Window& window )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowAllocateShared"))
+    SafeMpi
+    ( traffic::Win_allocate_shared
+      ( MPI_Aint(size)*sizeof(T), sizeof(T), comm.comm, &buf, &window ) );
+}
+
+template<typename T>
+T* WindowSharedQuery( int rank, Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowSharedQuery"))
+    MPI_Aint size;
+    int dispUnit;
+    T* buf;
+    SafeMpi( MPI_Win_shared_query( window, rank, &size, &dispUnit, &buf ) );
+    return buf;
+}
+
+void WindowLockAll( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowLockAll"))
+    SafeMpi( traffic::Win_lock_all( window ) );
+}
+
+void WindowUnlockAll( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowUnlockAll"))
+    SafeMpi( traffic::Win_unlock_all( window ) );
+}
+
+void WindowFlushLocal( int rank, Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowFlushLocal"))
+    SafeMpi( traffic::Win_flush_local( rank, window ) );
+}
+
+void WindowFlushAll( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowFlushAll"))
+    SafeMpi( traffic::Win_flush_all( window ) );
+}
+
+void WindowSync( Window window ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::WindowSync"))
+    SafeMpi( traffic::Win_sync( window ) );
+}
+
+template<typename T>
+void Accumulate
+( const T* buf, const Int* offsets, int count, int target, Window window )
+EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_ONLY(CSE cse("mpi::Accumulate"))
+    // The scattered target entries are described by a single datatype (with
+    // byte displacements so that large local buffers are supported)
+    vector<MPI_Aint> displs(count);
+    for( int k=0; k<count; ++k )
+        displs[k] = MPI_Aint(offsets[k])*sizeof(T);
+    Datatype targetType;
+    SafeMpi
+    ( MPI_Type_create_hindexed_block
+      ( count, 1, displs.data(), TypeMap<T>(), &targetType ) );
+    SafeMpi( MPI_Type_commit( &targetType ) );
+    SafeMpi
+    ( traffic::Accumulate
+      ( const_cast<T*>(buf), count, TypeMap<T>(), target, targetType,
+        MPI_SUM, window ) );
+    SafeMpi( MPI_Type_free( &targetType ) );
+}
+
+// Only the predefined datatypes may be accumulated with the predefined
+// operations
+# define RMA_PROTO(T) \
+  template void WindowCreate \
+  ( T* buf, Int size, Comm comm, Window& window ) EL_NO_RELEASE_EXCEPT; \
+  template void WindowAllocateShared \
+  ( Int size, Comm comm, T*& buf, Window& window ) EL_NO_RELEASE_EXCEPT; \
+  template T* WindowSharedQuery \
+  ( int rank, Window window ) EL_NO_RELEASE_EXCEPT; \
+  template void Accumulate \
+  ( const T* buf, const Int* offsets, int count, int target, \
+    Window window ) EL_NO_RELEASE_EXCEPT;
+RMA_PROTO(Int)
+RMA_PROTO(float)
+RMA_PROTO(double)
+RMA_PROTO(Complex<float>)
+RMA_PROTO(Complex<double>)
+#endif
+
 #define MPI_PROTO(T) \
   template bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
@@ -4599,7 +6106,8 @@ EL_NO_RELEASE_EXCEPT
   template void Scan( T* buf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Scan( T* buf, int count, Comm comm ) \
-  EL_NO_RELEASE_EXCEPT;
+  EL_NO_RELEASE_EXCEPT; \
+  LARGE_COUNT_PROTO(T)
 
 MPI_PROTO(byte)
 MPI_PROTO(int)
@@ -4652,6 +6160,92 @@ MPI_PROTO(Entry<BigFloat>)
 // TODO: MPI_PROTO(Entry<Complex<BigFloat>>)
 #endif
 
+#ifdef EL_USE_64BIT_INTS
+# define LARGE_COUNT_IN_PLACE_PROTO(T) \
+  template void AllGather \
+  ( T* rbuf, const Int* rcs, const Int* rds, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT;
+#else
+# define LARGE_COUNT_IN_PLACE_PROTO(T)
+#endif
+
+#define MPI_IN_PLACE_PROTO(T) \
+  template void AllGather \
+  ( T* rbuf, const int* rcs, const int* rds, Comm comm ) \
+  EL_NO_RELEASE_EXCEPT; \
+  LARGE_COUNT_IN_PLACE_PROTO(T)
+
+#define MPI_NONBLOCKING_PROTO(T) \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
+  template void IAllToAll \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, \
+    Request<T>& request ); \
+  template void IAllToAll \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Comm comm, Request<T>& request ); \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
+// The arbitrary-precision types are excluded since they must be serialized
+#define MPI_UNSERIALIZED_PROTO(T) \
+  MPI_IN_PLACE_PROTO(T) \
+  MPI_NONBLOCKING_PROTO(T)
+
+MPI_UNSERIALIZED_PROTO(byte)
+MPI_UNSERIALIZED_PROTO(int)
+MPI_UNSERIALIZED_PROTO(unsigned)
+MPI_UNSERIALIZED_PROTO(long int)
+MPI_UNSERIALIZED_PROTO(unsigned long)
+#ifdef EL_HAVE_MPI_LONG_LONG
+MPI_UNSERIALIZED_PROTO(long long int)
+MPI_UNSERIALIZED_PROTO(unsigned long long)
+#endif
+MPI_UNSERIALIZED_PROTO(ValueInt<Int>)
+MPI_UNSERIALIZED_PROTO(Entry<Int>)
+MPI_UNSERIALIZED_PROTO(float)
+MPI_UNSERIALIZED_PROTO(Complex<float>)
+MPI_UNSERIALIZED_PROTO(ValueInt<float>)
+MPI_UNSERIALIZED_PROTO(ValueInt<Complex<float>>)
+MPI_UNSERIALIZED_PROTO(Entry<float>)
+MPI_UNSERIALIZED_PROTO(Entry<Complex<float>>)
+MPI_UNSERIALIZED_PROTO(double)
+MPI_UNSERIALIZED_PROTO(Complex<double>)
+MPI_UNSERIALIZED_PROTO(ValueInt<double>)
+MPI_UNSERIALIZED_PROTO(ValueInt<Complex<double>>)
+MPI_UNSERIALIZED_PROTO(Entry<double>)
+MPI_UNSERIALIZED_PROTO(Entry<Complex<double>>)
+#ifdef EL_HAVE_QD
+MPI_UNSERIALIZED_PROTO(DoubleDouble)
+MPI_UNSERIALIZED_PROTO(QuadDouble)
+MPI_UNSERIALIZED_PROTO(ValueInt<DoubleDouble>)
+MPI_UNSERIALIZED_PROTO(ValueInt<QuadDouble>)
+MPI_UNSERIALIZED_PROTO(Entry<DoubleDouble>)
+MPI_UNSERIALIZED_PROTO(Entry<QuadDouble>)
+#endif
+#ifdef EL_HAVE_QUAD
+MPI_UNSERIALIZED_PROTO(Quad)
+MPI_UNSERIALIZED_PROTO(Complex<Quad>)
+MPI_UNSERIALIZED_PROTO(ValueInt<Quad>)
+MPI_UNSERIALIZED_PROTO(ValueInt<Complex<Quad>>)
+MPI_UNSERIALIZED_PROTO(Entry<Quad>)
+MPI_UNSERIALIZED_PROTO(Entry<Complex<Quad>>)
+#endif
+
 #define PROTO(T) \
   template void SparseAllToAll \
   ( const vector<T>& sendBuffer, \
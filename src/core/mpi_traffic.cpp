@@ -0,0 +1,229 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <set>
+
+namespace {
+using namespace El;
+
+std::atomic<bool> trafficEnabled(false);
+std::mutex trafficMutex;
+mpi::TrafficCounterMap trafficCounters;
+
+const char* trafficRoutineNames[mpi::NUM_TRAFFIC_ROUTINES] =
+{
+  "Accumulate",
+  "AllGather",
+  "AllReduce",
+  "AllToAll",
+  "Barrier",
+  "Broadcast",
+  "Gather",
+  "IAllGather",
+  "IAllReduce",
+  "IAllToAll",
+  "IBroadcast",
+  "IGather",
+  "IRecv",
+  "IReduceScatter",
+  "ISend",
+  "Recv",
+  "Reduce",
+  "ReduceScatter",
+  "Scan",
+  "Scatter",
+  "Send",
+  "SendRecv",
+  "Wait",
+  "WindowCreate",
+  "WindowFree",
+  "WindowSync"
+};
+
+// Suspends the counters so that reporting them does not perturb them
+class SuspendTraffic
+{
+public:
+    SuspendTraffic() : wasEnabled_(::trafficEnabled) { ::trafficEnabled = false; }
+    ~SuspendTraffic() { ::trafficEnabled = wasEnabled_; }
+private:
+    bool wasEnabled_;
+};
+
+} // anonymous namespace
+
+namespace El {
+namespace mpi {
+
+string TrafficRoutineName( TrafficRoutine routine )
+{
+    if( routine < 0 || routine >= NUM_TRAFFIC_ROUTINES )
+        LogicError("Invalid traffic routine");
+    return ::trafficRoutineNames[routine];
+}
+
+void EnableTrafficCounters() { ::trafficEnabled = true; }
+void DisableTrafficCounters() { ::trafficEnabled = false; }
+bool TrafficCountersEnabled() EL_NO_EXCEPT { return ::trafficEnabled; }
+
+void ResetTrafficCounters()
+{
+    std::lock_guard<std::mutex> guard( ::trafficMutex );
+    ::trafficCounters.clear();
+}
+
+TrafficCounterMap TrafficCounters()
+{
+    std::lock_guard<std::mutex> guard( ::trafficMutex );
+    return ::trafficCounters;
+}
+
+TrafficCounter TrafficCounters( TrafficRoutine routine, const string& commName )
+{
+    std::lock_guard<std::mutex> guard( ::trafficMutex );
+    auto it = ::trafficCounters.find( std::make_pair(routine,commName) );
+    if( it == ::trafficCounters.end() )
+        return TrafficCounter();
+    return it->second;
+}
+
+void RecordTraffic
+( TrafficRoutine routine, Comm comm,
+  long long bytesSent, long long bytesRecv, double time )
+{
+    // Requests are not associated with a communicator
+    string commName;
+    if( comm != COMM_NULL )
+    {
+        commName = CommName( comm );
+        if( commName.empty() )
+            commName = "unnamed";
+    }
+    std::lock_guard<std::mutex> guard( ::trafficMutex );
+    TrafficCounter& counter =
+      ::trafficCounters[std::make_pair(routine,commName)];
+    ++counter.numCalls;
+    counter.bytesSent += bytesSent;
+    counter.bytesRecv += bytesRecv;
+    counter.time += time;
+}
+
+void PrintTrafficCounters( Comm comm, ostream& os )
+{
+    DEBUG_ONLY(CSE cse("mpi::PrintTrafficCounters"))
+    SuspendTraffic suspend;
+    const int commSize = Size( comm );
+    const int commRank = Rank( comm );
+    const int root = 0;
+    const auto localCounters = TrafficCounters();
+
+    // Form the union of the (routine,communicator) keys on the root
+    string localKeys;
+    for( const auto& entry : localCounters )
+        localKeys += std::to_string(int(entry.first.first)) + ' ' +
+                     entry.first.second + '\n';
+    const int localSize = localKeys.size();
+    vector<int> sizes( commRank == root ? commSize : 0 ), offs;
+    Gather( &localSize, 1, sizes.data(), 1, root, comm );
+    vector<byte> allKeys;
+    if( commRank == root )
+        allKeys.resize( El::Scan( sizes, offs ) );
+    Gather
+    ( reinterpret_cast<const byte*>(localKeys.data()), localSize,
+      allKeys.data(), sizes.data(), offs.data(), root, comm );
+
+    string unionKeys;
+    if( commRank == root )
+    {
+        std::set<std::pair<int,string>> keySet;
+        std::istringstream keyStream( string(allKeys.begin(),allKeys.end()) );
+        string line;
+        while( std::getline( keyStream, line ) )
+        {
+            const auto space = line.find( ' ' );
+            keySet.insert
+            ( std::make_pair
+              ( std::stoi(line.substr(0,space)), line.substr(space+1) ) );
+        }
+        for( const auto& key : keySet )
+            unionKeys += std::to_string(key.first) + ' ' + key.second + '\n';
+    }
+    int unionSize = unionKeys.size();
+    Broadcast( unionSize, root, comm );
+    vector<byte> unionBuf( unionKeys.begin(), unionKeys.end() );
+    unionBuf.resize( unionSize );
+    Broadcast( unionBuf.data(), unionSize, root, comm );
+
+    vector<std::pair<TrafficRoutine,string>> keys;
+    {
+        std::istringstream keyStream( string(unionBuf.begin(),unionBuf.end()) );
+        string line;
+        while( std::getline( keyStream, line ) )
+        {
+            const auto space = line.find( ' ' );
+            keys.push_back
+            ( std::make_pair
+              ( TrafficRoutine(std::stoi(line.substr(0,space))),
+                line.substr(space+1) ) );
+        }
+    }
+
+    // Reduce the counters of each key
+    const Int numKeys = keys.size();
+    vector<long long> counts(3*numKeys,0), countSums(3*numKeys);
+    vector<double> times(numKeys,0), timeSums(numKeys), timeMaxs(numKeys);
+    for( Int k=0; k<numKeys; ++k )
+    {
+        auto it = localCounters.find( keys[k] );
+        if( it == localCounters.end() )
+            continue;
+        counts[3*k+0] = it->second.numCalls;
+        counts[3*k+1] = it->second.bytesSent;
+        counts[3*k+2] = it->second.bytesRecv;
+        times[k] = it->second.time;
+    }
+    Reduce( counts.data(), countSums.data(), 3*numKeys, SUM, root, comm );
+    Reduce( times.data(), timeSums.data(), numKeys, SUM, root, comm );
+    Reduce( times.data(), timeMaxs.data(), numKeys, MAX, root, comm );
+    if( commRank != root )
+        return;
+
+    const int width = 14;
+    std::ostringstream msg;
+    msg << "MPI traffic summed over " << commSize << " process"
+        << ( commSize == 1 ? "" : "es" ) << "\n"
+        << std::left << std::setw(width) << "Routine"
+        << std::setw(width) << "Comm" << std::right
+        << std::setw(width) << "Calls"
+        << std::setw(width) << "Bytes sent"
+        << std::setw(width) << "Bytes recv"
+        << std::setw(width) << "Time (s)"
+        << std::setw(width) << "Max time (s)" << "\n"
+        << std::setprecision(4);
+    for( Int k=0; k<numKeys; ++k )
+    {
+        const string& commName = keys[k].second;
+        msg << std::left << std::setw(width) << TrafficRoutineName(keys[k].first)
+            << std::setw(width) << ( commName.empty() ? "-" : commName )
+            << std::right
+            << std::setw(width) << countSums[3*k+0]
+            << std::setw(width) << countSums[3*k+1]
+            << std::setw(width) << countSums[3*k+2]
+            << std::setw(width) << timeSums[k]
+            << std::setw(width) << timeMaxs[k] << "\n";
+    }
+    os << msg.str() << std::flush;
+}
+
+} // namespace mpi
+} // namespace El
@@ -8,6 +8,23 @@
 */
 #include "El.hpp"
 
+#include <atomic>
+
+namespace {
+
+// The seed and the number of streams used by the counter-based generator
+std::atomic<unsigned long long> counterSeed(21), numCounterStreams(0);
+
+// The finalizer of SplitMix64
+unsigned long long Mix( unsigned long long z )
+{
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+} // anonymous namespace
+
 namespace El {
 
 bool BooleanCoinFlip()
@@ -304,4 +321,30 @@ BigFloat SampleNormal( const BigFloat& mean, const BigFloat& stddev )
 }
 #endif // ifdef EL_HAVE_MPC
 
+PhiloxKey CounterKey
+( unsigned long long seed, unsigned long long stream ) EL_NO_EXCEPT
+{
+    const std::uint64_t mixed = ::Mix( seed ^ ::Mix(stream+1) );
+    return {{ std::uint32_t(mixed), std::uint32_t(mixed>>32) }};
+}
+
+void SetCounterSeed( unsigned long long seed )
+{
+    ::counterSeed = seed;
+    ::numCounterStreams = 0;
+}
+
+unsigned long long CounterSeed() { return ::counterSeed; }
+
+unsigned long long NextCounterStream( mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("NextCounterStream"))
+    // Processes which took part in different numbers of fills (e.g., over
+    // different subgrids) agree upon the largest of their stream indices
+    const unsigned long long stream = mpi::AllReduce
+      ( static_cast<unsigned long>(::numCounterStreams), mpi::MAX, comm );
+    ::numCounterStreams = stream+1;
+    return stream;
+}
+
 } // namespace El
@@ -0,0 +1,398 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <tuple>
+
+namespace {
+using namespace El;
+
+// (routine,datatype,gridHeight,gridWidth) -> blocksize
+typedef std::tuple<string,string,int,int> TuningKey;
+typedef std::map<TuningKey,Int> TuningTable;
+
+// Readers (every blocked routine, from any thread) take an immutable snapshot
+// of the table with std::atomic_load, while writers serialize on tuningMutex
+// and publish a modified copy with std::atomic_store
+std::shared_ptr<const TuningTable> tunedBlocksizes =
+  std::make_shared<const TuningTable>();
+std::mutex tuningMutex;
+
+template<typename Modify>
+void UpdateTunedBlocksizes( Modify modify )
+{
+    std::lock_guard<std::mutex> lock( ::tuningMutex );
+    auto table =
+      std::make_shared<TuningTable>( *std::atomic_load(&::tunedBlocksizes) );
+    modify( *table );
+    std::atomic_store
+    ( &::tunedBlocksizes, std::shared_ptr<const TuningTable>(table) );
+}
+
+CostModel costModel;
+
+string Trim( const string& s )
+{
+    const auto first = s.find_first_not_of(" \t\r");
+    if( first == string::npos )
+        return string();
+    const auto last = s.find_last_not_of(" \t\r");
+    return s.substr( first, last-first+1 );
+}
+
+// Read the file on the root and broadcast its contents so that every process
+// makes identical decisions (the description names the file in the error
+// raised on every process if it could not be opened)
+string ReadAndBroadcastFile
+( const string& filename, const string& description, mpi::Comm comm )
+{
+    const int root = 0;
+    string contents;
+    int size = -1;
+    if( mpi::Rank(comm) == root )
+    {
+        std::ifstream file( filename.c_str() );
+        if( file.is_open() )
+        {
+            std::ostringstream os;
+            os << file.rdbuf();
+            contents = os.str();
+            size = contents.size();
+        }
+    }
+    mpi::Broadcast( size, root, comm );
+    if( size < 0 )
+        RuntimeError("Could not open ",description," file ",filename);
+    vector<byte> buf( contents.begin(), contents.end() );
+    buf.resize( size );
+    mpi::Broadcast( buf.data(), size, root, comm );
+    return string( buf.begin(), buf.end() );
+}
+
+} // anonymous namespace
+
+namespace El {
+
+Int Blocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth )
+{
+    const Context& context = ThreadContext();
+    if( context.BlocksizeSpecified() )
+        return context.Blocksize();
+    const auto table = std::atomic_load( &::tunedBlocksizes );
+    if( table->empty() )
+        return context.Blocksize();
+
+    auto it = table->find
+      ( std::make_tuple(routine,typeName,gridHeight,gridWidth) );
+    if( it != table->end() )
+        return it->second;
+
+    // Fall back to the entry for the same routine and datatype whose grid has
+    // the closest number of processes (measured logarithmically)
+    const double logSize = std::log(double(gridHeight*gridWidth));
+    double minDist = std::numeric_limits<double>::max();
+    Int blocksize = context.Blocksize();
+    it = table->lower_bound
+      ( std::make_tuple
+        (routine,typeName,
+         std::numeric_limits<int>::min(),std::numeric_limits<int>::min()) );
+    for( ; it != table->end(); ++it )
+    {
+        const TuningKey& key = it->first;
+        if( std::get<0>(key) != routine || std::get<1>(key) != typeName )
+            break;
+        const double dist =
+          std::abs(std::log(double(std::get<2>(key)*std::get<3>(key)))-logSize);
+        if( dist < minDist )
+        {
+            minDist = dist;
+            blocksize = it->second;
+        }
+    }
+    return blocksize;
+}
+
+void SetTunedBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth, Int blocksize )
+{
+    DEBUG_ONLY(CSE cse("SetTunedBlocksize"))
+    if( routine.empty() || routine.find_first_of(" \t\n#") != string::npos )
+        LogicError("Invalid routine name \"",routine,"\"");
+    if( gridHeight <= 0 || gridWidth <= 0 )
+        LogicError("Invalid grid shape ",gridHeight," x ",gridWidth);
+    if( blocksize <= 0 )
+        LogicError("Invalid blocksize ",blocksize);
+    const TuningKey key =
+      std::make_tuple(routine,typeName,gridHeight,gridWidth);
+    ::UpdateTunedBlocksizes
+    ( [&]( TuningTable& table ) { table[key] = blocksize; } );
+}
+
+void ClearTunedBlocksizes()
+{
+    std::lock_guard<std::mutex> lock( ::tuningMutex );
+    std::atomic_store
+    ( &::tunedBlocksizes, std::make_shared<const TuningTable>() );
+}
+
+void LoadBlocksizeTuning( const string& filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("LoadBlocksizeTuning"))
+    const string contents =
+      ::ReadAndBroadcastFile( filename, "blocksize tuning", comm );
+
+    // Parse the whole file before publishing its entries in a single update
+    vector<std::pair<TuningKey,Int>> entries;
+    std::istringstream stream( contents );
+    string line;
+    Int lineNum = 0;
+    while( std::getline( stream, line ) )
+    {
+        ++lineNum;
+        line = ::Trim( line.substr( 0, line.find('#') ) );
+        if( line.empty() )
+            continue;
+
+        std::istringstream lineStream( line );
+        string routine, typeName;
+        int gridHeight, gridWidth;
+        Int blocksize;
+        lineStream >> routine >> gridHeight >> gridWidth >> blocksize;
+        // The datatype (e.g., "long long int") may contain spaces
+        std::getline( lineStream, typeName );
+        typeName = ::Trim( typeName );
+        if( lineStream.fail() || typeName.empty() ||
+            gridHeight <= 0 || gridWidth <= 0 || blocksize <= 0 )
+            RuntimeError
+            ("Invalid entry on line ",lineNum," of ",filename,": ",line);
+        entries.emplace_back
+        ( std::make_tuple(routine,typeName,gridHeight,gridWidth), blocksize );
+    }
+    ::UpdateTunedBlocksizes
+    ( [&]( TuningTable& table )
+      {
+          for( const auto& entry : entries )
+              table[entry.first] = entry.second;
+      } );
+}
+
+void SaveBlocksizeTuning( const string& filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("SaveBlocksizeTuning"))
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file << "# <routine> <gridHeight> <gridWidth> <blocksize> <datatype>\n";
+    const auto table = std::atomic_load( &::tunedBlocksizes );
+    for( const auto& entry : *table )
+    {
+        const TuningKey& key = entry.first;
+        file << std::get<0>(key) << " "
+             << std::get<2>(key) << " " << std::get<3>(key) << " "
+             << entry.second << " " << std::get<1>(key) << "\n";
+    }
+}
+
+Int TuneBlocksize
+( const string& routine, const string& typeName,
+  int gridHeight, int gridWidth,
+  const vector<Int>& candidates, function<void()> run,
+  mpi::Comm comm, Int numReps )
+{
+    DEBUG_ONLY(
+      CSE cse("TuneBlocksize");
+      if( candidates.empty() )
+          LogicError("No candidate blocksizes were given");
+      if( numReps <= 0 )
+          LogicError("Invalid number of repetitions");
+    )
+    Int bestBlocksize = candidates[0];
+    double bestTime = std::numeric_limits<double>::max();
+    Timer timer;
+    for( const Int blocksize : candidates )
+    {
+        PushBlocksizeStack( blocksize );
+        double minTime = std::numeric_limits<double>::max();
+        try
+        {
+            for( Int rep=0; rep<numReps; ++rep )
+            {
+                mpi::Barrier( comm );
+                timer.Start();
+                run();
+                minTime = Min( minTime, timer.Stop() );
+            }
+        }
+        catch( ... )
+        {
+            PopBlocksizeStack();
+            throw;
+        }
+        PopBlocksizeStack();
+
+        const double time = mpi::AllReduce( minTime, mpi::MAX, comm );
+        if( time < bestTime )
+        {
+            bestTime = time;
+            bestBlocksize = blocksize;
+        }
+    }
+    SetTunedBlocksize( routine, typeName, gridHeight, gridWidth, bestBlocksize );
+    return bestBlocksize;
+}
+
+const CostModel& GetCostModel() { return ::costModel; }
+
+void SetCostModel( const CostModel& model )
+{
+    DEBUG_ONLY(CSE cse("SetCostModel"))
+    if( !(model.alpha >= 0.) || !(model.beta >= 0.) || !(model.gamma > 0.) )
+        LogicError
+        ("Invalid cost model (alpha=",model.alpha,", beta=",model.beta,
+         ", gamma=",model.gamma,")");
+    ::costModel = model;
+}
+
+void ResetCostModel() { ::costModel = CostModel(); }
+
+CostModel CalibrateCostModel( mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("CalibrateCostModel"))
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    const Int numReps = 10;
+    CostModel model = ::costModel;
+    Timer timer;
+
+    // Time the exchange of a small and a large message between pairs of
+    // processes (an unpaired process sits out)
+    if( commSize > 1 )
+    {
+        const int partner = commRank ^ 1;
+        const bool paired = ( partner < commSize );
+        const int smallSize = 1;
+        const int largeSize = 1 << 17;
+        vector<double> sendBuf(largeSize,1.), recvBuf(largeSize);
+        double smallTime = std::numeric_limits<double>::max();
+        double largeTime = std::numeric_limits<double>::max();
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            mpi::Barrier( comm );
+            if( paired )
+            {
+                timer.Start();
+                mpi::SendRecv
+                ( sendBuf.data(), smallSize, partner,
+                  recvBuf.data(), smallSize, partner, comm );
+                smallTime = Min( smallTime, timer.Stop() );
+            }
+            mpi::Barrier( comm );
+            if( paired )
+            {
+                timer.Start();
+                mpi::SendRecv
+                ( sendBuf.data(), largeSize, partner,
+                  recvBuf.data(), largeSize, partner, comm );
+                largeTime = Min( largeTime, timer.Stop() );
+            }
+        }
+        if( !paired )
+        {
+            smallTime = 0;
+            largeTime = 0;
+        }
+        smallTime = mpi::AllReduce( smallTime, mpi::MAX, comm );
+        largeTime = mpi::AllReduce( largeTime, mpi::MAX, comm );
+        const double largeBytes = double(largeSize)*sizeof(double);
+        model.alpha = smallTime;
+        model.beta = Max( largeTime-smallTime, 0. ) / largeBytes;
+    }
+
+    // Time a local Gemm which is large enough to run near peak
+    const Int n = 256;
+    Matrix<double> A, B, C;
+    Ones( A, n, n );
+    Ones( B, n, n );
+    Zeros( C, n, n );
+    double gemmTime = std::numeric_limits<double>::max();
+    for( Int rep=0; rep<3; ++rep )
+    {
+        timer.Start();
+        Gemm( NORMAL, NORMAL, 1., A, B, 0., C );
+        gemmTime = Min( gemmTime, timer.Stop() );
+    }
+    gemmTime = mpi::AllReduce( gemmTime, mpi::MAX, comm );
+    model.gamma = Max( gemmTime, 1.e-9 ) / (2.*n*n*n);
+
+    SetCostModel( model );
+    return model;
+}
+
+void LoadCostModel( const string& filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("LoadCostModel"))
+    const string contents =
+      ::ReadAndBroadcastFile( filename, "cost model", comm );
+
+    CostModel model = ::costModel;
+    std::istringstream stream( contents );
+    string line;
+    Int lineNum = 0;
+    while( std::getline( stream, line ) )
+    {
+        ++lineNum;
+        line = ::Trim( line.substr( 0, line.find('#') ) );
+        if( line.empty() )
+            continue;
+
+        std::istringstream lineStream( line );
+        string parameter;
+        double value;
+        lineStream >> parameter >> value;
+        if( lineStream.fail() )
+            RuntimeError
+            ("Invalid entry on line ",lineNum," of ",filename,": ",line);
+        if( parameter == "alpha" )
+            model.alpha = value;
+        else if( parameter == "beta" )
+            model.beta = value;
+        else if( parameter == "gamma" )
+            model.gamma = value;
+        else
+            RuntimeError
+            ("Unknown parameter \"",parameter,"\" on line ",lineNum," of ",
+             filename);
+    }
+    SetCostModel( model );
+}
+
+void SaveCostModel( const string& filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CSE cse("SaveCostModel"))
+    if( mpi::Rank(comm) != 0 )
+        return;
+    std::ofstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    file.precision( std::numeric_limits<double>::max_digits10 );
+    file << "# <parameter> <value>\n"
+         << "alpha " << ::costModel.alpha << "\n"
+         << "beta " << ::costModel.beta << "\n"
+         << "gamma " << ::costModel.gamma << "\n";
+}
+
+} // namespace El
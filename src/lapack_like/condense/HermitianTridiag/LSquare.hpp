@@ -53,7 +53,7 @@ void LSquare
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "HermitianTridiag", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);     
@@ -93,7 +93,7 @@ void U
     DistMatrix<F,MC,  STAR> APan_MC_STAR(g), WPan_MC_STAR(g);
     DistMatrix<F,MR,  STAR> APan_MR_STAR(g), WPan_MR_STAR(g);
     
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "HermitianTridiag", APre.Grid() );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
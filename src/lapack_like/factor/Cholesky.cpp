@@ -12,6 +12,7 @@
 #include "./Cholesky/LVar3Pivoted.hpp"
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Pivoted.hpp"
+#include "./Cholesky/Block.hpp"
 #include "./Cholesky/SolveAfter.hpp"
 
 #include "./Cholesky/LMod.hpp"
@@ -112,6 +113,20 @@ void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack )
     }
 }
 
+template<typename F>
+void Cholesky( UpperOrLower uplo, BlockMatrix<F>& A, bool scalapack )
+{
+    DEBUG_ONLY(
+      CSE cse("Cholesky");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+    )
+    if( scalapack )
+        cholesky::ScaLAPACKHelper( uplo, A );
+    else
+        cholesky::Block( uplo, A );
+}
+
 template<typename F> 
 void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, DistPermutation& p )
@@ -211,6 +226,8 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
   template void Cholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A, bool scalapack ); \
   template void Cholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, BlockMatrix<F>& A, bool scalapack ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
@@ -0,0 +1,322 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CHOLESKY_BLOCK_HPP
+#define EL_CHOLESKY_BLOCK_HPP
+
+namespace El {
+namespace cholesky {
+
+// Right-looking Cholesky factorizations over block-cyclic distributions with
+// square diagonal blocks (as in ScaLAPACK's p?potrf). Each diagonal block is
+// broadcast over the entire grid and factored redundantly (as in LVar3, so
+// that a non-HPD matrix raises the same exception on every process), and its
+// process column (row) then solves against it for the rest of the block
+// column (row). That panel
+// is broadcast within the process rows (columns) and exchanged within the
+// process columns (rows) in order to form both copies of the panel needed to
+// update the trailing triangle.
+
+template<typename F>
+inline void
+LowerBlock( BlockMatrix<F>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("cholesky::LowerBlock");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+          LogicError("A must have square diagonal blocks");
+    )
+    const Int n = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    const int colRank = A.ColRank();
+    const int rowRank = A.RowRank();
+    auto& ALoc = A.Matrix();
+    F* ABuf = ALoc.Buffer();
+    const Int ALDim = ALoc.LDim();
+
+    Matrix<F> A11, L21_MC_STAR, L21_MR_STAR, E;
+    vector<F> sendBuf, recvBuf;
+    vector<Int> recvCounts( A.ColStride() ), recvOffs;
+    for( Int k=0; k<n; )
+    {
+        const Int nb = Min( BlockRemainder(k,bsize,cut), n-k );
+        const int ownerRow = A.RowOwner( k );
+        const int ownerCol = A.ColOwner( k );
+        const Int iLoc2 = A.LocalRowOffset( k+nb );
+        const Int jLoc2 = A.LocalColOffset( k+nb );
+        const Int localHeight2 = localHeight - iLoc2;
+        const Int localWidth2 = localWidth - jLoc2;
+
+        // A11[* ,* ] <- A11[MC,MR]; A11 := Cholesky(A11)
+        const Int iLoc1 = A.LocalRowOffset( k );
+        const Int jLoc1 = A.LocalColOffset( k );
+        const bool ownA11 = ( colRank == ownerRow && rowRank == ownerCol );
+        A11.Resize( nb, nb, nb );
+        if( ownA11 )
+            copy::util::InterleaveMatrix
+            ( nb, nb,
+              A.LockedBuffer(iLoc1,jLoc1), 1, A.LDim(),
+              A11.Buffer(),                1, nb );
+        mpi::Broadcast
+        ( A11.Buffer(), nb*nb, ownerRow+ownerCol*A.ColStride(),
+          A.Grid().VCComm() );
+        Cholesky( LOWER, A11 );
+
+        // A21 := A21 A11^-H within the process column which owns them
+        if( rowRank == ownerCol )
+        {
+            if( ownA11 )
+                copy::util::InterleaveMatrix
+                ( nb, nb,
+                  A11.LockedBuffer(),    1, nb,
+                  A.Buffer(iLoc1,jLoc1), 1, A.LDim() );
+            auto A21Loc = ALoc( IR(iLoc2,localHeight), IR(jLoc1,jLoc1+nb) );
+            Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21Loc );
+        }
+
+        // L21[MC,* ] <- A21[MC,MR]
+        L21_MC_STAR.Resize( localHeight2, nb, Max(localHeight2,Int(1)) );
+        if( rowRank == ownerCol )
+            copy::util::InterleaveMatrix
+            ( localHeight2, nb,
+              A.LockedBuffer(iLoc2,A.LocalColOffset(k)), 1, A.LDim(),
+              L21_MC_STAR.Buffer(), 1, L21_MC_STAR.LDim() );
+        mpi::Broadcast
+        ( L21_MC_STAR.Buffer(), localHeight2*nb, ownerCol, A.RowComm() );
+
+        // L21[MR,* ] <- L21[MC,* ]
+        // Row i of L21 is needed by the process column owning column i of
+        // A22, and, since the diagonal blocks are square, each member of that
+        // column holds the rows of L21 in the blocks owned by its process row
+        const F* L21Buf = L21_MC_STAR.LockedBuffer();
+        const Int L21LDim = L21_MC_STAR.LDim();
+        sendBuf.resize( 0 );
+        for( Int iLoc=iLoc2; iLoc<localHeight; ++iLoc )
+            if( A.ColOwner(A.GlobalRow(iLoc)) == rowRank )
+                for( Int t=0; t<nb; ++t )
+                    sendBuf.push_back( L21Buf[(iLoc-iLoc2)+t*L21LDim] );
+        std::fill( recvCounts.begin(), recvCounts.end(), 0 );
+        for( Int jLoc=jLoc2; jLoc<localWidth; ++jLoc )
+            recvCounts[A.RowOwner(A.GlobalCol(jLoc))] += nb;
+        const Int totalRecv = Scan( recvCounts, recvOffs );
+        recvBuf.resize( totalRecv );
+        mpi::AllGather
+        ( sendBuf.data(), Int(sendBuf.size()),
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), A.ColComm() );
+        L21_MR_STAR.Resize( localWidth2, nb, Max(localWidth2,Int(1)) );
+        F* L21MRBuf = L21_MR_STAR.Buffer();
+        const Int L21MRLDim = L21_MR_STAR.LDim();
+        for( Int jLoc=jLoc2; jLoc<localWidth; ++jLoc )
+        {
+            const int owner = A.RowOwner( A.GlobalCol(jLoc) );
+            for( Int t=0; t<nb; ++t )
+                L21MRBuf[(jLoc-jLoc2)+t*L21MRLDim] =
+                  recvBuf[recvOffs[owner]+t];
+            recvOffs[owner] += nb;
+        }
+
+        // A22[MC,MR] -= L21[MC,* ] L21[MR,* ]^H (lower triangle only), one
+        // local block column at a time
+        for( Int jLoc=jLoc2; jLoc<localWidth; )
+        {
+            const Int j = A.GlobalCol( jLoc );
+            const Int width = Min( BlockRemainder(j,bsize,cut), n-j );
+            const Int iLocDiag = A.LocalRowOffset( j );
+            const Int iLocBelow = A.LocalRowOffset( j+width );
+            auto L1 = L21_MR_STAR( IR(jLoc-jLoc2,jLoc-jLoc2+width), ALL );
+            if( iLocBelow > iLocDiag )
+            {
+                // This process owns the diagonal block of the block column
+                auto LDiag =
+                  L21_MC_STAR( IR(iLocDiag-iLoc2,iLocBelow-iLoc2), ALL );
+                Gemm( NORMAL, ADJOINT, F(1), LDiag, L1, E );
+                const F* EBuf = E.LockedBuffer();
+                const Int ELDim = E.LDim();
+                for( Int s=0; s<width; ++s )
+                    for( Int t=s; t<width; ++t )
+                        ABuf[(iLocDiag+t)+(jLoc+s)*ALDim] -= EBuf[t+s*ELDim];
+            }
+            auto LBelow = L21_MC_STAR( IR(iLocBelow-iLoc2,localHeight2), ALL );
+            auto A2Loc = ALoc( IR(iLocBelow,localHeight), IR(jLoc,jLoc+width) );
+            Gemm( NORMAL, ADJOINT, F(-1), LBelow, L1, F(1), A2Loc );
+            jLoc += width;
+        }
+        k += nb;
+    }
+}
+
+template<typename F>
+inline void
+UpperBlock( BlockMatrix<F>& A )
+{
+    DEBUG_ONLY(
+      CSE cse("cholesky::UpperBlock");
+      if( A.Height() != A.Width() )
+          LogicError("A must be square");
+      if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+          LogicError("A must have square diagonal blocks");
+    )
+    const Int n = A.Height();
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    const int colRank = A.ColRank();
+    const int rowRank = A.RowRank();
+    auto& ALoc = A.Matrix();
+    F* ABuf = ALoc.Buffer();
+    const Int ALDim = ALoc.LDim();
+
+    Matrix<F> A11, U12_STAR_MR, U12_STAR_MC, E;
+    vector<F> sendBuf, recvBuf;
+    vector<Int> recvCounts( A.RowStride() ), recvOffs;
+    for( Int k=0; k<n; )
+    {
+        const Int nb = Min( BlockRemainder(k,bsize,cut), n-k );
+        const int ownerRow = A.RowOwner( k );
+        const int ownerCol = A.ColOwner( k );
+        const Int iLoc2 = A.LocalRowOffset( k+nb );
+        const Int jLoc2 = A.LocalColOffset( k+nb );
+        const Int localHeight2 = localHeight - iLoc2;
+        const Int localWidth2 = localWidth - jLoc2;
+
+        // A11[* ,* ] <- A11[MC,MR]; A11 := Cholesky(A11)
+        const Int iLoc1 = A.LocalRowOffset( k );
+        const Int jLoc1 = A.LocalColOffset( k );
+        const bool ownA11 = ( colRank == ownerRow && rowRank == ownerCol );
+        A11.Resize( nb, nb, nb );
+        if( ownA11 )
+            copy::util::InterleaveMatrix
+            ( nb, nb,
+              A.LockedBuffer(iLoc1,jLoc1), 1, A.LDim(),
+              A11.Buffer(),                1, nb );
+        mpi::Broadcast
+        ( A11.Buffer(), nb*nb, ownerRow+ownerCol*A.ColStride(),
+          A.Grid().VCComm() );
+        Cholesky( UPPER, A11 );
+
+        // A12 := A11^-H A12 within the process row which owns them
+        if( colRank == ownerRow )
+        {
+            if( ownA11 )
+                copy::util::InterleaveMatrix
+                ( nb, nb,
+                  A11.LockedBuffer(),    1, nb,
+                  A.Buffer(iLoc1,jLoc1), 1, A.LDim() );
+            auto A12Loc = ALoc( IR(iLoc1,iLoc1+nb), IR(jLoc2,localWidth) );
+            Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12Loc );
+        }
+
+        // U12[* ,MR] <- A12[MC,MR]
+        U12_STAR_MR.Resize( nb, localWidth2, nb );
+        if( colRank == ownerRow )
+            copy::util::InterleaveMatrix
+            ( nb, localWidth2,
+              A.LockedBuffer(A.LocalRowOffset(k),jLoc2), 1, A.LDim(),
+              U12_STAR_MR.Buffer(),                      1, nb );
+        mpi::Broadcast
+        ( U12_STAR_MR.Buffer(), nb*localWidth2, ownerRow, A.ColComm() );
+
+        // U12[* ,MC] <- U12[* ,MR]
+        // Column i of U12 is needed by the process row owning row i of A22,
+        // and, since the diagonal blocks are square, each member of that row
+        // holds the columns of U12 in the blocks owned by its process column
+        const F* U12Buf = U12_STAR_MR.LockedBuffer();
+        sendBuf.resize( 0 );
+        for( Int jLoc=jLoc2; jLoc<localWidth; ++jLoc )
+            if( A.RowOwner(A.GlobalCol(jLoc)) == colRank )
+                sendBuf.insert
+                ( sendBuf.end(),
+                  &U12Buf[(jLoc-jLoc2)*nb], &U12Buf[(jLoc-jLoc2+1)*nb] );
+        std::fill( recvCounts.begin(), recvCounts.end(), 0 );
+        for( Int iLoc=iLoc2; iLoc<localHeight; ++iLoc )
+            recvCounts[A.ColOwner(A.GlobalRow(iLoc))] += nb;
+        const Int totalRecv = Scan( recvCounts, recvOffs );
+        recvBuf.resize( totalRecv );
+        mpi::AllGather
+        ( sendBuf.data(), Int(sendBuf.size()),
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), A.RowComm() );
+        U12_STAR_MC.Resize( nb, localHeight2, nb );
+        F* U12MCBuf = U12_STAR_MC.Buffer();
+        for( Int iLoc=iLoc2; iLoc<localHeight; ++iLoc )
+        {
+            const int owner = A.ColOwner( A.GlobalRow(iLoc) );
+            MemCopy
+            ( &U12MCBuf[(iLoc-iLoc2)*nb], &recvBuf[recvOffs[owner]], nb );
+            recvOffs[owner] += nb;
+        }
+
+        // A22[MC,MR] -= U12[* ,MC]^H U12[* ,MR] (upper triangle only), one
+        // local block column at a time
+        for( Int jLoc=jLoc2; jLoc<localWidth; )
+        {
+            const Int j = A.GlobalCol( jLoc );
+            const Int width = Min( BlockRemainder(j,bsize,cut), n-j );
+            const Int iLocDiag = A.LocalRowOffset( j );
+            const Int iLocBelow = A.LocalRowOffset( j+width );
+            auto U1 = U12_STAR_MR( ALL, IR(jLoc-jLoc2,jLoc-jLoc2+width) );
+            auto UAbove = U12_STAR_MC( ALL, IR(0,iLocDiag-iLoc2) );
+            auto A0Loc = ALoc( IR(iLoc2,iLocDiag), IR(jLoc,jLoc+width) );
+            Gemm( ADJOINT, NORMAL, F(-1), UAbove, U1, F(1), A0Loc );
+            if( iLocBelow > iLocDiag )
+            {
+                // This process owns the diagonal block of the block column
+                auto UDiag =
+                  U12_STAR_MC( ALL, IR(iLocDiag-iLoc2,iLocBelow-iLoc2) );
+                Gemm( ADJOINT, NORMAL, F(1), UDiag, U1, E );
+                const F* EBuf = E.LockedBuffer();
+                const Int ELDim = E.LDim();
+                for( Int s=0; s<width; ++s )
+                    for( Int t=0; t<=s; ++t )
+                        ABuf[(iLocDiag+t)+(jLoc+s)*ALDim] -= EBuf[t+s*ELDim];
+            }
+            jLoc += width;
+        }
+        k += nb;
+    }
+}
+
+// Factor A directly in its block-cyclic distribution (after, if necessary,
+// redistributing it so that its diagonal blocks are square)
+template<typename F>
+inline void
+Block( UpperOrLower uplo, BlockMatrix<F>& APre )
+{
+    DEBUG_ONLY(CSE cse("cholesky::Block"))
+    ProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    ctrl.blockHeight = APre.BlockHeight();
+    ctrl.blockWidth = APre.BlockHeight();
+    if( APre.ColDist() == MC && APre.RowDist() == MR )
+    {
+        ctrl.colAlign = APre.ColAlign();
+        ctrl.rowAlign = APre.RowAlign();
+    }
+    ctrl.colCut = APre.ColCut();
+    ctrl.rowCut = APre.ColCut();
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre, ctrl );
+    auto& A = AProx.Get();
+
+    if( !A.Participating() )
+        return;
+    if( uplo == LOWER )
+        LowerBlock( A );
+    else
+        UpperBlock( A );
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_BLOCK_HPP
@@ -84,7 +84,7 @@ LVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -112,7 +112,7 @@ ReverseLVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky" );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -152,7 +152,7 @@ LVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -210,7 +210,7 @@ ReverseLVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A10_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky", APre.Grid() );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
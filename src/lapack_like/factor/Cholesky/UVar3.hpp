@@ -89,7 +89,7 @@ UVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky" );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -117,7 +117,7 @@ ReverseUVar3( Matrix<F>& A )
           LogicError("Can only compute Cholesky factor of square matrices");
     )
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky" );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
@@ -156,7 +156,7 @@ UVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky", APre.Grid() );
     for( Int k=0; k<n; k+=bsize )
     {
         const Int nb = Min(bsize,n-k);
@@ -208,7 +208,7 @@ ReverseUVar3( AbstractDistMatrix<F>& APre )
     DistMatrix<F,STAR,MR  > A01Adj_STAR_MR(g);
 
     const Int n = A.Height();
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "Cholesky", APre.Grid() );
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
     {
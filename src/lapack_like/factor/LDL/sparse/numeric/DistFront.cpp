@@ -305,19 +305,16 @@ void DistFront<F>::Pull
       if( A.LocalHeight() != reordering.NumLocalSources() )
           LogicError("Local mapping was not the right size");
     )
-    const bool time = false;
+    ProfileRegion region("DistFront::Pull");
    
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm ); 
-    Timer timer;
 
     A.MappedSources( reordering, mappedSources );
     A.MappedTargets( reordering, mappedTargets, colOffs );
 
     // Set up the indices for the rows we need from each process
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Row index setup");
     vector<int> rRowSizes( commSize, 0 );
     function<void(const Separator&)> rRowLocalAccumulate = 
       [&]( const Separator& sep )
@@ -348,11 +345,9 @@ void DistFront<F>::Pull
     rRowAccumulate( rootSep, rootInfo );
     vector<int> rRowOffs;
     const Int numRecvRows = Scan( rRowSizes, rRowOffs );
-    if( time && commRank == 0 )
-        Output("Row index setup: ",timer.Stop()," secs");
+    PopProfileRegion();
 
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Row index pack");
     vector<Int> rRows( numRecvRows );
     auto offs = rRowOffs;
     function<void(const Separator&)> rRowsLocalPack = 
@@ -384,12 +379,10 @@ void DistFront<F>::Pull
           }
       };
     rRowsPack( rootSep, rootInfo );
-    if( time && commRank == 0 )
-        Output("Row index pack: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Retreive the list of rows that we must send to each process
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Row exchange");
     vector<int> sRowSizes( commSize );
     mpi::AllToAll( rRowSizes.data(), 1, sRowSizes.data(), 1, comm );
     vector<int> sRowOffs;
@@ -398,12 +391,10 @@ void DistFront<F>::Pull
     mpi::AllToAll
     ( rRows.data(), rRowSizes.data(), rRowOffs.data(),
       sRows.data(), sRowSizes.data(), sRowOffs.data(), comm );
-    if( time && commRank == 0 )
-        Output("AllToAll: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Pack the number of nonzeros per row (and the nonzeros themselves)
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Payload pack");
     const Int firstLocalRow = A.FirstLocalRow();
     vector<Int> sRowLengths( numSendRows );
     vector<int> sEntriesSizes(commSize,0);
@@ -463,12 +454,10 @@ void DistFront<F>::Pull
               LogicError("index was not the correct value");
         )
     }
-    if( time && commRank == 0 )
-        Output("Payload pack: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Send back the number of nonzeros per row and the nonzeros themselves
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Payload exchange");
     vector<Int> rRowLengths( numRecvRows );
     mpi::AllToAll
     ( sRowLengths.data(), sRowSizes.data(), sRowOffs.data(),
@@ -491,20 +480,17 @@ void DistFront<F>::Pull
     mpi::AllToAll
     ( sTargets.data(), sEntriesSizes.data(), sEntriesOffs.data(),
       rTargets.data(), rEntriesSizes.data(), rEntriesOffs.data(), comm );
-    if( time && commRank == 0 )
-        Output("AllToAll time: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Unpack the received entries
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Unpack");
     // TODO: Modify constructor of [Dist]Front to default to SYMM_2D?
     type = SYMM_2D;
     isHermitian = conjugate;
     UnpackEntries
     ( rootSep, rootInfo, *this, 
       A, rRowLengths, rEntries, rTargets, rRowOffs, rEntriesOffs );
-    if( time && commRank == 0 )
-        Output("Unpack: ",timer.Stop()," secs");
+    PopProfileRegion();
 }
 
 template<typename F>
@@ -536,19 +522,16 @@ void DistFront<F>::PullUpdate
       if( A.LocalHeight() != reordering.NumLocalSources() )
           LogicError("Local mapping was not the right size");
     )
-    const bool time = false;
+    ProfileRegion region("DistFront::PullUpdate");
    
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
-    const int commRank = mpi::Rank( comm ); 
-    Timer timer;
 
     A.MappedSources( reordering, mappedSources );
     A.MappedTargets( reordering, mappedTargets, colOffs );
 
     // Set up the indices for the rows we need from each process
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Row index setup");
     vector<int> rRowSizes( commSize, 0 );
     function<void(const Separator&)> rRowLocalAccumulate = 
       [&]( const Separator& sep )
@@ -579,11 +562,9 @@ void DistFront<F>::PullUpdate
     rRowAccumulate( rootSep, rootInfo );
     vector<int> rRowOffs;
     const Int numRecvRows = Scan( rRowSizes, rRowOffs );
-    if( time && commRank == 0 )
-        Output("Row index setup: ",timer.Stop()," secs");
+    PopProfileRegion();
 
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Row index pack");
     vector<Int> rRows( numRecvRows );
     auto offs = rRowOffs;
     function<void(const Separator&)> rRowsLocalPack = 
@@ -615,12 +596,10 @@ void DistFront<F>::PullUpdate
           }
       };
     rRowsPack( rootSep, rootInfo );
-    if( time && commRank == 0 )
-        Output("Row index pack: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Retreive the list of rows that we must send to each process
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Row exchange");
     vector<int> sRowSizes( commSize );
     mpi::AllToAll( rRowSizes.data(), 1, sRowSizes.data(), 1, comm );
     vector<int> sRowOffs;
@@ -629,12 +608,10 @@ void DistFront<F>::PullUpdate
     mpi::AllToAll
     ( rRows.data(), rRowSizes.data(), rRowOffs.data(),
       sRows.data(), sRowSizes.data(), sRowOffs.data(), comm );
-    if( time && commRank == 0 )
-        Output("AllToAll: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Pack the number of nonzeros per row (and the nonzeros themselves)
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Payload pack");
     const Int firstLocalRow = A.FirstLocalRow();
     vector<Int> sRowLengths( numSendRows );
     vector<int> sEntriesSizes(commSize,0);
@@ -694,12 +671,10 @@ void DistFront<F>::PullUpdate
               LogicError("index was not the correct value");
         )
     }
-    if( time && commRank == 0 )
-        Output("Payload pack: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Send back the number of nonzeros per row and the nonzeros themselves
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Payload exchange");
     vector<Int> rRowLengths( numRecvRows );
     mpi::AllToAll
     ( sRowLengths.data(), sRowSizes.data(), sRowOffs.data(),
@@ -722,12 +697,10 @@ void DistFront<F>::PullUpdate
     mpi::AllToAll
     ( sTargets.data(), sEntriesSizes.data(), sEntriesOffs.data(),
       rTargets.data(), rEntriesSizes.data(), rEntriesOffs.data(), comm );
-    if( time && commRank == 0 )
-        Output("AllToAll time: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Unpack the received updates
-    if( time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Unpack");
     offs = rRowOffs;
     auto entryOffs = rEntriesOffs;
     function<void(const Separator&,const NodeInfo&,Front<F>&)> 
@@ -834,8 +807,7 @@ void DistFront<F>::PullUpdate
         }
       };
     unpackEntries( rootSep, rootInfo, *this );
-    if( time && commRank == 0 )
-        Output("Unpack: ",timer.Stop()," secs");
+    PopProfileRegion();
     DEBUG_ONLY(
       for( Int q=0; q<commSize; ++q )
           if( entryOffs[q] != rEntriesOffs[q]+rEntriesSizes[q] )
@@ -11,6 +11,7 @@
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
 #include "./LU/Full.hpp"
+#include "./LU/Block.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
 
@@ -25,7 +26,7 @@ void LU( Matrix<F>& A )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "LU" );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -60,7 +61,7 @@ void LU( ElementalMatrix<F>& APre )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "LU", APre.Grid() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -99,6 +100,13 @@ template<typename F>
 void LU( DistMatrix<F,STAR,STAR>& A )
 { LU( A.Matrix() ); }
 
+template<typename F>
+void LU( BlockMatrix<F>& A )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    lu::Block( A, nullptr );
+}
+
 // Performs LU factorization with partial pivoting
 
 template<typename F> 
@@ -109,7 +117,7 @@ void LU( Matrix<F>& A, Permutation& P )
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "LU" );
 
     P.MakeIdentity( m );
     P.ReserveSwaps( minDim );
@@ -176,7 +184,7 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     DistPermutation PB(g);
 
     vector<F> panelBuf, pivotBuf;
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "LU", APre.Grid() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -220,6 +228,13 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+template<typename F>
+void LU( BlockMatrix<F>& A, DistPermutation& P )
+{
+    DEBUG_ONLY(CSE cse("LU"))
+    lu::Block( A, &P );
+}
+
 template<typename F> 
 void LU
 ( ElementalMatrix<F>& A, 
@@ -234,6 +249,7 @@ void LU
   template void LU( Matrix<F>& A ); \
   template void LU( ElementalMatrix<F>& A ); \
   template void LU( DistMatrix<F,STAR,STAR>& A ); \
+  template void LU( BlockMatrix<F>& A ); \
   template void LU \
   ( Matrix<F>& A, \
     Permutation& P ); \
@@ -241,6 +257,9 @@ void LU
   ( ElementalMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( BlockMatrix<F>& A, \
+    DistPermutation& P ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -0,0 +1,280 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_BLOCK_HPP
+#define EL_LU_BLOCK_HPP
+
+namespace El {
+namespace lu {
+
+// Swap rows origin and dest of the local columns [jBeg,jEnd) and [jBeg2,jEnd2)
+// of a block-cyclic matrix, exchanging them between process rows if necessary
+template<typename F>
+inline void
+BlockRowSwap
+( BlockMatrix<F>& A, Int origin, Int dest,
+  Int jBeg, Int jEnd, Int jBeg2, Int jEnd2, vector<F>& buf )
+{
+    const int colRank = A.ColRank();
+    const int originOwner = A.RowOwner( origin );
+    const int destOwner = A.RowOwner( dest );
+    if( colRank != originOwner && colRank != destOwner )
+        return;
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    const Int width = (jEnd-jBeg) + (jEnd2-jBeg2);
+    if( originOwner == destOwner )
+    {
+        const Int iLoc = A.LocalRowOffset( origin );
+        const Int iLocDest = A.LocalRowOffset( dest );
+        for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+            std::swap( ABuf[iLoc+jLoc*ALDim], ABuf[iLocDest+jLoc*ALDim] );
+        for( Int jLoc=jBeg2; jLoc<jEnd2; ++jLoc )
+            std::swap( ABuf[iLoc+jLoc*ALDim], ABuf[iLocDest+jLoc*ALDim] );
+        return;
+    }
+    const Int iLoc =
+      A.LocalRowOffset( colRank==originOwner ? origin : dest );
+    const int partner = ( colRank==originOwner ? destOwner : originOwner );
+    buf.resize( width );
+    Int off = 0;
+    for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+        buf[off++] = ABuf[iLoc+jLoc*ALDim];
+    for( Int jLoc=jBeg2; jLoc<jEnd2; ++jLoc )
+        buf[off++] = ABuf[iLoc+jLoc*ALDim];
+    mpi::SendRecv( buf.data(), width, partner, partner, A.ColComm() );
+    off = 0;
+    for( Int jLoc=jBeg; jLoc<jEnd; ++jLoc )
+        ABuf[iLoc+jLoc*ALDim] = buf[off++];
+    for( Int jLoc=jBeg2; jLoc<jEnd2; ++jLoc )
+        ABuf[iLoc+jLoc*ALDim] = buf[off++];
+}
+
+// Right-looking LU factorizations over block-cyclic distributions with square
+// diagonal blocks (as in ScaLAPACK's p?getrf). Each block column is factored
+// by the process column which owns it, with the pivot search and the pivot row
+// reduced over its process column, and the pivots are then broadcast within
+// the process rows so that the rest of the matrix can be swapped. The
+// owning process row solves for its block row of U before the block column of
+// L is broadcast within the process rows, the block row of U within the
+// process columns, and the trailing matrix is updated locally.
+//
+// If P is null, no pivoting is performed.
+template<typename F>
+inline void
+BlockVar( BlockMatrix<F>& A, DistPermutation* P )
+{
+    DEBUG_ONLY(
+      CSE cse("lu::BlockVar");
+      if( A.BlockHeight() != A.BlockWidth() || A.ColCut() != A.RowCut() )
+          LogicError("A must have square diagonal blocks");
+    )
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const Int bsize = A.BlockHeight();
+    const Int cut = A.ColCut();
+    const int colRank = A.ColRank();
+    const int rowRank = A.RowRank();
+    mpi::Comm colComm = A.ColComm();
+    mpi::Comm rowComm = A.RowComm();
+    mpi::Op maxLocOp = mpi::MaxLocOp<Real>();
+    auto& ALoc = A.Matrix();
+    F* ABuf = ALoc.Buffer();
+    const Int ALDim = ALoc.LDim();
+
+    Matrix<F> A11, L21_MC_STAR, U12_STAR_MR;
+    vector<F> rowBuf, swapBuf;
+    vector<Int> pivots;
+    for( Int k=0; k<minDim; )
+    {
+        const Int nb = Min( BlockRemainder(k,bsize,cut), minDim-k );
+        const int ownerRow = A.RowOwner( k );
+        const int ownerCol = A.ColOwner( k );
+        const Int iLoc1 = A.LocalRowOffset( k );
+        const Int jLoc1 = A.LocalColOffset( k );
+        const Int iLoc2 = A.LocalRowOffset( k+nb );
+        const Int jLoc2 = A.LocalColOffset( k+nb );
+        const Int localHeight2 = localHeight - iLoc2;
+        const Int localWidth2 = localWidth - jLoc2;
+
+        // Factor the block column within the process column which owns it.
+        // The last entry of the pivot list flags a zero pivot so that every
+        // process can raise the exception.
+        pivots.resize( nb+1 );
+        pivots[nb] = 0;
+        if( rowRank == ownerCol )
+        {
+            for( Int t=0; t<nb; ++t )
+            {
+                const Int j = k+t;
+                const Int jLoc = jLoc1+t;
+                const Int iLocT = A.LocalRowOffset( j );
+                const Int iLocB = A.LocalRowOffset( j+1 );
+
+                Int iPiv = j;
+                if( P != nullptr )
+                {
+                    ValueInt<Real> localPivot;
+                    localPivot.value = -1;
+                    localPivot.index = -1;
+                    if( iLocT < localHeight )
+                    {
+                        const Int iLocMax = iLocT +
+                          blas::MaxInd
+                          ( localHeight-iLocT, &ABuf[iLocT+jLoc*ALDim], 1 );
+                        localPivot.value = Abs(ABuf[iLocMax+jLoc*ALDim]);
+                        localPivot.index = A.GlobalRow( iLocMax );
+                    }
+                    const auto pivot =
+                      mpi::AllReduce( localPivot, maxLocOp, colComm );
+                    iPiv = pivot.index;
+                }
+                pivots[t] = iPiv;
+
+                // Exchange rows j and iPiv within the panel while forming
+                // a copy of the new pivot row on each process
+                rowBuf.assign( 2*nb, F(0) );
+                if( colRank == A.RowOwner(j) )
+                    for( Int s=0; s<nb; ++s )
+                        rowBuf[s] = ABuf[iLocT+(jLoc1+s)*ALDim];
+                if( colRank == A.RowOwner(iPiv) )
+                {
+                    const Int iLocPiv = A.LocalRowOffset( iPiv );
+                    for( Int s=0; s<nb; ++s )
+                        rowBuf[nb+s] = ABuf[iLocPiv+(jLoc1+s)*ALDim];
+                }
+                mpi::AllReduce( rowBuf.data(), 2*nb, colComm );
+                if( colRank == A.RowOwner(iPiv) )
+                {
+                    const Int iLocPiv = A.LocalRowOffset( iPiv );
+                    for( Int s=0; s<nb; ++s )
+                        ABuf[iLocPiv+(jLoc1+s)*ALDim] = rowBuf[s];
+                }
+                if( colRank == A.RowOwner(j) )
+                    for( Int s=0; s<nb; ++s )
+                        ABuf[iLocT+(jLoc1+s)*ALDim] = rowBuf[nb+s];
+
+                const F alpha = rowBuf[nb+t];
+                if( alpha == F(0) )
+                {
+                    pivots[nb] = 1;
+                    break;
+                }
+                const Int localHeightB = localHeight - iLocB;
+                if( localHeightB > 0 )
+                {
+                    blas::Scal
+                    ( localHeightB, F(1)/alpha, &ABuf[iLocB+jLoc*ALDim], 1 );
+                    blas::Geru
+                    ( localHeightB, nb-t-1, F(-1),
+                      &ABuf[iLocB+jLoc*ALDim], 1,
+                      &rowBuf[nb+t+1], 1,
+                      &ABuf[iLocB+(jLoc+1)*ALDim], ALDim );
+                }
+            }
+        }
+        mpi::Broadcast( pivots.data(), nb+1, ownerCol, rowComm );
+        if( pivots[nb] )
+            throw SingularMatrixException();
+
+        // Apply the swaps to the rest of each row
+        if( P != nullptr )
+        {
+            const Int jSkipBeg = ( rowRank==ownerCol ? jLoc1 : localWidth );
+            const Int jSkipEnd = ( rowRank==ownerCol ? jLoc1+nb : localWidth );
+            for( Int t=0; t<nb; ++t )
+            {
+                P->RowSwap( k+t, pivots[t] );
+                if( pivots[t] != k+t )
+                    BlockRowSwap
+                    ( A, k+t, pivots[t],
+                      0, jSkipBeg, jSkipEnd, localWidth, swapBuf );
+            }
+        }
+
+        // A12 := L11^-1 A12 within the process row which owns them
+        if( colRank == ownerRow )
+        {
+            A11.Resize( nb, nb, nb );
+            if( rowRank == ownerCol )
+                copy::util::InterleaveMatrix
+                ( nb, nb,
+                  A.LockedBuffer(iLoc1,jLoc1), 1, A.LDim(),
+                  A11.Buffer(),                1, nb );
+            mpi::Broadcast( A11.Buffer(), nb*nb, ownerCol, rowComm );
+            auto A12Loc = ALoc( IR(iLoc1,iLoc1+nb), IR(jLoc2,localWidth) );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12Loc );
+        }
+
+        // L21[MC,* ] <- A21[MC,MR]
+        L21_MC_STAR.Resize( localHeight2, nb, Max(localHeight2,Int(1)) );
+        if( rowRank == ownerCol )
+            copy::util::InterleaveMatrix
+            ( localHeight2, nb,
+              A.LockedBuffer(iLoc2,jLoc1), 1, A.LDim(),
+              L21_MC_STAR.Buffer(),        1, L21_MC_STAR.LDim() );
+        mpi::Broadcast
+        ( L21_MC_STAR.Buffer(), localHeight2*nb, ownerCol, rowComm );
+
+        // U12[* ,MR] <- A12[MC,MR]
+        U12_STAR_MR.Resize( nb, localWidth2, nb );
+        if( colRank == ownerRow )
+            copy::util::InterleaveMatrix
+            ( nb, localWidth2,
+              A.LockedBuffer(iLoc1,jLoc2), 1, A.LDim(),
+              U12_STAR_MR.Buffer(),        1, nb );
+        mpi::Broadcast
+        ( U12_STAR_MR.Buffer(), nb*localWidth2, ownerRow, colComm );
+
+        // A22[MC,MR] -= L21[MC,* ] U12[* ,MR]
+        auto A22Loc = ALoc( IR(iLoc2,localHeight), IR(jLoc2,localWidth) );
+        Gemm( NORMAL, NORMAL, F(-1), L21_MC_STAR, U12_STAR_MR, F(1), A22Loc );
+        k += nb;
+    }
+}
+
+// Factor A directly in its block-cyclic distribution (after, if necessary,
+// redistributing it so that its diagonal blocks are square)
+template<typename F>
+inline void
+Block( BlockMatrix<F>& APre, DistPermutation* P )
+{
+    DEBUG_ONLY(CSE cse("lu::Block"))
+    ProxyCtrl ctrl;
+    ctrl.colConstrain = true;
+    ctrl.rowConstrain = true;
+    ctrl.blockHeight = APre.BlockHeight();
+    ctrl.blockWidth = APre.BlockHeight();
+    if( APre.ColDist() == MC && APre.RowDist() == MR )
+    {
+        ctrl.colAlign = APre.ColAlign();
+        ctrl.rowAlign = APre.RowAlign();
+    }
+    ctrl.colCut = APre.ColCut();
+    ctrl.rowCut = APre.ColCut();
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre, ctrl );
+    auto& A = AProx.Get();
+
+    if( P != nullptr )
+    {
+        P->SetGrid( A.Grid() );
+        P->MakeIdentity( A.Height() );
+        P->ReserveSwaps( Min(A.Height(),A.Width()) );
+    }
+    if( A.Participating() )
+        BlockVar( A, P );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_BLOCK_HPP
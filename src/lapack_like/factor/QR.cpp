@@ -12,6 +12,7 @@
 #include "./QR/BusingerGolub.hpp"
 #include "./QR/Cholesky.hpp"
 #include "./QR/Householder.hpp"
+#include "./QR/Block.hpp"
 #include "./QR/SolveAfter.hpp"
 #include "./QR/Explicit.hpp"
 
@@ -41,6 +42,16 @@ void QR
     qr::Householder( A, t, d );
 }
 
+template<typename F> 
+void QR
+( BlockMatrix<F>& A,
+  ElementalMatrix<F>& t, 
+  ElementalMatrix<Base<F>>& d )
+{
+    DEBUG_ONLY(CSE cse("QR"))
+    qr::Block( A, t, d );
+}
+
 template<typename F,typename>
 void QR
 ( DistMatrix<F,MC,MR,BLOCK>& A,
@@ -99,6 +110,10 @@ void QR
     Matrix<F>& t, \
     Matrix<Base<F>>& d ); \
   template void QR \
+  ( BlockMatrix<F>& A, \
+    ElementalMatrix<F>& t, \
+    ElementalMatrix<Base<F>>& d ); \
+  template void QR \
   ( ElementalMatrix<F>& A, \
     ElementalMatrix<F>& t, \
     ElementalMatrix<Base<F>>& d ); \
@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_BLOCK_HPP
+#define EL_QR_BLOCK_HPP
+
+namespace El {
+namespace qr {
+
+// Householder QR over a block-cyclic [MC,MR] distribution using the same
+// conventions as qr::Householder (and so qr::ApplyQ applies the result).
+// Each block column is factored by the process column which owns it, with
+// the reflector norms and the panel updates reduced over that process column.
+// The panel, its scalars, and its signs are then broadcast within the process
+// rows, and the trailing matrix is updated with a UT transform whose inner
+// products are summed within the process columns.
+template<typename F>
+inline void
+BlockVar( BlockMatrix<F>& A, Matrix<F>& t, Matrix<Base<F>>& d )
+{
+    DEBUG_ONLY(CSE cse("qr::BlockVar"))
+    typedef Base<F> Real;
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    const int colRank = A.ColRank();
+    const int rowRank = A.RowRank();
+    mpi::Comm colComm = A.ColComm();
+    mpi::Comm rowComm = A.RowComm();
+    auto& ALoc = A.Matrix();
+    F* ABuf = ALoc.Buffer();
+    const Int ALDim = ALoc.LDim();
+    t.Resize( minDim, 1 );
+    d.Resize( minDim, 1 );
+
+    Matrix<F> V, SInv, Z, z;
+    vector<F> panelBuf;
+    for( Int k=0; k<minDim; )
+    {
+        const Int nb =
+          Min( BlockRemainder(k,A.BlockWidth(),A.RowCut()), minDim-k );
+        const int ownerCol = A.ColOwner( k );
+        const Int iLoc1 = A.LocalRowOffset( k );
+        const Int jLoc1 = A.LocalColOffset( k );
+        const Int jLoc2 = A.LocalColOffset( k+nb );
+        const Int localHeightB = localHeight - iLoc1;
+        const Int localWidth2 = localWidth - jLoc2;
+
+        // The local rows of the panel followed by its scalars and signs
+        const Int panelSize = localHeightB*nb;
+        panelBuf.resize( panelSize+2*nb );
+        F* tBuf = &panelBuf[panelSize];
+        F* dBuf = &panelBuf[panelSize+nb];
+        if( rowRank == ownerCol )
+        {
+            for( Int s=0; s<nb; ++s )
+            {
+                const Int j = k+s;
+                const Int jLoc = jLoc1+s;
+                const int ownerRow = A.RowOwner( j );
+                const Int iLocS = A.LocalRowOffset( j );
+                const Int iLocB = A.LocalRowOffset( j+1 );
+
+                // Find tau and u such that
+                //  / I - tau | 1 | | 1, u^H | \ | alpha11 | = | beta |
+                //  \         | u |            / |     a21 | = |    0 |
+                F alpha = 0;
+                if( colRank == ownerRow )
+                    alpha = ABuf[iLocS+jLoc*ALDim];
+                mpi::Broadcast( alpha, ownerRow, colComm );
+                auto a21 = ALoc( IR(iLocB,localHeight), IR(jLoc,jLoc+1) );
+                const F tau = reflector::Col( alpha, a21, colComm );
+                tBuf[s] = tau;
+                dBuf[s] = ( RealPart(alpha) >= Real(0) ? F(1) : F(-1) );
+
+                // AB2 := (I - tau aB1 aB1^H) AB2, with aB1 = | 1; u |
+                if( colRank == ownerRow )
+                    ABuf[iLocS+jLoc*ALDim] = F(1);
+                auto aB1 = ALoc( IR(iLocS,localHeight), IR(jLoc,jLoc+1) );
+                auto AB2 =
+                  ALoc( IR(iLocS,localHeight), IR(jLoc+1,jLoc1+nb) );
+                Zeros( z, AB2.Width(), 1 );
+                Gemv( ADJOINT, F(1), AB2, aB1, F(0), z );
+                mpi::AllReduce( z.Buffer(), z.Height(), colComm );
+                Ger( -tau, aB1, z, AB2 );
+                if( colRank == ownerRow )
+                    ABuf[iLocS+jLoc*ALDim] = alpha;
+            }
+
+            // Pack the unit lower-trapezoidal reflectors and then rescale R
+            for( Int s=0; s<nb; ++s )
+            {
+                for( Int iLoc=iLoc1; iLoc<localHeight; ++iLoc )
+                {
+                    const Int i = A.GlobalRow( iLoc );
+                    F& entry = panelBuf[(iLoc-iLoc1)+s*localHeightB];
+                    if( i > k+s )
+                        entry = ABuf[iLoc+(jLoc1+s)*ALDim];
+                    else if( i == k+s )
+                        entry = F(1);
+                    else
+                        entry = F(0);
+                }
+            }
+            for( Int s=0; s<nb; ++s )
+            {
+                if( colRank == A.RowOwner(k+s) )
+                {
+                    const Int iLoc = A.LocalRowOffset( k+s );
+                    for( Int r=s; r<nb; ++r )
+                        ABuf[iLoc+(jLoc1+r)*ALDim] *= RealPart(dBuf[s]);
+                }
+            }
+        }
+        mpi::Broadcast( panelBuf.data(), panelSize+2*nb, ownerCol, rowComm );
+        for( Int s=0; s<nb; ++s )
+        {
+            t.Set( k+s, 0, tBuf[s] );
+            d.Set( k+s, 0, RealPart(dBuf[s]) );
+        }
+
+        // SInv := tril(V^H V), with diag(SInv) = 1/t
+        V.Attach
+        ( localHeightB, nb, panelBuf.data(), Max(localHeightB,Int(1)) );
+        Zeros( SInv, nb, nb );
+        Herk( LOWER, ADJOINT, Real(1), V, Real(0), SInv );
+        mpi::AllReduce( SInv.Buffer(), nb*nb, colComm );
+        for( Int s=0; s<nb; ++s )
+            SInv.Set( s, s, F(1)/tBuf[s] );
+
+        // AB2 := (I - V SInv^-1 V^H) AB2, followed by scaling its first rows
+        auto AB2 = ALoc( IR(iLoc1,localHeight), IR(jLoc2,localWidth) );
+        Zeros( Z, nb, localWidth2 );
+        Gemm( ADJOINT, NORMAL, F(1), V, AB2, F(0), Z );
+        mpi::AllReduce( Z.Buffer(), nb*localWidth2, colComm );
+        Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), SInv, Z );
+        Gemm( NORMAL, NORMAL, F(-1), V, Z, F(1), AB2 );
+        for( Int s=0; s<nb; ++s )
+        {
+            if( colRank == A.RowOwner(k+s) )
+            {
+                const Int iLoc = A.LocalRowOffset( k+s );
+                for( Int jLoc=jLoc2; jLoc<localWidth; ++jLoc )
+                    ABuf[iLoc+jLoc*ALDim] *= RealPart(dBuf[s]);
+            }
+        }
+        k += nb;
+    }
+}
+
+template<typename F>
+inline void
+Block
+( BlockMatrix<F>& APre,
+  ElementalMatrix<F>& t,
+  ElementalMatrix<Base<F>>& d )
+{
+    DEBUG_ONLY(
+      CSE cse("qr::Block");
+      AssertSameGrids( APre, t, d );
+    )
+    DistMatrixReadWriteProxy<F,F,MC,MR,BLOCK> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> t_STAR_STAR(g);
+    DistMatrix<Base<F>,STAR,STAR> d_STAR_STAR(g);
+    const Int minDim = Min(A.Height(),A.Width());
+    t_STAR_STAR.Resize( minDim, 1 );
+    d_STAR_STAR.Resize( minDim, 1 );
+    if( A.Participating() )
+        BlockVar( A, t_STAR_STAR.Matrix(), d_STAR_STAR.Matrix() );
+    Copy( t_STAR_STAR, t );
+    Copy( d_STAR_STAR, d );
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_BLOCK_HPP
@@ -29,7 +29,7 @@ Householder
     t.Resize( minDim, 1 );
     d.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "QR" );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -73,7 +73,7 @@ Householder
     t.Resize( minDim, 1 );
     d.Resize( minDim, 1 );
 
-    const Int bsize = Blocksize();
+    const Int bsize = Blocksize<F>( "QR", APre.Grid() );
     for( Int k=0; k<minDim; k+=bsize )
     {
         const Int nb = Min(bsize,minDim-k);
@@ -244,6 +244,7 @@ F RightReflector( F& chi, ElementalMatrix<F>& x )
   template F RightReflector( Matrix<F>& chi, Matrix<F>& x ); \
   template F RightReflector \
   ( ElementalMatrix<F>& chi, ElementalMatrix<F>& x ); \
+  template F reflector::Col( F& chi, Matrix<F>& x, mpi::Comm colComm ); \
   template F reflector::Col( F& chi, ElementalMatrix<F>& x ); \
   template F reflector::Col \
   ( ElementalMatrix<F>& chi, ElementalMatrix<F>& x ); \
@@ -17,22 +17,20 @@
 namespace El {
 namespace reflector {
 
+// x is the local portion of a column vector distributed over colComm
 template<typename F> 
-F Col( F& chi, ElementalMatrix<F>& x )
+F Col( F& chi, Matrix<F>& x, mpi::Comm colComm )
 {
     DEBUG_ONLY(
       CSE cse("reflector::Col");
       if( x.Width() != 1 )
           LogicError("x must be a column vector");
-      if( x.RowRank() != x.RowAlign() )
-          LogicError("Reflecting from incorrect process");
     )
     typedef Base<F> Real;
-    mpi::Comm colComm = x.ColComm();
-    const Int colStride = x.ColStride();
+    const Int colStride = mpi::Size( colComm );
 
     vector<Real> localNorms(colStride);
-    Real localNorm = Nrm2( x.LockedMatrix() ); 
+    Real localNorm = Nrm2( x ); 
     mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
     Real norm = blas::Nrm2( colStride, localNorms.data(), 1 );
 
@@ -65,7 +63,7 @@ F Col( F& chi, ElementalMatrix<F>& x )
             beta *= invOfSafeInv;
         } while( Abs(beta) < safeInv );
 
-        localNorm = Nrm2( x.LockedMatrix() );
+        localNorm = Nrm2( x );
         mpi::AllGather( &localNorm, 1, localNorms.data(), 1, colComm );
         norm = blas::Nrm2( colStride, localNorms.data(), 1 );
         if( RealPart(alpha) <= 0 )
@@ -85,6 +83,17 @@ F Col( F& chi, ElementalMatrix<F>& x )
     return tau;
 }
 
+template<typename F> 
+F Col( F& chi, ElementalMatrix<F>& x )
+{
+    DEBUG_ONLY(
+      CSE cse("reflector::Col");
+      if( x.RowRank() != x.RowAlign() )
+          LogicError("Reflecting from incorrect process");
+    )
+    return Col( chi, x.Matrix(), x.ColComm() );
+}
+
 template<typename F> 
 F Col( ElementalMatrix<F>& chi, ElementalMatrix<F>& x )
 {
@@ -285,7 +285,7 @@ void LinearSolve
     DEBUG_ONLY(CSE cse("LinearSolve"))
     Matrix<F> X;
     LeastSquares( NORMAL, A, B, X, ctrl );
-    B = X;
+    B = std::move(X);
 }
 
 template<typename F>
@@ -297,7 +297,7 @@ void LinearSolve
     DistMultiVec<F> X;
     X.SetComm( B.Comm() );
     LeastSquares( NORMAL, A, B, X, ctrl );
-    B = X;
+    B = std::move(X);
 }
 
 #define PROTO(F) \
@@ -268,26 +268,15 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( F(scale), uplo, A );
 
-    Timer timer;
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            timer.Start();
-    }
+    ScopedProfile profile( ctrl.timeStages, A.DistComm() );
+    ProfileRegion region("HermitianEig");
+    PushProfileRegion("Condense");
    
     // Tridiagonalize A
     herm_tridiag::ExplicitCondensed( uplo, A, ctrl.tridiagCtrl );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            cout << "  Condense time:      " << timer.Stop() << " secs" << endl;
-            timer.Start();
-        }
-    }
+    PopProfileRegion();
+    PushProfileRegion("TridiagEig");
 
     // Solve the symmetric tridiagonal EVP
     const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
@@ -295,12 +284,7 @@ void HermitianEig
     auto e = GetRealPartOfDiagonal(A,subdiagonal);
     HermitianTridiagEig( d, e, w, sort, subset );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            cout << "  TridiagEig time:    " << timer.Stop() << " secs" << endl;
-    }
+    PopProfileRegion();
 
     // Rescale the eigenvalues if necessary
     if( needRescaling ) 
@@ -526,28 +510,17 @@ void HermitianEig
     if( needRescaling )
         ScaleTrapezoid( F(scale), uplo, A );
 
-    Timer timer;
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            timer.Start();
-    }
+    ScopedProfile profile( ctrl.timeStages, A.DistComm() );
+    ProfileRegion region("HermitianEig");
+    PushProfileRegion("Condense");
 
     // Tridiagonalize A
     const Grid& g = A.Grid();
     DistMatrix<F,STAR,STAR> t(g);
     HermitianTridiag( uplo, A, t, ctrl.tridiagCtrl );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            cout << "  Condense time:      " << timer.Stop() << " secs" << endl;
-            timer.Start();
-        }
-    }
+    PopProfileRegion();
+    PushProfileRegion("TridiagEig");
 
     Int kEst;
     const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
@@ -607,15 +580,8 @@ void HermitianEig
         HermitianTridiagEig
         ( d_STAR_STAR, e_STAR_STAR, w, Z_STAR_VR, UNSORTED, subset );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            cout << "  TridiagEig time:    " << timer.Stop() << " secs" << endl;
-            timer.Start();
-        }
-    }
+    PopProfileRegion();
+    PushProfileRegion("Redist");
 
     const Int k = w.Height();
     {
@@ -648,28 +614,14 @@ void HermitianEig
     }
     Z.Resize( n, k ); // We can simply shrink matrices
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            cout << "  Redist time:        " << timer.Stop() << " secs" << endl;
-            timer.Start();
-        }
-    }
+    PopProfileRegion();
+    PushProfileRegion("Backtransform");
 
     // Backtransform the tridiagonal eigenvectors, Z
     herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-        {
-            cout << "  Backtransform time: " << timer.Stop() << " secs" << endl;
-            timer.Start();
-        }
-    }
+    PopProfileRegion();
+    PushProfileRegion("Scale+sort");
 
     // Rescale the eigenvalues if necessary
     if( needRescaling )
@@ -677,12 +629,7 @@ void HermitianEig
 
     herm_eig::Sort( w, Z, sort );
 
-    if( ctrl.timeStages )
-    {
-        mpi::Barrier( A.DistComm() );
-        if( A.Grid().Rank() == 0 )
-            cout << "  Scale+sort time:    " << timer.Stop() << " secs" << endl;
-    }
+    PopProfileRegion();
 }
 
 template<typename F>
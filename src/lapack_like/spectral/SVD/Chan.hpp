@@ -45,18 +45,17 @@ ChanUpper
         return;
     }
 
-    Timer timer;
+    ScopedProfile profile( ctrl.time, g.Comm() );
+    ProfileRegion region("svd::ChanUpper");
     if( avoidU )
     {
         if( m > heightRatio*n )
         {
             DistMatrix<F,MD,STAR> t(g);
             DistMatrix<Real,MD,STAR> d(g);
-            if( ctrl.time && g.Rank() == 0 )
-                timer.Start();
+            PushProfileRegion("Chan QR reduction");
             QR( A, t, d );
-            if( ctrl.time && g.Rank() == 0 )
-                Output("Chan QR reduction: ",timer.Stop()," seconds");
+            PopProfileRegion();
 
             DistMatrix<F> R(g);
             auto AT = A( IR(0,n), IR(0,n) );
@@ -79,11 +78,9 @@ ChanUpper
         {
             DistMatrix<F,MD,STAR> t(g);
             DistMatrix<Real,MD,STAR> d(g);
-            if( ctrl.time && g.Rank() == 0 )
-                timer.Start();
+            PushProfileRegion("Chan QR reduction");
             QR( A, t, d );
-            if( ctrl.time && g.Rank() == 0 )
-                Output("Chan QR reduction: ",timer.Stop()," seconds");
+            PopProfileRegion();
 
             DistMatrix<F> R(g);
             auto AT = A( IR(0,n), IR(0,n) );
@@ -95,11 +92,9 @@ ChanUpper
                 Identity( U, m, m );
                 auto UTL = U( IR(0,n), IR(0,n) );
                 svd::GolubReinsch( R, UTL, s, V, ctrl );
-                if( ctrl.time && g.Rank() == 0 )
-                    timer.Start();
+                PushProfileRegion("Chan backtransformation");
                 qr::ApplyQ( LEFT, NORMAL, A, t, d, U );
-                if( ctrl.time && g.Rank() == 0 )
-                    Output("Chan backtransformation: ",timer.Stop()," seconds");
+                PopProfileRegion();
             }
             else
             {
@@ -109,11 +104,9 @@ ChanUpper
                 const Int rank = UT.Width();
                 U.Resize( m, rank );
                 // (U,s,V) holds an SVD of the R from the QR fact. of original A
-                if( ctrl.time && g.Rank() == 0 )
-                    timer.Start();
+                PushProfileRegion("Chan backtransformation");
                 qr::ApplyQ( LEFT, NORMAL, A, t, d, U );
-                if( ctrl.time && g.Rank() == 0 )
-                    Output("Chan backtransformation: ",timer.Stop()," seconds");
+                PopProfileRegion();
             }
         }
         else
@@ -38,14 +38,14 @@ GolubReinsch
         return;
     }
 
+    ScopedProfile profile( ctrl.time, g.Comm() );
+    ProfileRegion region("svd::GolubReinsch");
+
     // Bidiagonalize A
-    Timer timer;
     DistMatrix<F,STAR,STAR> tP(g), tQ(g);
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("Reduction to bidiagonal");
     Bidiag( A, tP, tQ );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    PopProfileRegion();
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     auto d_MD_STAR = GetRealPartOfDiagonal(A);
@@ -80,19 +80,13 @@ GolubReinsch
     // rotations into our local portion of U and VAdj
     Matrix<F>& ULoc = U_VC_STAR.Matrix();
     Matrix<F>& VAdjLoc = VAdj_STAR_VC.Matrix();
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("BidiagQRAlg");
     lapack::BidiagQRAlg
     ( uplo, k, VAdjLoc.Width(), ULoc.Height(),
       d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer(), 
       VAdjLoc.Buffer(), VAdjLoc.LDim(), 
       ULoc.Buffer(), ULoc.LDim() );
-    if( ctrl.time )
-    {
-        mpi::Barrier( g.Comm() );
-        if( g.Rank() == 0 )
-            Output("BidiagQRAlg: ",timer.Stop()," seconds");
-    }
+    PopProfileRegion();
 
     Int rank = k;
     const bool compact = ( ctrl.approach == COMPACT_SVD );
@@ -151,12 +145,10 @@ GolubReinsch
     }
 
     // Backtransform U and V
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("GolubReinsch backtransformation");
     if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, tQ, U );
     if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, tP, V );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
+    PopProfileRegion();
 }
 
 template<typename F>
@@ -202,14 +194,14 @@ GolubReinschFlame
         return;
     }
 
+    ScopedProfile profile( ctrl.time, g.Comm() );
+    ProfileRegion region("svd::GolubReinschFlame");
+
     // Bidiagonalize A
-    Timer timer;
     DistMatrix<F,STAR,STAR> tP(g), tQ(g);
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("Reduction to bidiagonal");
     Bidiag( A, tP, tQ );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    PopProfileRegion();
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     auto d_MD_STAR = GetRealPartOfDiagonal(A);
@@ -238,8 +230,7 @@ GolubReinschFlame
     // Since libFLAME, to the best of my current knowledge, only supports the
     // upper-bidiagonal case, we may instead work with the adjoint in the 
     // lower-bidiagonal case.
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("BidiagQRAlg");
     if( m >= n )
     {
         flame::BidiagSVD
@@ -256,12 +247,7 @@ GolubReinschFlame
           V_VC_STAR.Buffer(), V_VC_STAR.LDim(),
           U_VC_STAR.Buffer(), U_VC_STAR.LDim() );
     }
-    if( ctrl.time )
-    {
-        mpi::Barrier( g.Comm() );
-        if( g.Rank() == 0 )
-            Output("BidiagQRAlg: ",timer.Stop()," seconds");
-    }
+    PopProfileRegion();
 
     Int rank = k;
     const bool compact = ( ctrl.approach == COMPACT_SVD );
@@ -320,12 +306,10 @@ GolubReinschFlame
     }
 
     // Backtransform U and V
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("GolubReinsch backtransformation");
     if( !avoidU ) bidiag::ApplyQ( LEFT, NORMAL, A, tQ, U );
     if( !avoidV ) bidiag::ApplyP( LEFT, NORMAL, A, tP, V );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("GolubReinsch backtransformation: ",timer.Stop()," seconds");
+    PopProfileRegion();
 }
 
 template<typename F>
@@ -397,14 +381,14 @@ GolubReinsch
     const Int offdiagonal = ( m>=n ? 1 : -1 );
     const Grid& g = A.Grid();
 
+    ScopedProfile profile( ctrl.time, g.Comm() );
+    ProfileRegion region("svd::GolubReinsch");
+
     // Bidiagonalize A
-    Timer timer;
     DistMatrix<F,STAR,STAR> tP(g), tQ(g);
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("Reduction to bidiagonal");
     Bidiag( A, tP, tQ );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("Reduction to bidiagonal: ",timer.Stop()," seconds");
+    PopProfileRegion();
 
     // Grab copies of the diagonal and sub/super-diagonal of A
     auto d_MD_STAR = GetRealPartOfDiagonal(A);
@@ -422,11 +406,9 @@ GolubReinsch
     e_STAR_STAR = e_MD_STAR;
 
     // Compute the singular values of the bidiagonal matrix via DQDS
-    if( ctrl.time && g.Rank() == 0 )
-        timer.Start();
+    PushProfileRegion("DQDS");
     lapack::BidiagDQDS( k, d_STAR_STAR.Buffer(), e_STAR_STAR.Buffer() );
-    if( ctrl.time && g.Rank() == 0 )
-        Output("DQDS: ",timer.Stop()," seconds");
+    PopProfileRegion();
     const bool compact = ( ctrl.approach == COMPACT_SVD );
     if( compact )
     {
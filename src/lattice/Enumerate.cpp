@@ -154,7 +154,8 @@ Base<F> ShortVectorEnumeration
         v.Set( 0, 0, F(1) );
         return b0ProjNorm; 
     }
-    Timer timer;
+    ScopedProfile profile( ctrl.time, mpi::COMM_SELF );
+    ProfileRegion region("ShortVectorEnumeration");
 
     auto d = GetDiagonal( R );
     auto N( R );
@@ -249,11 +250,9 @@ Base<F> ShortVectorEnumeration
                 ctrl.blocksize = 10;
                 ctrl.recursive = false;
                 ctrl.lllCtrl.recursive = false;
-                if( ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Fix-up BKZ");
                 BKZ( BNew, U, RNew, ctrl );
-                if( ctrl.time )
-                    Output("  Fix-up BKZ: ",timer.Stop()," seconds");
+                PopProfileRegion();
             }
             RNew = BNew;
             qr::ExplicitTriang( RNew ); 
@@ -264,12 +263,10 @@ Base<F> ShortVectorEnumeration
 
             if( ctrl.progress )
                 Output("Starting trial ",trial);
-            if( ctrl.time )
-                timer.Start();
+            PushProfileRegion("Probabilistic enumeration");
             Real result =
               svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
-            if( ctrl.time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
+            PopProfileRegion();
             if( result < normUpperBound )
             {
                 if( ctrl.progress )
@@ -317,13 +314,11 @@ Base<F> ShortVectorEnumeration
 
         if( ctrl.progress )
             Output("Starting YSPARSE_ENUM(",n,")");
-        if( ctrl.time )
-            timer.Start();
+        PushProfileRegion("YSPARSE_ENUM");
         Real result = svp::PhaseEnumeration
           ( B, d, N, normUpperBound, startIndex, phaseLength,
             maxInfNorms, maxOneNorms, v, ctrl.progressLevel );
-        if( ctrl.time )
-            Output("YSPARSE_ENUM(",n,"): ",timer.Stop()," seconds");
+        PopProfileRegion();
         return result;
     }
     else
@@ -333,11 +328,9 @@ Base<F> ShortVectorEnumeration
         Fill( upperBounds, normUpperBound );
         if( ctrl.progress )
             Output("Starting FULL_ENUM(",n,")");
-        if( ctrl.time )
-            timer.Start();
+        PushProfileRegion("FULL_ENUM");
         Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
-        if( ctrl.time )
-            Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
+        PopProfileRegion();
         return result;
     }
 }
@@ -494,7 +487,8 @@ MultiShortVectorEnumeration
             modNormUpperBounds.Set(j,0,bProjNorm);
     }
 
-    Timer timer;
+    ScopedProfile profile( ctrl.time, mpi::COMM_SELF );
+    ProfileRegion region("MultiShortVectorEnumeration");
 
     auto d = GetDiagonal( R );
     auto N( R );
@@ -592,11 +586,9 @@ MultiShortVectorEnumeration
                 ctrl.blocksize = 10;
                 ctrl.recursive = false;
                 ctrl.lllCtrl.recursive = false;
-                if( ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Fix-up BKZ");
                 BKZ( BNew, U, RNew, ctrl );
-                if( ctrl.time )
-                    Output("  Fix-up BKZ: ",timer.Stop()," seconds");
+                PopProfileRegion();
             }
             RNew = BNew;
             qr::ExplicitTriang( RNew ); 
@@ -607,12 +599,10 @@ MultiShortVectorEnumeration
 
             if( ctrl.progress )
                 Output("Starting trial ",trial);
-            if( ctrl.time )
-                timer.Start();
+            PushProfileRegion("Probabilistic enumeration");
             Real result =
               svp::GNREnumeration( dNew, NNew, upperBounds, v, ctrl );
-            if( ctrl.time )
-                Output("  Probabalistic enumeration: ",timer.Stop()," seconds");
+            PopProfileRegion();
             if( result < normUpperBound )
             {
                 if( ctrl.progress )
@@ -669,13 +659,11 @@ MultiShortVectorEnumeration
 
         if( ctrl.progress )
             Output("Starting YSPARSE_ENUM(",n,")");
-        if( ctrl.time )
-            timer.Start();
+        PushProfileRegion("YSPARSE_ENUM");
         auto result = svp::PhaseEnumeration
           ( B, d, N, modNormUpperBounds, startIndex, phaseLength,
             maxInfNorms, maxOneNorms, v, ctrl.progressLevel );
-        if( ctrl.time )
-            Output("YSPARSE_ENUM(",n,"): ",timer.Stop()," seconds");
+        PopProfileRegion();
         return result;
     }
     else
@@ -688,11 +676,9 @@ MultiShortVectorEnumeration
         Fill( upperBounds, normUpperBound );
         if( ctrl.progress )
             Output("Starting FULL_ENUM(",n,")");
-        if( ctrl.time )
-            timer.Start();
+        PushProfileRegion("FULL_ENUM");
         Real result = svp::GNREnumeration( d, N, upperBounds, v, ctrl );
-        if( ctrl.time )
-            Output("FULL_ENUM(",n,"): ",timer.Stop()," seconds");
+        PopProfileRegion();
 
         if( result < normUpperBound )
         {
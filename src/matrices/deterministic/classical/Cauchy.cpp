@@ -29,7 +29,7 @@ void Cauchy( Matrix<F1>& A, const vector<F2>& x, const vector<F2>& y )
          ) 
          return F1(1)/F1(x[i]-y[j]);
       };
-    IndexDependentFill( A, function<F1(Int,Int)>(cauchyFill) );
+    IndexDependentFill( A, cauchyFill );
 }
 
 template<typename F1,typename F2>
@@ -53,7 +53,7 @@ void Cauchy
          ) 
          return F1(1)/F1(x[i]-y[j]);
       };
-    IndexDependentFill( A, function<F1(Int,Int)>(cauchyFill) );
+    IndexDependentFill( A, cauchyFill );
 }
 
 #define PROTO_TYPES(F1,F2) \
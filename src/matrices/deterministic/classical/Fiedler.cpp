@@ -17,7 +17,7 @@ void Fiedler( Matrix<F>& A, const vector<F>& c )
     const Int n = c.size();
     A.Resize( n, n );
     auto fiedlerFill = [&]( Int i, Int j ) { return Abs(c[i]-c[j]); };
-    IndexDependentFill( A, function<F(Int,Int)>(fiedlerFill) );
+    IndexDependentFill( A, fiedlerFill );
 }
 
 template<typename F>
@@ -27,7 +27,7 @@ void Fiedler( AbstractDistMatrix<F>& A, const vector<F>& c )
     const Int n = c.size();
     A.Resize( n, n );
     auto fiedlerFill = [&]( Int i, Int j ) { return Abs(c[i]-c[j]); };
-    IndexDependentFill( A, function<F(Int,Int)>(fiedlerFill) );
+    IndexDependentFill( A, fiedlerFill );
 }
 
 #define PROTO(F) \
@@ -21,7 +21,7 @@ void Fourier( Matrix<Complex<Real>>& A, Int n )
       [=]( Int i, Int j ) -> Complex<Real>
       { const Real theta = -2*pi*i*j/n;
         return Complex<Real>(Cos(theta),Sin(theta))/nSqrt; };
-    IndexDependentFill( A, function<Complex<Real>(Int,Int)>(fourierFill) );
+    IndexDependentFill( A, fourierFill );
 }
 
 template<typename Real>
@@ -35,7 +35,7 @@ void Fourier( AbstractDistMatrix<Complex<Real>>& A, Int n )
       [=]( Int i, Int j ) -> Complex<Real>
       { const Real theta = -2*pi*i*j/n;
         return Complex<Real>(Cos(theta),Sin(theta))/nSqrt; };
-    IndexDependentFill( A, function<Complex<Real>(Int,Int)>(fourierFill) );
+    IndexDependentFill( A, fourierFill );
 }
 
 #define PROTO(Real) \
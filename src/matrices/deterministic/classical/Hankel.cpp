@@ -21,7 +21,7 @@ void Hankel( Matrix<T>& A, Int m, Int n, const vector<T>& a )
     // NOTE: gcc (Ubuntu 5.2.1-22ubuntu2) 5.2.1 20151010 segfaults here
     //       if the return type of the lambda is not manually specified.
     auto hankelFill = [&]( Int i, Int j ) -> T { return a[i+j]; };
-    IndexDependentFill( A, function<T(Int,Int)>(hankelFill) );
+    IndexDependentFill( A, hankelFill );
 }
 
 template<typename T>
@@ -33,7 +33,7 @@ void Hankel( AbstractDistMatrix<T>& A, Int m, Int n, const vector<T>& a )
         LogicError("a was the wrong size");
     A.Resize( m, n );
     auto hankelFill = [&]( Int i, Int j ) -> T { return a[i+j]; };
-    IndexDependentFill( A, function<T(Int,Int)>(hankelFill) );
+    IndexDependentFill( A, hankelFill );
 }
 
 #define PROTO(T) \
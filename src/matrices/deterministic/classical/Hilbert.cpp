@@ -16,7 +16,7 @@ void Hilbert( Matrix<F>& A, Int n )
     DEBUG_ONLY(CSE cse("Hilbert"))
     A.Resize( n, n );
     auto hilbertFill = []( Int i, Int j ) { return F(1)/F(i+j+1); };
-    IndexDependentFill( A, function<F(Int,Int)>(hilbertFill) );
+    IndexDependentFill( A, hilbertFill );
 }
 
 template<typename F>
@@ -25,7 +25,7 @@ void Hilbert( AbstractDistMatrix<F>& A, Int n )
     DEBUG_ONLY(CSE cse("Hilbert"))
     A.Resize( n, n );
     auto hilbertFill = []( Int i, Int j ) { return F(1)/F(i+j+1); };
-    IndexDependentFill( A, function<F(Int,Int)>(hilbertFill) );
+    IndexDependentFill( A, hilbertFill );
 }
 
 #define PROTO(F) \
@@ -19,7 +19,7 @@ void Toeplitz( Matrix<S>& A, Int m, Int n, const vector<T>& a )
         LogicError("a was the wrong size");
     A.Resize( m, n );
     auto toeplitzFill = [&]( Int i, Int j ) { return a[i-j+(n-1)]; };
-    IndexDependentFill( A, function<S(Int,Int)>(toeplitzFill) );
+    IndexDependentFill( A, toeplitzFill );
 }
 
 template<typename S,typename T>
@@ -31,7 +31,7 @@ void Toeplitz( AbstractDistMatrix<S>& A, Int m, Int n, const vector<T>& a )
         LogicError("a was the wrong size");
     A.Resize( m, n );
     auto toeplitzFill = [&]( Int i, Int j ) { return a[i-j+(n-1)]; };
-    IndexDependentFill( A, function<S(Int,Int)>(toeplitzFill) );
+    IndexDependentFill( A, toeplitzFill );
 }
 
 #define PROTO_TYPES(T1,T2) \
@@ -60,7 +60,7 @@ void EhrenfestStationary( Matrix<F>& PInf, Int n )
 
     PInf.Resize( n, n );
     auto ehrenfestFill = [&]( Int i, Int j ) { return Exp(logBinom[j]-gamma); };
-    IndexDependentFill( PInf, function<F(Int,Int)>(ehrenfestFill) );
+    IndexDependentFill( PInf, ehrenfestFill );
 }
 
 template<typename F>
@@ -74,7 +74,7 @@ void EhrenfestStationary( AbstractDistMatrix<F>& PInf, Int n )
 
     PInf.Resize( n, n );
     auto ehrenfestFill = [&]( Int i, Int j ) { return Exp(logBinom[j]-gamma); };
-    IndexDependentFill( PInf, function<F(Int,Int)>(ehrenfestFill) );
+    IndexDependentFill( PInf, ehrenfestFill );
 }
 
 template<typename F>
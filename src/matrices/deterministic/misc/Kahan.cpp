@@ -26,7 +26,7 @@ void Kahan( Matrix<F>& A, Int n, F phi )
       { if( i == j )      { return      Pow(zeta,Real(i)); }
         else if(  i < j ) { return -phi*Pow(zeta,Real(i)); }
         else              { return F(0);                   } };
-    IndexDependentFill( A, function<F(Int,Int)>(kahanFill) );
+    IndexDependentFill( A, kahanFill );
 }
 
 template<typename F>
@@ -41,7 +41,7 @@ void Kahan( AbstractDistMatrix<F>& A, Int n, F phi )
       { if( i == j )      { return      Pow(zeta,Real(i)); }
         else if(  i < j ) { return -phi*Pow(zeta,Real(i)); }
         else              { return F(0);                   } };
-    IndexDependentFill( A, function<F(Int,Int)>(kahanFill) );
+    IndexDependentFill( A, kahanFill );
 }
 
 #define PROTO(F) \
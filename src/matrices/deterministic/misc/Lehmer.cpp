@@ -19,7 +19,7 @@ void Lehmer( Matrix<F>& L, Int n )
       []( Int i, Int j ) -> F
       { if( i < j ) { return F(i+1)/F(j+1); }
         else        { return F(j+1)/F(i+1); } };
-    IndexDependentFill( L, function<F(Int,Int)>(lehmerFill) );
+    IndexDependentFill( L, lehmerFill );
 }
 
 template<typename F>
@@ -31,7 +31,7 @@ void Lehmer( AbstractDistMatrix<F>& L, Int n )
       []( Int i, Int j ) -> F
       { if( i < j ) { return F(i+1)/F(j+1); }
         else        { return F(j+1)/F(i+1); } };
-    IndexDependentFill( L, function<F(Int,Int)>(lehmerFill) );
+    IndexDependentFill( L, lehmerFill );
 }
 
 #define PROTO(F) \
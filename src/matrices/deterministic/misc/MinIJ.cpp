@@ -16,7 +16,7 @@ void MinIJ( Matrix<T>& M, Int n )
     DEBUG_ONLY(CSE cse("MinIJ"))
     M.Resize( n, n );
     auto minIJFill = []( Int i, Int j ) { return T(Min(i+1,j+1)); };
-    IndexDependentFill( M, function<T(Int,Int)>(minIJFill) );
+    IndexDependentFill( M, minIJFill );
 }
 
 template<typename T>
@@ -25,7 +25,7 @@ void MinIJ( AbstractDistMatrix<T>& M, Int n )
     DEBUG_ONLY(CSE cse("MinIJ"))
     M.Resize( n, n );
     auto minIJFill = []( Int i, Int j ) { return T(Min(i+1,j+1)); };
-    IndexDependentFill( M, function<T(Int,Int)>(minIJFill) );
+    IndexDependentFill( M, minIJFill );
 }
 
 #define PROTO(T) \
@@ -36,7 +36,7 @@ void Riffle( Matrix<F>& P, Int n )
         else
             return Base<F>(0); 
       };
-    IndexDependentFill( P, function<F(Int,Int)>(riffleFill) );
+    IndexDependentFill( P, riffleFill );
 }
 
 template<typename F>
@@ -59,7 +59,7 @@ void Riffle( AbstractDistMatrix<F>& P, Int n )
         else
             return Base<F>(0); 
       };
-    IndexDependentFill( P, function<F(Int,Int)>(riffleFill) );
+    IndexDependentFill( P, riffleFill );
 }
 
 template<typename F>
@@ -82,7 +82,7 @@ void RiffleStationary( Matrix<F>& PInf, Int n )
     
     PInf.Resize( n, n );
     auto riffleStatFill = [&]( Int i, Int j ) { return sigma[j]; };
-    IndexDependentFill( PInf, function<F(Int,Int)>(riffleStatFill) );
+    IndexDependentFill( PInf, riffleStatFill );
 }
 
 template<typename F>
@@ -105,7 +105,7 @@ void RiffleStationary( AbstractDistMatrix<F>& PInf, Int n )
 
     PInf.Resize( n, n );
     auto riffleStatFill = [&]( Int i, Int j ) { return sigma[j]; };
-    IndexDependentFill( PInf, function<F(Int,Int)>(riffleStatFill) );
+    IndexDependentFill( PInf, riffleStatFill );
 }
 
 template<typename F>
@@ -19,15 +19,30 @@ void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
     EntrywiseFill( A, function<F()>(sampleNormal) );
 }
 
-template<typename F>
-void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+// Each process generates its own entries from the counter-based generator
+template<typename F,typename=EnableIf<IsBlasScalar<F>>>
+void MakeGaussianDist( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    CounterFill
+    ( A, [=]( const PhiloxKey& key, Int i, Int j )
+         { return CounterSampleNormal( key, i, j, mean, stddev ); } );
+}
+
+template<typename F,typename=DisableIf<IsBlasScalar<F>>,typename=void>
+void MakeGaussianDist( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
-    DEBUG_ONLY(CSE cse("MakeGaussian"))
     if( A.RedundantRank() == 0 )
         MakeGaussian( A.Matrix(), mean, stddev );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+template<typename F>
+void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
+{
+    DEBUG_ONLY(CSE cse("MakeGaussian"))
+    MakeGaussianDist( A, mean, stddev );
+}
+
 template<typename F>
 void MakeGaussian( DistMultiVec<F>& A, F mean, Base<F> stddev )
 {
@@ -28,15 +28,30 @@ void Uniform( Matrix<T>& A, Int m, Int n, T center, Base<T> radius )
     MakeUniform( A, center, radius );
 }
 
-template<typename T>
-void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+// Each process generates its own entries from the counter-based generator
+template<typename T,typename=EnableIf<IsBlasScalar<T>>>
+void MakeUniformDist( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    CounterFill
+    ( A, [=]( const PhiloxKey& key, Int i, Int j )
+         { return CounterSampleBall( key, i, j, center, radius ); } );
+}
+
+template<typename T,typename=DisableIf<IsBlasScalar<T>>,typename=void>
+void MakeUniformDist( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
-    DEBUG_ONLY(CSE cse("MakeUniform"))
     if( A.RedundantRank() == 0 )
         MakeUniform( A.Matrix(), center, radius );
     Broadcast( A, A.RedundantComm(), 0 );
 }
 
+template<typename T>
+void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
+{
+    DEBUG_ONLY(CSE cse("MakeUniform"))
+    MakeUniformDist( A, center, radius );
+}
+
 template<typename T>
 void Uniform( AbstractDistMatrix<T>& A, Int m, Int n, T center, Base<T> radius )
 {
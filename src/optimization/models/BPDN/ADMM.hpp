@@ -110,8 +110,7 @@ Int ADMM
 
         // xHat := alpha x + (1-alpha) zOld
         xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
+        Axpby( 1-ctrl.alpha, zOld, ctrl.alpha, xHat );
 
         // z := SoftThresh(xHat+u,lambda/rho)
         z = xHat;
@@ -249,8 +248,7 @@ Int ADMM
 
         // xHat := alpha x + (1-alpha) zOld
         xHat = x;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
+        Axpby( 1-ctrl.alpha, zOld, ctrl.alpha, xHat );
 
         // z := SoftThresh(xHat+u,lambda/rho)
         z = xHat;
@@ -61,8 +61,7 @@ Int SparseInvCov
 
         // XHat := alpha*X + (1-alpha)*ZOld
         XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
+        Axpby( 1-ctrl.alpha, ZOld, ctrl.alpha, XHat );
 
         // Z := SoftThreshold(XHat+U,lambda/rho)
         Z = XHat;
@@ -156,8 +155,7 @@ Int SparseInvCov
 
         // XHat := alpha*X + (1-alpha)*ZOld
         XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
+        Axpby( 1-ctrl.alpha, ZOld, ctrl.alpha, XHat );
 
         // Z := SoftThreshold(XHat+U,lambda/rho)
         Z = XHat;
@@ -15,7 +15,7 @@ void LowerClip( Matrix<Real>& X, Real lowerBound )
 {
     DEBUG_ONLY(CSE cse("LowerClip"))
     auto lowerClip = [&]( Real alpha ) { return Max(lowerBound,alpha); };
-    EntrywiseMap( X, function<Real(Real)>(lowerClip) );
+    EntrywiseMap( X, lowerClip );
 }
 
 template<typename Real>
@@ -23,7 +23,7 @@ void UpperClip( Matrix<Real>& X, Real upperBound )
 {
     DEBUG_ONLY(CSE cse("UpperClip"))
     auto upperClip = [&]( Real alpha ) { return Min(upperBound,alpha); };
-    EntrywiseMap( X, function<Real(Real)>(upperClip) );
+    EntrywiseMap( X, upperClip );
 }
 
 template<typename Real>
@@ -32,7 +32,7 @@ void Clip( Matrix<Real>& X, Real lowerBound, Real upperBound )
     DEBUG_ONLY(CSE cse("Clip"))
     auto clip = [&]( Real alpha ) 
                 { return Max(lowerBound,Min(upperBound,alpha)); };
-    EntrywiseMap( X, function<Real(Real)>(clip) );
+    EntrywiseMap( X, clip );
 }
 
 template<typename Real>
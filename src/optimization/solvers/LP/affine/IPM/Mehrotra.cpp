@@ -161,8 +161,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Gemv( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -201,8 +200,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the KKT system
         // ------------------------
@@ -262,12 +260,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -284,10 +279,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: Using dz as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Construct the new KKT RHS
@@ -508,8 +500,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Gemv( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -548,8 +539,7 @@ void Mehrotra
         // ===================================
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
         // Construct the KKT system
         // ------------------------
         KKT( A, G, s, z, J );
@@ -608,12 +598,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -630,10 +617,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz ); 
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Construct the new KKT RHS
@@ -851,8 +835,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Multiply( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -891,8 +874,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the KKT system
         // ------------------------
@@ -976,12 +958,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -998,10 +977,7 @@ void Mehrotra
         {
             // r_mu := dsAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Construct the new KKT RHS
@@ -1098,7 +1074,8 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer;
+    ScopedProfile profile( ctrl.time, comm );
+    ProfileRegion region("lp::affine::Mehrotra");
 
     // Equilibrate the LP by diagonally scaling [A;G]
     auto A = APre;
@@ -1113,11 +1090,9 @@ void Mehrotra
     DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
+        PushProfileRegion("RuizEquil");
         StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
@@ -1189,25 +1164,21 @@ void Mehrotra
     DistMap map, invMap;
     ldl::DistNodeInfo info;
     ldl::DistSeparator rootSep;
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("ND");
     NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
-    if( commRank == 0 && ctrl.time )
-        Output("ND: ",timer.Stop()," secs");
+    PopProfileRegion();
     InvertMap( map, invMap );
 
     vector<Int> mappedSources, mappedTargets, colOffs;
     JStatic.MappedSources( map, mappedSources );
     JStatic.MappedTargets( map, mappedTargets, colOffs );
 
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("Init");
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s, 
       map, invMap, rootSep, info, mappedSources, mappedTargets, colOffs,
       ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
-    if( commRank == 0 && ctrl.time )
-        Output("Init: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
@@ -1267,8 +1238,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Multiply( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -1308,8 +1278,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the KKT system
         // ------------------------
@@ -1328,28 +1297,23 @@ void Mehrotra
             J.multMeta = JStatic.multMeta;
             UpdateDiagonal( J, Real(1), regTmp );
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Equilibration");
             if( wMaxNorm >= ctrl.ruizEquilTol )
                 SymmetricRuizEquil( J, dInner, ctrl.ruizMaxIter, ctrl.print );
             else if( wMaxNorm >= ctrl.diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
                 Ones( dInner, J.Height(), 1 );
-            if( commRank == 0 && ctrl.time )
-                Output("Equilibration: ",timer.Stop()," secs");
+            PopProfileRegion();
 
             JFront.Pull
             ( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("LDL");
             LDL( info, JFront, LDL_2D );
-            if( commRank == 0 && ctrl.time )
-                Output("LDL: ",timer.Stop()," secs");
+            PopProfileRegion();
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Affine");
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1359,8 +1323,7 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Affine: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -1410,12 +1373,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1432,10 +1392,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Construct the new KKT RHS
@@ -1445,8 +1402,7 @@ void Mehrotra
         // -----------------------
         try
         {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Corrector");
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1456,8 +1412,7 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
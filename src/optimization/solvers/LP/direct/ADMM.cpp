@@ -122,8 +122,7 @@ Int ADMM
 
         // xHat := alpha*x + (1-alpha)*zOld
         xHat = xTmp;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
+        Axpby( 1-ctrl.alpha, zOld, ctrl.alpha, xHat );
 
         // z := pos(xHat+u)
         z = xHat;
@@ -289,8 +288,7 @@ Int ADMM
 
         // xHat := alpha*x + (1-alpha)*zOld
         xHat = xTmp;
-        xHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, zOld, xHat );
+        Axpby( 1-ctrl.alpha, zOld, ctrl.alpha, xHat );
 
         // z := pos(xHat+u)
         z = xHat;
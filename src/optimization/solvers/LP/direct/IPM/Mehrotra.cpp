@@ -205,8 +205,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT )
         {
@@ -323,12 +322,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -344,10 +340,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: We are using dz as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -675,8 +668,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT )
         {
@@ -794,12 +786,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -815,10 +804,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -1179,8 +1165,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z; 
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
         {
@@ -1331,12 +1316,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1353,10 +1335,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -1530,7 +1509,8 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer;
+    ScopedProfile profile( ctrl.time, comm );
+    ProfileRegion region("lp::direct::Mehrotra");
 
     // Equilibrate the LP by diagonally scaling A
     auto A = APre;
@@ -1543,11 +1523,9 @@ void Mehrotra
     DistMultiVec<Real> dRow(comm), dCol(comm);
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
+        PushProfileRegion("RuizEquil");
         RuizEquil( A, dRow, dCol, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         DiagonalSolve( LEFT, NORMAL, dRow, b ); 
         DiagonalSolve( LEFT, NORMAL, dCol, c );
@@ -1610,8 +1588,7 @@ void Mehrotra
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("Init");
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
@@ -1630,8 +1607,7 @@ void Mehrotra
           augMappedSources, augMappedTargets, augColOffs,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
-    if( commRank == 0 && ctrl.time )
-        Output("Init: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     DistMultiVec<Real> regTmp(comm);
     if( ctrl.system == FULL_KKT )
@@ -1755,8 +1731,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z; 
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
         {
@@ -1796,18 +1771,15 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
+                    PushProfileRegion("ND");
                     NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-                    if( commRank == 0 && ctrl.time )
-                        Output("ND: ",timer.Stop()," secs");
+                    PopProfileRegion();
                     InvertMap( map, invMap );
                 }
                 else
                     J.multMeta = meta;
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Equilibration");
                 if( wMaxNorm >= ctrl.ruizEquilTol )
                 {
                     if( ctrl.print && commRank == 0 )
@@ -1823,21 +1795,17 @@ void Mehrotra
                 }
                 else
                     Ones( dInner, J.Height(), 1 );
-                if( commRank == 0 && ctrl.time )
-                    Output("Equilibration: ",timer.Stop()," secs");
+                PopProfileRegion();
 
                 JFront.Pull
                 ( J, map, rootSep, info, 
                   mappedSources, mappedTargets, colOffs );
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("LDL");
                 LDL( info, JFront, LDL_2D );
-                if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                PopProfileRegion();
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Affine");
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1847,8 +1815,7 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -1887,11 +1854,9 @@ void Mehrotra
                     }
 
                     meta = J.InitializeMultMeta();
-                    if( commRank == 0 && ctrl.time )
-                        timer.Start();
+                    PushProfileRegion("ND");
                     NestedDissection( J.LockedDistGraph(), map, rootSep, info );
-                    if( commRank == 0 && ctrl.time )
-                        Output("ND: ",timer.Stop()," secs");
+                    PopProfileRegion();
                     InvertMap( map, invMap );
                 }
                 else
@@ -1900,20 +1865,16 @@ void Mehrotra
                 ( J, map, rootSep, info, 
                   mappedSources, mappedTargets, colOffs );
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("LDL");
                 LDL( info, JFront, LDL_2D );
-                if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                PopProfileRegion();
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start(); 
+                PushProfileRegion("Affine");
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, invMap, info, JFront, dyAff, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -1969,12 +1930,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1990,10 +1948,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -2001,8 +1956,7 @@ void Mehrotra
             KKTRHS( rc, rb, rmu, z, d );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Corrector");
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -2012,8 +1966,7 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -2030,8 +1983,7 @@ void Mehrotra
             AugmentedKKTRHS( x, rc, rb, rmu, d );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Corrector");
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -2041,8 +1993,7 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -2059,14 +2010,12 @@ void Mehrotra
             NormalKKTRHS( A, gamma, x, z, rc, rb, rmu, dy );
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Corrector");
                 reg_ldl::RegularizedSolveAfter
                 ( J, regTmp, invMap, info, JFront, dy, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress, ctrl.solveCtrl.time );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -171,8 +171,7 @@ void Mehrotra
         // ------------------------------------
         rh = h; rh *= -1;
         Gemv( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -211,8 +210,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the full KKT system
         // -----------------------------
@@ -273,12 +271,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -295,10 +290,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Compute the proposed step from the KKT system
@@ -369,7 +361,8 @@ void Mehrotra
 
     const Grid& grid = APre.Grid();
     const int commRank = grid.Rank();
-    Timer timer;
+    ScopedProfile profile( ctrl.time, grid.Comm() );
+    ProfileRegion region("qp::affine::Mehrotra");
 
     // Ensure that the inputs have the appropriate read/write properties
     DistMatrix<Real> Q(grid), A(grid), G(grid), b(grid), c(grid), h(grid);
@@ -413,11 +406,9 @@ void Mehrotra
     DistMatrix<Real,MR,STAR> dCol(grid);
     if( ctrl.outerEquil )
     {
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("RuizEquil");
         StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
-        if( ctrl.time && commRank == 0 )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        PopProfileRegion();
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
         DiagonalSolve( LEFT, NORMAL, dCol,  c );
@@ -463,13 +454,11 @@ void Mehrotra
         }
     }
 
-    if( ctrl.time && commRank == 0 )
-        timer.Start();
+    PushProfileRegion("Init time");
     Initialize
     ( Q, A, G, b, c, h, x, y, z, s, 
       ctrl.primalInit, ctrl.dualInit, standardShift );
-    if( ctrl.time && commRank == 0 )
-        Output("Init time: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     Real relError = 1;
     DistMatrix<Real> J(grid),     d(grid), 
@@ -529,8 +518,7 @@ void Mehrotra
         // ------------------------------------
         rh = h; rh *= -1;
         Gemv( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -570,8 +558,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the KKT system
         // ------------------------
@@ -582,17 +569,12 @@ void Mehrotra
         // -----------------------
         try
         {
-            if( ctrl.time && commRank == 0 )
-                timer.Start();
+            PushProfileRegion("LDL");
             LDL( J, dSub, p, false );
-            if( ctrl.time && commRank == 0 )
-            {
-                Output("LDL: ",timer.Stop()," secs");
-                timer.Start();
-            }
+            PopProfileRegion();
+            PushProfileRegion("Affine solve");
             ldl::SolveAfter( J, dSub, p, d, false );
-            if( ctrl.time && commRank == 0 )
-                Output("Affine solve: ",timer.Stop()," secs"); 
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -642,12 +624,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -664,10 +643,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Form the new KKT RHS
@@ -677,11 +653,9 @@ void Mehrotra
         // ---------------------------
         try 
         { 
-            if( ctrl.time && commRank == 0 )
-                timer.Start();
+            PushProfileRegion("Combined solve");
             ldl::SolveAfter( J, dSub, p, d, false ); 
-            if( ctrl.time && commRank == 0 )
-                Output("Combined solve: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -903,8 +877,7 @@ void Mehrotra
         // ------------------------------------
         rh = h; rh *= -1;
         Multiply( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -943,8 +916,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the KKT system
         // ------------------------
@@ -1029,12 +1001,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1051,10 +1020,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Set up the new KKT RHS
@@ -1154,7 +1120,8 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer, iterTimer;
+    ScopedProfile profile( ctrl.time, comm );
+    ProfileRegion region("qp::affine::Mehrotra");
 
     // Equilibrate the QP by diagonally scaling [A;G]
     auto Q = QPre;
@@ -1170,11 +1137,9 @@ void Mehrotra
     DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
+        PushProfileRegion("RuizEquil");
         StackedRuizEquil( A, G, dRowA, dRowG, dCol, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
@@ -1254,25 +1219,21 @@ void Mehrotra
     DistMap map, invMap;
     ldl::DistNodeInfo info;
     ldl::DistSeparator rootSep;
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("ND");
     NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
-    if( commRank == 0 && ctrl.time )
-        Output("ND: ",timer.Stop()," secs");
+    PopProfileRegion();
     InvertMap( map, invMap );
 
     vector<Int> mappedSources, mappedTargets, colOffs;
     JStatic.MappedSources( map, mappedSources );
     JStatic.MappedTargets( map, mappedTargets, colOffs );
 
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("Init");
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s, 
       map, invMap, rootSep, info, mappedSources, mappedTargets, colOffs, 
       ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
-    if( commRank == 0 && ctrl.time )
-        Output("Init: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
@@ -1289,8 +1250,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
-        if( ctrl.time && commRank == 0 )
-            iterTimer.Start();
+        ProfileRegion iterRegion("Iteration");
 
         // Ensure that s and z are in the cone
         // ===================================
@@ -1338,8 +1298,7 @@ void Mehrotra
         // ------------------------------------
         rh = h; rh *= -1;
         Multiply( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
         // Now check the pieces
         // --------------------
@@ -1379,8 +1338,7 @@ void Mehrotra
 
         // r_mu := s o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, s, rmu );
+        Hadamard( s, z, rmu );
 
         // Construct the KKT system
         // ------------------------
@@ -1399,31 +1357,26 @@ void Mehrotra
             J.multMeta = JStatic.multMeta;
             UpdateDiagonal( J, Real(1), regTmp );
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Equilibration");
             if( wMaxNorm >= ctrl.ruizEquilTol )
                 SymmetricRuizEquil( J, dInner, ctrl.ruizMaxIter, ctrl.print );
             else if( wMaxNorm >= ctrl.diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else 
                 Ones( dInner, n+m+k, 1 );
-            if( commRank == 0 && ctrl.time )
-                Output("Equilibration: ",timer.Stop()," secs");
+            PopProfileRegion();
 
             JFront.Pull
             ( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("LDL");
             if( wMaxNorm >= selInvTol )
                 LDL( info, JFront, LDL_2D );
             else
                 LDL( info, JFront, LDL_SELINV_2D );
-            if( commRank == 0 && ctrl.time )
-                Output("LDL: ",timer.Stop()," secs");
+            PopProfileRegion();
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Affine solve");
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1433,8 +1386,7 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Affine solve: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -1485,12 +1437,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1507,10 +1456,7 @@ void Mehrotra
         {
             // r_mu += dsAff o dzAff
             // ---------------------
-            // NOTE: dz is being used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dsAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dsAff, dzAff, rmu );
         }
 
         // Set up the new RHS
@@ -1520,8 +1466,7 @@ void Mehrotra
         // -------------------------
         try
         {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Corrector solver");
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1531,8 +1476,7 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                   ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector solver: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -1558,8 +1502,6 @@ void Mehrotra
         Axpy( alphaPri,  ds, s );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
-        if( ctrl.time && commRank == 0 )
-            Output("iteration: ",iterTimer.Stop()," secs");
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError <= ctrl.minTol )
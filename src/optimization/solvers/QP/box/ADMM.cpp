@@ -80,8 +80,7 @@ ADMM
 
         // xHat := alpha*x + (1-alpha)*zOld
         XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
+        Axpby( 1-ctrl.alpha, ZOld, ctrl.alpha, XHat );
 
         // z := Clip(xHat+u,lb,ub)
         Z = XHat;
@@ -201,8 +200,7 @@ ADMM
 
         // xHat := alpha*x + (1-alpha)*zOld
         XHat = X;
-        XHat *= ctrl.alpha;
-        Axpy( 1-ctrl.alpha, ZOld, XHat );
+        Axpby( 1-ctrl.alpha, ZOld, ctrl.alpha, XHat );
 
         // z := Clip(xHat+u,lb,ub)
         Z = XHat;
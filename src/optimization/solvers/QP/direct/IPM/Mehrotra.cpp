@@ -184,8 +184,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT )
         {
@@ -278,12 +277,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -299,10 +295,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -569,8 +562,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z;
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT )
         {
@@ -664,12 +656,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -685,10 +674,7 @@ void Mehrotra
         {
             // r_mu := dxAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -975,8 +961,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z; 
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
         {
@@ -1085,12 +1070,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1106,10 +1088,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: dz is being used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -1237,7 +1216,8 @@ void Mehrotra
 
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer;
+    ScopedProfile profile( ctrl.time, comm );
+    ProfileRegion region("qp::direct::Mehrotra");
 
     // Equilibrate the QP by diagonally scaling A
     auto Q = QPre;
@@ -1250,11 +1230,9 @@ void Mehrotra
     DistMultiVec<Real> dRow(comm), dCol(comm);
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
+        PushProfileRegion("RuizEquil");
         RuizEquil( A, dRow, dCol, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("RuizEquil: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         DiagonalSolve( LEFT, NORMAL, dRow, b );
         DiagonalSolve( LEFT, NORMAL, dCol, c );
@@ -1305,8 +1283,7 @@ void Mehrotra
     // only reuse the factorization metadata if the this IPM is using the
     // augmented formulation
     // TODO: Add permanent regularization and cache J metadata
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("Init");
     if( ctrl.system == AUGMENTED_KKT )
     {
         Initialize
@@ -1325,8 +1302,7 @@ void Mehrotra
           augMappedSources, augMappedTargets, augColOffs,
           ctrl.primalInit, ctrl.dualInit, standardShift, ctrl.solveCtrl );
     }
-    if( commRank == 0 && ctrl.time )
-        Output("Init: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     DistMultiVec<Real> regTmp(comm);
     if( ctrl.system == FULL_KKT )
@@ -1443,8 +1419,7 @@ void Mehrotra
 
         // r_mu := x o z
         // -------------
-        rmu = z; 
-        DiagonalScale( LEFT, NORMAL, x, rmu );
+        Hadamard( x, z, rmu );
 
         if( ctrl.system == FULL_KKT || ctrl.system == AUGMENTED_KKT )
         {
@@ -1487,20 +1462,17 @@ void Mehrotra
                     if( ctrl.system == FULL_KKT || 
                         (ctrl.primalInit && ctrl.dualInit) )
                     {
-                        if( commRank == 0 && ctrl.time )
-                            timer.Start();
+                        PushProfileRegion("ND");
                         NestedDissection
                         ( J.LockedDistGraph(), map, rootSep, info );
-                        if( commRank == 0 && ctrl.time )
-                            Output("ND: ",timer.Stop()," secs");
+                        PopProfileRegion();
                         InvertMap( map, invMap );
                     }
                 }
                 else
                     J.multMeta = meta;
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Equilibration");
                 if( wMaxNorm >= ctrl.ruizEquilTol )
                     SymmetricRuizEquil
                     ( J, dInner, ctrl.ruizMaxIter, ctrl.print );
@@ -1508,21 +1480,17 @@ void Mehrotra
                     SymmetricDiagonalEquil( J, dInner, ctrl.print );
                 else
                     Ones( dInner, J.Height(), 1 );
-                if( commRank == 0 && ctrl.time )
-                    Output("Equilibration: ",timer.Stop()," secs");
+                PopProfileRegion();
 
                 JFront.Pull
                 ( J, map, rootSep, info, 
                   mappedSources, mappedTargets, colOffs );
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("LDL");
                 LDL( info, JFront, LDL_2D );
-                if( commRank == 0 && ctrl.time )
-                    Output("LDL: ",timer.Stop()," secs");
+                PopProfileRegion();
 
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Affine");
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1532,8 +1500,7 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Affine: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -1592,12 +1559,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and dx are used as temporaries
-        dx = x;
-        dz = z;
-        Axpy( alphaAffPri,  dxAff, dx );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(dx,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dxAff, x, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1613,10 +1577,7 @@ void Mehrotra
         {
             // r_mu += dxAff o dzAff
             // ---------------------
-            // NOTE: dz is used as a temporary
-            dz = dzAff;
-            DiagonalScale( LEFT, NORMAL, dxAff, dz );
-            rmu += dz;
+            HadamardAxpy( Real(1), dxAff, dzAff, rmu );
         }
 
         if( ctrl.system == FULL_KKT )
@@ -1628,8 +1589,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Corrector");
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1639,8 +1599,7 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
@@ -1661,8 +1620,7 @@ void Mehrotra
             // -----------------------
             try
             {
-                if( commRank == 0 && ctrl.time )
-                    timer.Start();
+                PushProfileRegion("Corrector");
                 if( ctrl.resolveReg )
                     reg_ldl::SolveAfter
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1672,8 +1630,7 @@ void Mehrotra
                     ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                       ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts,
                       ctrl.solveCtrl.progress );
-                if( commRank == 0 && ctrl.time )
-                    Output("Corrector: ",timer.Stop()," secs");
+                PopProfileRegion();
             }
             catch(...)
             {
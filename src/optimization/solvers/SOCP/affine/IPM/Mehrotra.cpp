@@ -161,8 +161,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Gemv( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
 
         // Now check the pieces
@@ -288,12 +287,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -535,8 +531,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Gemv( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
 
         // Now check the pieces
@@ -670,12 +665,9 @@ void Mehrotra
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -958,8 +950,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Multiply( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
 
         // Now check the pieces
@@ -1120,12 +1111,9 @@ void Mehrotra
         if( ctrl.print )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1270,17 +1258,16 @@ void Mehrotra
     const Int degree = soc::Degree( firstInds );
     mpi::Comm comm = APre.Comm();
     const int commRank = mpi::Rank(comm);
-    Timer timer, iterTimer;
+    ScopedProfile profile( ctrl.time, comm );
+    ProfileRegion region("socp::affine::Mehrotra");
 
     DistMultiVec<Real> dRowA(comm), dRowG(comm), dCol(comm);
     if( ctrl.outerEquil )
     {
-        if( commRank == 0 && ctrl.time )
-            timer.Start();
+        PushProfileRegion("cone::RuizEquil");
         cone::RuizEquil
         ( A, G, dRowA, dRowG, dCol, orders, firstInds, cutoffPar, ctrl.print );
-        if( commRank == 0 && ctrl.time )
-            Output("cone::RuizEquil: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         DiagonalSolve( LEFT, NORMAL, dRowA, b );
         DiagonalSolve( LEFT, NORMAL, dRowG, h );
@@ -1325,14 +1312,12 @@ void Mehrotra
         }
     }
 
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("Init");
     Initialize
     ( A, G, b, c, h, orders, firstInds, x, y, z, s,
       ctrl.primalInit, ctrl.dualInit, standardShift, cutoffPar, 
       ctrl.solveCtrl );
-    if( commRank == 0 && ctrl.time )
-        Output("Init: ",timer.Stop()," secs");
+    PopProfileRegion();
 
     // Form the offsets for the sparse embedding of the barrier's Hessian
     // ================================================================== 
@@ -1408,14 +1393,12 @@ void Mehrotra
     }
 
     auto meta = JStatic.InitializeMultMeta();
-    if( commRank == 0 && ctrl.time )
-        timer.Start();
+    PushProfileRegion("ND");
     DistMap map, invMap;
     ldl::DistNodeInfo info;
     ldl::DistSeparator rootSep;
     NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
-    if( commRank == 0 && ctrl.time )
-        Output("ND: ",timer.Stop()," secs");
+    PopProfileRegion();
     InvertMap( map, invMap );
 
     vector<Int> mappedSources, mappedTargets, colOffs;
@@ -1430,8 +1413,7 @@ void Mehrotra
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
-        if( ctrl.time && commRank == 0 )
-            iterTimer.Start();
+        ProfileRegion iterRegion("Iteration");
         // Ensure that s and z are in the cone
         // ===================================
         // TODO: Let this be a function of the relative error, etc.
@@ -1466,8 +1448,7 @@ void Mehrotra
         rh = h;
         rh *= -1;
         Multiply( NORMAL, Real(1), G, x, Real(1), rh );
-        rh += s;
-        const Real rhNrm2 = Nrm2( rh );
+        const Real rhNrm2 = AxpyNrm2( Real(1), s, rh );
         const Real rhConv = rhNrm2 / (1+hNrm2);
 
         // Now check the pieces
@@ -1538,8 +1519,7 @@ void Mehrotra
 
         // Construct the KKT system
         // ------------------------
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("KKT construction");
         JOrig = JStatic;
         JOrig.FreezeSparsity();
         FinishKKT
@@ -1547,16 +1527,13 @@ void Mehrotra
           orders, firstInds, 
           origToSparseOrders, origToSparseFirstInds,
           kSparse, JOrig, onlyLower, cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("KKT construction: ",timer.Stop()," secs");
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PopProfileRegion();
+        PushProfileRegion("KKTRHS construction");
         KKTRHS
         ( rc, rb, rh, rmu, wRoot,
           orders, firstInds, origToSparseFirstInds, kSparse,
           d, cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("KKTRHS construction: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         // Solve for the direction
         // -----------------------
@@ -1568,34 +1545,27 @@ void Mehrotra
             J.FreezeSparsity();
             UpdateDiagonal( J, Real(1), regTmp );
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Equilibration");
             if( wMaxNorm >= ctrl.ruizEquilTol )
                 SymmetricRuizEquil( J, dInner, ctrl.ruizMaxIter, ctrl.print );
             else if( wMaxNorm >= ctrl.diagEquilTol )
                 SymmetricDiagonalEquil( J, dInner, ctrl.print );
             else
                 Ones( dInner, n+m+kSparse, 1 );
-            if( commRank == 0 && ctrl.time )
-                Output("Equilibration: ",timer.Stop()," secs");
+            PopProfileRegion();
 
             // Cache the metadata for the finalized J
             J.multMeta = meta;
-            if( ctrl.time && commRank == 0 )
-                timer.Start();
+            PushProfileRegion("Front pull");
             JFront.Pull
             ( J, map, rootSep, info, mappedSources, mappedTargets, colOffs );
-            if( ctrl.time && commRank == 0 )
-                Output("Front pull: ",timer.Stop()," secs");
+            PopProfileRegion();
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("LDL");
             LDL( info, JFront, LDL_2D );
-            if( commRank == 0 && ctrl.time )
-                Output("LDL: ",timer.Stop()," secs");
+            PopProfileRegion();
 
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Affine");
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta, 
@@ -1605,8 +1575,7 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
                   ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Affine: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -1630,8 +1599,7 @@ void Mehrotra
 
         if( ctrl.checkResiduals && ctrl.print )
         {
-            if( ctrl.time && commRank == 0 )
-                timer.Start();
+            PushProfileRegion("residual check");
             dxError = rb;
             Multiply( NORMAL, Real(1), A, dxAff, Real(1), dxError );
             const Real dxErrorNrm2 = Nrm2( dxError );
@@ -1668,31 +1636,25 @@ void Mehrotra
                  dzErrorNrm2/(1+rhNrm2),"\n",Indent(),
                  "|| dmuError ||_2 / (1 + || r_mu ||_2) = ",
                  dmuErrorNrm2/(1+rmuNrm2));
-            if( ctrl.time && commRank == 0 )
-                Output("residual check: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
 
         // Compute a centrality parameter
         // ==============================
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("Affine line search");
         Real alphaAffPri = 
           soc::MaxStep( s, dsAff, orders, firstInds, Real(1), cutoffPar );
         Real alphaAffDual = 
           soc::MaxStep( z, dzAff, orders, firstInds, Real(1), cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("Affine line search: ",timer.Stop()," secs");
+        PopProfileRegion();
         if( ctrl.forceSameStep )
             alphaAffPri = alphaAffDual = Min(alphaAffPri,alphaAffDual);
         if( ctrl.print && commRank == 0 )
             Output
             ("alphaAffPri = ",alphaAffPri,", alphaAffDual = ",alphaAffDual);
-        // NOTE: dz and ds are used as temporaries
-        ds = s;
-        dz = z;
-        Axpy( alphaAffPri,  dsAff, ds );
-        Axpy( alphaAffDual, dzAff, dz );
-        const Real muAff = Dot(ds,dz) / degree;
+        const Real muAff =
+          AxpyDot
+          ( alphaAffPri, dsAff, s, alphaAffDual, dzAff, z ) / degree;
         if( ctrl.print && commRank == 0 )
             Output("muAff = ",muAff,", mu = ",mu);
         const Real sigma = centralityRule(mu,muAff,alphaAffPri,alphaAffDual);
@@ -1704,8 +1666,7 @@ void Mehrotra
         rc *= 1-sigma;
         rb *= 1-sigma;
         rh *= 1-sigma;
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("r_mu formation");
         if( ctrl.mehrotra )
         {
             // r_mu := l + inv(l) o ((inv(W)^T dsAff) o (W dzAff) - sigma*mu)
@@ -1721,8 +1682,7 @@ void Mehrotra
             // -----------------------
             Axpy( -sigma*mu, lInv, rmu );
         }
-        if( ctrl.time && commRank == 0 )
-            Output("r_mu formation: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         // Compute the proposed step from the KKT system
         // ---------------------------------------------
@@ -1732,8 +1692,7 @@ void Mehrotra
           d, cutoffPar );
         try
         {
-            if( commRank == 0 && ctrl.time )
-                timer.Start();
+            PushProfileRegion("Corrector solver");
             if( ctrl.resolveReg )
                 reg_ldl::SolveAfter
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
@@ -1743,8 +1702,7 @@ void Mehrotra
                 ( JOrig, regTmp, dInner, invMap, info, JFront, d, dmvMeta,
                   ctrl.solveCtrl.relTol, ctrl.solveCtrl.maxRefineIts, 
                   ctrl.solveCtrl.progress );
-            if( commRank == 0 && ctrl.time )
-                Output("Corrector solver: ",timer.Stop()," secs");
+            PopProfileRegion();
         }
         catch(...)
         {
@@ -1755,29 +1713,25 @@ void Mehrotra
                 ("Solve failed with rel. error ",relError,
                  " which does not meet the minimum tolerance of ",ctrl.minTol);
         }
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("ExpandSolution");
         ExpandSolution
         ( m, n, d, rmu, wRoot, 
           orders, firstInds, 
           sparseOrders, sparseFirstInds,
           sparseToOrigOrders, sparseToOrigFirstInds,
           dx, dy, dz, ds, cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("ExpandSolution: ",timer.Stop()," secs");
+        PopProfileRegion();
 
         // Update the current estimates
         // ============================
-        if( ctrl.time && commRank == 0 )
-            timer.Start();
+        PushProfileRegion("Combined line search");
         Real alphaPri = 
           soc::MaxStep
           ( s, ds, orders, firstInds, 1/ctrl.maxStepRatio, cutoffPar );
         Real alphaDual = 
           soc::MaxStep
           ( z, dz, orders, firstInds, 1/ctrl.maxStepRatio, cutoffPar );
-        if( ctrl.time && commRank == 0 )
-            Output("Combined line search: ",timer.Stop()," secs");
+        PopProfileRegion();
         alphaPri = Min(ctrl.maxStepRatio*alphaPri,Real(1));
         alphaDual = Min(ctrl.maxStepRatio*alphaDual,Real(1));
         if( ctrl.forceSameStep )
@@ -1788,8 +1742,6 @@ void Mehrotra
         Axpy( alphaPri,  ds, s );
         Axpy( alphaDual, dy, y );
         Axpy( alphaDual, dz, z );
-        if( ctrl.time && commRank == 0 )
-            Output("Iteration: ",iterTimer.Stop()," secs");
         if( alphaPri == Real(0) && alphaDual == Real(0) )
         {
             if( relError < ctrl.minTol )
@@ -139,7 +139,7 @@ void Apply
     // TODO?: Optimize
     Matrix<Real> z;
     soc::Apply( x, y, z, orders, firstInds );
-    y = z;
+    y = std::move(z);
 }
 
 template<typename Real,typename>
@@ -169,7 +169,7 @@ void Apply
     // TODO?: Optimize
     DistMultiVec<Real> z(x.Comm());
     soc::Apply( x, y, z, orders, firstInds, cutoff );
-    y = z;
+    y = std::move(z);
 }
 
 #define PROTO(Real) \
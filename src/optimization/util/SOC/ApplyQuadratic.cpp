@@ -135,7 +135,7 @@ void ApplyQuadratic
     // TODO?: Optimize
     Matrix<Real> z; 
     soc::ApplyQuadratic( x, y, z, orders, firstInds );
-    y = z;
+    y = std::move(z);
 }
 
 template<typename Real,typename>
@@ -165,7 +165,7 @@ void ApplyQuadratic
     // TODO?: Optimize 
     DistMultiVec<Real> z(x.Comm());
     soc::ApplyQuadratic( x, y, z, orders, firstInds, cutoff );
-    y = z;
+    y = std::move(z);
 }
 
 #define PROTO(Real) \
@@ -0,0 +1,159 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare the block-cyclic result B against the element-cyclic result A
+template<typename F>
+void CheckAgainst
+( const string& label,
+  const ElementalMatrix<F>& A, const AbstractDistMatrix<F>& B )
+{
+    typedef Base<F> Real;
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," had the wrong dimensions");
+    DistMatrix<F> E( B );
+    E -= A;
+    const Real errorNorm = FrobeniusNorm( E );
+    const Real scale = Max( FrobeniusNorm(A), Real(1) );
+    const Real tol =
+      100*limits::Epsilon<Real>()*Max(A.Height(),A.Width())*scale;
+    if( errorNorm > tol )
+        LogicError(label," had error ",errorNorm," > ",tol);
+}
+
+template<typename F>
+void TestGemm( Int m, Int n, Int k, const Grid& g )
+{
+    const vector<Orientation> orients = {NORMAL,TRANSPOSE,ADJOINT};
+    for( auto orientA : orients )
+    {
+        for( auto orientB : orients )
+        {
+            DistMatrix<F> A(g), B(g), C(g);
+            if( orientA == NORMAL )
+                Uniform( A, m, k );
+            else
+                Uniform( A, k, m );
+            if( orientB == NORMAL )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            Uniform( C, m, n );
+
+            // Deliberately mismatched blocksizes and alignments
+            DistMatrix<F,MC,MR,BLOCK> ABlock(g,5,3), BBlock(g,4,7),
+                                      CBlock(g,6,2);
+            CBlock.Align( 6, 2, g.Height()-1, 0, 2, 1 );
+            ABlock = A;
+            BBlock = B;
+            CBlock = C;
+
+            Gemm( orientA, orientB, F(2), A, B, F(-1), C );
+            Gemm( orientA, orientB, F(2), ABlock, BBlock, F(-1), CBlock );
+            CheckAgainst
+            ( "Gemm"+string(1,OrientationToChar(orientA))+
+              string(1,OrientationToChar(orientB)), C, CBlock );
+        }
+    }
+
+    // A product with an input which is not in an [MC,MR] distribution
+    DistMatrix<F> A(g), B(g), C(g);
+    Uniform( A, m, k );
+    Uniform( B, k, n );
+    DistMatrix<F,STAR,VC,BLOCK> ABlock(g,3,4);
+    DistMatrix<F,MC,MR,BLOCK> BBlock(g,4,4), CBlock(g,4,4);
+    ABlock = A;
+    BBlock = B;
+    Gemm( NORMAL, NORMAL, F(1), A, B, C );
+    Gemm( NORMAL, NORMAL, F(1), ABlock, BBlock, CBlock );
+    CheckAgainst( "Gemm [STAR,VC]", C, CBlock );
+}
+
+template<typename F>
+void TestTrsm( Int m, Int n, const Grid& g )
+{
+    const vector<LeftOrRight> sides = {LEFT,RIGHT};
+    const vector<UpperOrLower> uplos = {LOWER,UPPER};
+    const vector<Orientation> orients = {NORMAL,TRANSPOSE,ADJOINT};
+    for( auto side : sides )
+    {
+        for( auto uplo : uplos )
+        {
+            for( auto orientation : orients )
+            {
+                const Int order = ( side==LEFT ? m : n );
+                DistMatrix<F> A(g), B(g);
+                HermitianUniformSpectrum( A, order, 1, 10 );
+                Uniform( B, m, n );
+                DistMatrix<F,MC,MR,BLOCK> ABlock(g,4,4), BBlock(g,4,5);
+                ABlock = A;
+                BBlock = B;
+
+                Trsm( side, uplo, orientation, NON_UNIT, F(3), A, B );
+                Trsm
+                ( side, uplo, orientation, NON_UNIT, F(3), ABlock, BBlock );
+                CheckAgainst
+                ( "Trsm"+string(1,LeftOrRightToChar(side))+
+                  string(1,UpperOrLowerToChar(uplo))+
+                  string(1,OrientationToChar(orientation)), B, BBlock );
+            }
+        }
+    }
+
+    // A zero pivot should be detected by every process (rather than only by
+    // the process row which owns it)
+    DistMatrix<F> A(g);
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    A.Set( m/2, m/2, F(0) );
+    DistMatrix<F,MC,MR,BLOCK> ABlock(g,4,4), BBlock(g,4,5);
+    ABlock = A;
+    Uniform( BBlock, m, n );
+    bool threw = false;
+    try { Trsm( LEFT, LOWER, NORMAL, NON_UNIT, F(1), ABlock, BBlock, true ); }
+    catch( SingularMatrixException& e ) { threw = true; }
+    if( !threw )
+        LogicError("Trsm did not detect a singular matrix");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",40);
+        const Int k = Input("--k","inner dimension",30);
+        const Int nb = Input("--nb","algorithmic blocksize",8);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+
+        TestGemm<double>( m, n, k, g );
+        TestGemm<Complex<double>>( m, n, k, g );
+        TestTrsm<double>( m, n, g );
+        TestTrsm<Complex<double>>( m, n, g );
+
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// The (threaded) overloads of EntrywiseMap, EntrywiseFill, and
+// IndexDependentFill which accept arbitrary callables should exactly
+// reproduce the results of the (sequential) std::function overloads
+
+template<typename T>
+void CheckEqual( const string& msg, const Matrix<T>& A, const Matrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": the dimensions did not match");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                LogicError
+                (msg,": entry (",i,",",j,") was ",B.Get(i,j)," rather than ",
+                 A.Get(i,j));
+}
+
+template<typename T>
+void CheckEqual
+( const string& msg,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(msg,": the dimensions did not match");
+    if( A.ColAlign() != B.ColAlign() || A.RowAlign() != B.RowAlign() )
+        LogicError(msg,": the alignments did not match");
+    Int numWrong = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            if( A.GetLocal(iLoc,jLoc) != B.GetLocal(iLoc,jLoc) )
+                ++numWrong;
+    numWrong = mpi::AllReduce( numWrong, A.Grid().ViewingComm() );
+    if( numWrong != 0 )
+        LogicError(msg,": ",numWrong," entries did not match");
+}
+
+template<typename T,class MatType>
+void TestCallables( const string& label, MatType& A, MatType& B, Int m, Int n )
+{
+    A.Resize( m, n );
+    B.Resize( m, n );
+
+    auto indexFunc =
+      []( Int i, Int j ) { return T(i) - T(2)*T(j) + T(1)/T(i+j+1); };
+    IndexDependentFill( A, function<T(Int,Int)>(indexFunc) );
+    IndexDependentFill( B, indexFunc );
+    CheckEqual( label+" IndexDependentFill", A, B );
+
+    auto mapFunc = []( T alpha ) { return T(3)*alpha*alpha - T(1); };
+    EntrywiseMap( A, function<T(T)>(mapFunc) );
+    EntrywiseMap( B, mapFunc );
+    CheckEqual( label+" EntrywiseMap", A, B );
+
+    // The entries are produced in an unspecified order (and concurrently), so
+    // only a stateless generator can be compared
+    auto fillFunc = []() { return T(7)/T(3); };
+    EntrywiseFill( A, function<T(void)>(fillFunc) );
+    EntrywiseFill( B, fillFunc );
+    CheckEqual( label+" EntrywiseFill", A, B );
+
+    // An out-of-place map
+    IndexDependentFill( A, indexFunc );
+    auto absFunc = []( T alpha ) { return T(Abs(alpha)); };
+    MatType C(A), D(A);
+    EntrywiseMap( A, C, function<T(T)>(absFunc) );
+    EntrywiseMap( A, D, absFunc );
+    CheckEqual( label+" EntrywiseMap (out-of-place)", C, D );
+}
+
+template<typename T>
+void TestCallableFills( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+
+    Matrix<T> A, B;
+    TestCallables<T>( "Matrix", A, B, m, n );
+
+    DistMatrix<T> ADist(g), BDist(g);
+    TestCallables<T>( "[MC,MR]", ADist, BDist, m, n );
+
+    DistMatrix<T,VC,STAR> AVC(g), BVC(g);
+    TestCallables<T>( "[VC,STAR]", AVC, BVC, m, n );
+
+    DistMatrix<T,MC,MR,BLOCK> ABlock(g,3,5), BBlock(g,3,5);
+    ABlock.Align( 3, 5, g.Height()-1, 0, 1, 2 );
+    BBlock.Align( 3, 5, g.Height()-1, 0, 1, 2 );
+    TestCallables<T>( "Block [MC,MR]", ABlock, BBlock, m, n );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",40);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestCallableFills<float>( m, n, g );
+        TestCallableFills<double>( m, n, g );
+        TestCallableFills<Complex<double>>( m, n, g );
+
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
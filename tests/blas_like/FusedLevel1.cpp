@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename F>
+void CheckClose( const string& msg, F value, F expected )
+{
+    typedef Base<F> Real;
+    const Real tol = 100*limits::Epsilon<Real>()*Max(Abs(expected),Real(1));
+    if( Abs(value-expected) > tol )
+        LogicError(msg,": expected ",expected," but found ",value);
+}
+
+template<typename F,class MatType>
+void CheckMatch( const string& msg, const MatType& A, const MatType& B )
+{
+    typedef Base<F> Real;
+    MatType E( B );
+    E -= A;
+    CheckClose<Real>( msg, FrobeniusNorm(E), Real(0) );
+}
+
+template<typename F,class MatType>
+void TestFused( const MatType& X, const MatType& Y, const MatType& Z )
+{
+    typedef Base<F> Real;
+    const F alpha = F(3)/F(4), beta = F(-2);
+
+    // Axpby against Scale followed by Axpy
+    MatType W( Y ), WFused( Y );
+    Scale( beta, W );
+    Axpy( alpha, X, W );
+    Axpby( alpha, X, beta, WFused );
+    CheckMatch<F>( "Axpby", W, WFused );
+
+    // HadamardAxpy against Hadamard followed by Axpy
+    MatType P(X);
+    W = Z;
+    WFused = Z;
+    Hadamard( X, Y, P );
+    Axpy( alpha, P, W );
+    HadamardAxpy( alpha, X, Y, WFused );
+    CheckMatch<F>( "HadamardAxpy", W, WFused );
+
+    // AxpyDot against explicitly forming the updates
+    MatType XNew( X ), YNew( Y );
+    Axpy( alpha, Z, XNew );
+    Axpy( beta, X, YNew );
+    CheckClose<F>( "AxpyDot", AxpyDot(alpha,Z,X,beta,X,Y), Dot(XNew,YNew) );
+
+    // AxpyNrm2 against Axpy followed by FrobeniusNorm
+    W = Y;
+    WFused = Y;
+    Axpy( alpha, X, W );
+    const Real WNorm = FrobeniusNorm( W );
+    CheckClose<Real>( "AxpyNrm2", AxpyNrm2(alpha,X,WFused), WNorm );
+    CheckMatch<F>( "AxpyNrm2 update", W, WFused );
+}
+
+template<typename F>
+void TestFusedLevel1( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<F>());
+
+    Matrix<F> X, Y, Z;
+    Uniform( X, m, n );
+    Uniform( Y, m, n );
+    Uniform( Z, m, n );
+    TestFused<F>( X, Y, Z );
+
+    DistMatrix<F> XDist(g), YDist(g), ZDist(g);
+    Uniform( XDist, m, n );
+    Uniform( YDist, m, n );
+    Uniform( ZDist, m, n );
+    TestFused<F>( XDist, YDist, ZDist );
+
+    DistMultiVec<F> XMV(g.Comm()), YMV(g.Comm()), ZMV(g.Comm());
+    Uniform( XMV, m, n );
+    Uniform( YMV, m, n );
+    Uniform( ZMV, m, n );
+    TestFused<F>( XMV, YMV, ZMV );
+
+    // Misaligned operands must take the unfused fallback paths
+    DistMatrix<F,VC,STAR> XVC( XDist );
+    DistMatrix<F> W( YDist ), WFused( YDist );
+    Axpy( F(2), XDist, W );
+    AxpyNrm2( F(2), XVC, WFused );
+    CheckMatch<F>( "Misaligned AxpyNrm2", W, WFused );
+    if( g.Rank() == 0 )
+        Output("  Passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",100);
+        const Int n = Input("--n","width of matrices",10);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestFusedLevel1<float>( m, n, g );
+        TestFusedLevel1<Complex<float>>( m, n, g );
+        TestFusedLevel1<double>( m, n, g );
+        TestFusedLevel1<Complex<double>>( m, n, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
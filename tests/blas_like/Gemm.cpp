@@ -130,7 +130,44 @@ void TestGemm
         Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
     if( correctness )
         TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
-    
+
+    // Test the pipelined variant of Gemm that keeps C stationary
+    C = COrig;
+    if( g.Rank() == 0 )
+        Output("Pipelined stationary C Algorithm:");
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C_PIPELINED );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+        Output("  Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+
+    // Test the 2.5D variant of Gemm, which replicates over layers of the grid
+    C = COrig;
+    if( g.Rank() == 0 )
+        Output
+        ("2.5D Algorithm (replication factor ",GemmReplicationFactor(),"):");
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+        Output("  Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestCorrectness( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+
     if( orientA == NORMAL && orientB == NORMAL )
     {
         // Test the variant of Gemm for panel-panel dot products
@@ -172,6 +209,8 @@ main( int argc, char* argv[] )
         const Int n = Input("--n","width of result",100);
         const Int k = Input("--k","inner dimension",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int replication =
+          Input("--replication","2.5D replication factor (0 for default)",0);
         const bool print = Input("--print","print matrices?",false);
         const bool correctness = Input("--correctness","correctness?",true);
         const Int colAlignA = Input("--colAlignA","column align of A",0);
@@ -190,6 +229,7 @@ main( int argc, char* argv[] )
         const Orientation orientA = CharToOrientation( transA );
         const Orientation orientB = CharToOrientation( transB );
         SetBlocksize( nb );
+        SetGemmReplicationFactor( replication );
 
         ComplainIfDebug();
         if( commRank == 0 )
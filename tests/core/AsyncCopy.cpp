@@ -0,0 +1,192 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+void CheckEqual( const string& label, const vector<T>& x, const vector<T>& y )
+{
+    if( x != y )
+        LogicError(label," did not match the blocking result");
+}
+
+template<typename T>
+void TestCollectives( mpi::Comm comm )
+{
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const int n = 3;
+    vector<T> sendBuf(n*commSize);
+    for( int k=0; k<n*commSize; ++k )
+        sendBuf[k] = T(commRank*n*commSize+k);
+
+    // AllGather
+    vector<T> gathered(n*commSize*commSize),
+              gatheredCheck(n*commSize*commSize);
+    mpi::Request<T> request;
+    mpi::IAllGather
+    ( sendBuf.data(), n*commSize, gathered.data(), n*commSize, comm, request );
+    mpi::AllGather
+    ( sendBuf.data(), n*commSize, gatheredCheck.data(), n*commSize, comm );
+    mpi::Wait( request );
+    CheckEqual( "IAllGather", gathered, gatheredCheck );
+
+    // AllToAll
+    vector<T> recvBuf(n*commSize), recvBufCheck(n*commSize);
+    mpi::IAllToAll
+    ( sendBuf.data(), n, recvBuf.data(), n, comm, request );
+    mpi::AllToAll( sendBuf.data(), n, recvBufCheck.data(), n, comm );
+    mpi::Wait( request );
+    CheckEqual( "IAllToAll", recvBuf, recvBufCheck );
+
+    // AllToAll with variable sizes (every process sends q+1 entries to q)
+    vector<int> sendCounts(commSize), recvCounts(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendCounts[q] = q+1;
+        recvCounts[q] = commRank+1;
+    }
+    vector<int> sendOffs, recvOffs;
+    const int totalSend = Scan( sendCounts, sendOffs );
+    const int totalRecv = Scan( recvCounts, recvOffs );
+    vector<T> vSendBuf(totalSend);
+    for( int k=0; k<totalSend; ++k )
+        vSendBuf[k] = T(commRank+k);
+    vector<T> vRecvBuf(totalRecv), vRecvBufCheck(totalRecv);
+    mpi::IAllToAll
+    ( vSendBuf.data(), sendCounts.data(), sendOffs.data(),
+      vRecvBuf.data(), recvCounts.data(), recvOffs.data(), comm, request );
+    mpi::AllToAll
+    ( vSendBuf.data(), sendCounts.data(), sendOffs.data(),
+      vRecvBufCheck.data(), recvCounts.data(), recvOffs.data(), comm );
+    mpi::Wait( request );
+    CheckEqual( "IAllToAll (variable)", vRecvBuf, vRecvBufCheck );
+
+    // AllReduce (both out-of-place and in-place)
+    vector<T> summed(n*commSize), summedCheck(sendBuf);
+    mpi::IAllReduce
+    ( sendBuf.data(), summed.data(), n*commSize, comm, request );
+    mpi::AllReduce( summedCheck.data(), n*commSize, comm );
+    mpi::Wait( request );
+    CheckEqual( "IAllReduce", summed, summedCheck );
+    summed = sendBuf;
+    mpi::IAllReduce( summed.data(), n*commSize, comm, request );
+    mpi::Wait( request );
+    CheckEqual( "IAllReduce (in-place)", summed, summedCheck );
+
+    // ReduceScatter
+    vector<T> scattered(n), scatteredCheck(n);
+    mpi::IReduceScatter
+    ( sendBuf.data(), scattered.data(), n, comm, request );
+    mpi::Wait( request );
+    for( int k=0; k<n; ++k )
+        scatteredCheck[k] = summedCheck[commRank*n+k];
+    CheckEqual( "IReduceScatter", scattered, scatteredCheck );
+}
+
+template<typename T,Dist U,Dist V>
+void TestICopy( const DistMatrix<T>& A, bool overlap )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> B(g), BCheck(g);
+    Int colAlign = SampleUniform<Int>(0,B.ColStride());
+    Int rowAlign = SampleUniform<Int>(0,B.RowStride());
+    mpi::Broadcast( colAlign, 0, g.Comm() );
+    mpi::Broadcast( rowAlign, 0, g.Comm() );
+    B.Align( colAlign, rowAlign );
+    BCheck.Align( colAlign, rowAlign );
+    BCheck = A;
+
+    auto req = ICopy( A, B );
+    if( overlap )
+    {
+        // Perform unrelated work while the data is in flight
+        DistMatrix<T> C(g);
+        Uniform( C, A.Height(), A.Width() );
+        Scale( T(2), C );
+        req.Test();
+    }
+    req.Wait();
+    if( req.Active() )
+        LogicError("Request was still active after waiting");
+
+    BCheck -= B;
+    const Base<T> errorNorm = FrobeniusNorm( BCheck );
+    if( errorNorm != Base<T>(0) )
+        LogicError
+        ("ICopy into [",DistToString(U),",",DistToString(V),"] had error ",
+         errorNorm);
+}
+
+template<typename T>
+void TestAsyncCopy( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+    TestCollectives<T>( g.Comm() );
+
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    for( const bool overlap : { false, true } )
+    {
+        TestICopy<T,CIRC,CIRC>( A, overlap );
+        TestICopy<T,MC,  MR  >( A, overlap );
+        TestICopy<T,MC,  STAR>( A, overlap );
+        TestICopy<T,MR,  MC  >( A, overlap );
+        TestICopy<T,STAR,MR  >( A, overlap );
+        TestICopy<T,STAR,STAR>( A, overlap );
+        TestICopy<T,STAR,VC  >( A, overlap );
+        TestICopy<T,VR,  STAR>( A, overlap );
+    }
+
+    // Move a request into another before waiting upon it
+    DistMatrix<T,VC,STAR> B(g);
+    CopyRequest<T> req;
+    req = ICopy( A, B );
+    CopyRequest<T> movedReq( std::move(req) );
+    if( req.Active() || !movedReq.Active() )
+        LogicError("Moving a CopyRequest did not transfer it");
+    movedReq.Wait();
+    DistMatrix<T,VC,STAR> BCheck( A );
+    BCheck -= B;
+    if( FrobeniusNorm(BCheck) != Base<T>(0) )
+        LogicError("Moved CopyRequest did not produce the correct result");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        TestAsyncCopy<float>( m, n, g );
+        TestAsyncCopy<Complex<float>>( m, n, g );
+        TestAsyncCopy<double>( m, n, g );
+        TestAsyncCopy<Complex<double>>( m, n, g );
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
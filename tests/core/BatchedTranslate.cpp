@@ -0,0 +1,135 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare A and B (which may live on subgrids) over the grid g
+template<typename T>
+void CheckEqual
+( const string& label,
+  const AbstractDistMatrix<T>& A, const AbstractDistMatrix<T>& B,
+  const Grid& g )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," had the wrong dimensions");
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g), B_STAR_STAR(g);
+    A_STAR_STAR = A;
+    B_STAR_STAR = B;
+    B_STAR_STAR.Matrix() -= A_STAR_STAR.Matrix();
+    const Base<T> errorNorm = FrobeniusNorm( B_STAR_STAR.Matrix() );
+    if( errorNorm != Base<T>(0) )
+        LogicError(label," had error ",errorNorm);
+}
+
+// Move a batch of matrices of various distributions from the full grid onto
+// a subgrid and then back
+template<typename T>
+void TestBatch
+( const string& label, Int m, Int n, const Grid& g, const Grid& s )
+{
+    DistMatrix<T> A0(g);
+    DistMatrix<T,STAR,VR> A1(g);
+    DistMatrix<T,VC,STAR> A2(g);
+    DistMatrix<T,STAR,STAR> A3(g);
+    DistMatrix<T,MC,MR,BLOCK> A4(g,5,3);
+    DistMatrix<T,MR,MC> A5(g);
+    Uniform( A0, m, n );
+    Uniform( A1, n, m );
+    Uniform( A2, m/2, 3 );
+    Uniform( A3, 7, n );
+    Uniform( A4, m, n+1 );
+    Uniform( A5, 0, n );
+
+    DistMatrix<T> B0(s);
+    DistMatrix<T,MR,STAR> B1(s);
+    DistMatrix<T,VC,STAR> B2(s);
+    DistMatrix<T,STAR,STAR> B3(s);
+    DistMatrix<T,STAR,VC,BLOCK> B4(s,4,6);
+    DistMatrix<T,MR,MC> B5(s);
+    const vector<const AbstractDistMatrix<T>*> A = {&A0,&A1,&A2,&A3,&A4,&A5};
+    const vector<AbstractDistMatrix<T>*> B = {&B0,&B1,&B2,&B3,&B4,&B5};
+    Copy( A, B );
+
+    DistMatrix<T> C0(g);
+    DistMatrix<T,STAR,VR> C1(g);
+    DistMatrix<T,VC,STAR> C2(g);
+    DistMatrix<T,STAR,STAR> C3(g);
+    DistMatrix<T,MC,MR,BLOCK> C4(g,5,3);
+    DistMatrix<T,MR,MC> C5(g);
+    const vector<const AbstractDistMatrix<T>*>
+      BConst = {&B0,&B1,&B2,&B3,&B4,&B5};
+    const vector<AbstractDistMatrix<T>*> C = {&C0,&C1,&C2,&C3,&C4,&C5};
+    Copy( BConst, C );
+
+    for( Int k=0; k<Int(A.size()); ++k )
+        CheckEqual( label+" matrix "+std::to_string(k), *A[k], *C[k], g );
+
+    // A single (unbatched) copy onto the subgrid
+    DistMatrix<T,STAR,MC> D(s);
+    D = A0;
+    C0 = D;
+    CheckEqual( label+" unbatched", A0, C0, g );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",40);
+        const Int n = Input("--n","width of matrix",30);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order );
+
+        // Two disjoint halves of the processes (when there are at least two)
+        const int firstSize = Max( commSize/2, 1 );
+        const int secondSize = Max( commSize-firstSize, 1 );
+        vector<int> firstRanks(firstSize), secondRanks(secondSize);
+        for( int q=0; q<firstSize; ++q )
+            firstRanks[q] = q;
+        for( int q=0; q<secondSize; ++q )
+            secondRanks[q] = commSize-secondSize+q;
+        mpi::Group group, firstGroup, secondGroup;
+        mpi::CommGroup( comm, group );
+        mpi::Incl( group, firstSize, firstRanks.data(), firstGroup );
+        mpi::Incl( group, secondSize, secondRanks.data(), secondGroup );
+        const Grid first
+        ( comm, firstGroup, Grid::FindFactor(firstSize), order );
+        const Grid second
+        ( comm, secondGroup, Grid::FindFactor(secondSize), ROW_MAJOR );
+
+        TestBatch<double>( "First half", m, n, g, first );
+        TestBatch<double>( "Second half", m, n, g, second );
+        TestBatch<Complex<float>>( "First half", m, n, g, first );
+
+        // Between the two halves directly
+        DistMatrix<double> AFirst(first), ASecond(second);
+        Uniform( AFirst, m, n );
+        ASecond = AFirst;
+        CheckEqual( "Between halves", AFirst, ASecond, g );
+
+        mpi::Free( firstGroup );
+        mpi::Free( secondGroup );
+        mpi::Free( group );
+
+        if( mpi::Rank(comm) == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+void Check( const string& routine, Int blocksize, Int expected )
+{
+    if( blocksize != expected )
+        LogicError
+        ("Expected a blocksize of ",expected," for ",routine," but found ",
+         blocksize);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",100);
+        string filename =
+          Input("--file","tuning file (defaults to a temporary)",string(""));
+        ProcessInput();
+        PrintInputReport();
+        // ctest runs from the source tree, so avoid writing into it
+        const bool temporary = filename.empty();
+        if( temporary )
+        {
+            const char* tmpDir = std::getenv("TMPDIR");
+            filename = string(tmpDir==nullptr ? "/tmp" : tmpDir) +
+              "/El-BlocksizeTuning.txt";
+        }
+
+        const Grid g( comm );
+        const Int defaultBsize = Blocksize();
+        ClearTunedBlocksizes();
+        SetTunedBlocksize( "Cholesky", TypeName<double>(), 1, 1, 48 );
+        SetTunedBlocksize( "Cholesky", TypeName<double>(), 2, 2, 96 );
+        SetTunedBlocksize( "LU", TypeName<Complex<double>>(), 1, 1, 24 );
+
+        // Exact matches, the closest grid size, and unknown routines
+        Check( "Cholesky", Blocksize<double>("Cholesky"), 48 );
+        Check( "Cholesky", Blocksize<double>("Cholesky",2,2), 96 );
+        Check( "Cholesky", Blocksize<double>("Cholesky",4,4), 96 );
+        Check( "Cholesky", Blocksize<float>("Cholesky"), defaultBsize );
+        Check( "LU", Blocksize<Complex<double>>("LU",1,2), 24 );
+        Check( "QR", Blocksize<double>("QR"), defaultBsize );
+
+        // A pushed blocksize takes precedence over the tuned ones
+        PushBlocksizeStack( 40 );
+        Check( "Cholesky", Blocksize<double>("Cholesky"), 40 );
+        PopBlocksizeStack();
+
+        // The table should survive a round trip through a file
+        SaveBlocksizeTuning( filename, comm );
+        mpi::Barrier( comm );
+        ClearTunedBlocksizes();
+        LoadBlocksizeTuning( filename, comm );
+        Check( "Cholesky", Blocksize<double>("Cholesky",2,2), 96 );
+        Check( "LU", Blocksize<Complex<double>>("LU"), 24 );
+        if( temporary && mpi::Rank(comm) == 0 )
+            std::remove( filename.c_str() );
+
+        // Tune the Cholesky factorization over the grid and then use it
+        DistMatrix<double> A(g), AOrig(g);
+        HermitianUniformSpectrum( AOrig, n, 1, 10 );
+        const Int tuned = TuneBlocksize<double>
+          ( "Cholesky", g.Height(), g.Width(), {16,32,64},
+            [&]() { A = AOrig; Cholesky( LOWER, A ); }, comm, 1 );
+        Check( "Cholesky", Blocksize<double>("Cholesky",g), tuned );
+        if( mpi::Rank(comm) == 0 )
+            Output("Tuned Cholesky blocksize: ",tuned);
+        ClearTunedBlocksizes();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+void Check
+( const string& label, GemmAlgorithm alg, GemmAlgorithm expected )
+{
+    if( alg != expected )
+        LogicError
+        ("Expected Gemm algorithm ",int(expected)," for ",label," but found ",
+         int(alg));
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        string filename =
+          Input("--file","cost model file (defaults to a temporary)",
+                string(""));
+        ProcessInput();
+        PrintInputReport();
+        // ctest runs from the source tree, so avoid writing into it
+        const bool temporary = filename.empty();
+        if( temporary )
+        {
+            const char* tmpDir = std::getenv("TMPDIR");
+            filename = string(tmpDir==nullptr ? "/tmp" : tmpDir) +
+              "/El-CostModel.txt";
+        }
+
+        const Grid g( comm );
+
+        // Calibrate the model and then round trip it through a file
+        const CostModel calibrated = CalibrateCostModel( comm );
+        if( calibrated.alpha < 0. || calibrated.beta < 0. ||
+            calibrated.gamma <= 0. )
+            LogicError("Calibration produced an invalid cost model");
+        if( commRank == 0 )
+            Output
+            ("Calibrated cost model: alpha=",calibrated.alpha,
+             ", beta=",calibrated.beta,", gamma=",calibrated.gamma);
+        SaveCostModel( filename, comm );
+        mpi::Barrier( comm );
+        ResetCostModel();
+        LoadCostModel( filename, comm );
+        if( GetCostModel().alpha != calibrated.alpha ||
+            GetCostModel().beta != calibrated.beta ||
+            GetCostModel().gamma != calibrated.gamma )
+            LogicError("The cost model did not survive a round trip");
+        if( temporary && commRank == 0 )
+            std::remove( filename.c_str() );
+
+        // A bandwidth-dominated machine
+        CostModel model;
+        model.alpha = 0;
+        model.beta = 1.e-9;
+        model.gamma = 1.e-12;
+        SetCostModel( model );
+
+        // Without communication, the stationary C algorithm is always used
+        const Grid gSelf( mpi::COMM_SELF );
+        Check
+        ( "a single process",
+          DefaultGemmAlgorithm<double>( NORMAL, NORMAL, 4000, 64, 4000, gSelf ),
+          GEMM_SUMMA_C );
+        Check
+        ( "an outer product",
+          DefaultGemmAlgorithm<double>( NORMAL, NORMAL, 2000, 2000, 128, g ),
+          GEMM_SUMMA_C );
+        if( commSize > 1 && g.Height() == g.Width() )
+        {
+            // On a square grid, a tall-skinny (short-wide) result should keep
+            // the large operand A (B) stationary
+            Check
+            ( "a tall-skinny result",
+              DefaultGemmAlgorithm<double>
+              ( NORMAL, NORMAL, 4000, 64, 4000, g ),
+              GEMM_SUMMA_A );
+            Check
+            ( "a short-wide result",
+              DefaultGemmAlgorithm<double>
+              ( NORMAL, TRANSPOSE, 64, 4000, 4000, g ),
+              GEMM_SUMMA_B );
+        }
+        ResetCostModel();
+
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
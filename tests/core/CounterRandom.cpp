@@ -0,0 +1,76 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// The counter-based generator should produce the same matrix regardless of
+// the grid shape and the distribution
+template<typename F>
+void TestGridIndependence( const Grid& g1, const Grid& g2, Int m, Int n )
+{
+    const bool root = ( mpi::Rank(mpi::COMM_WORLD) == 0 );
+    if( root )
+        Output("Testing with ",TypeName<F>());
+
+    SetCounterSeed( 1234 );
+    DistMatrix<F> A(g1);
+    Gaussian( A, m, n );
+    DistMatrix<F,MC,MR,BLOCK> B(g1);
+    Uniform( B, m, n );
+
+    SetCounterSeed( 1234 );
+    DistMatrix<F,VR,STAR> AAlt(g2);
+    Gaussian( AAlt, m, n );
+    DistMatrix<F,STAR,STAR> BAlt(g2);
+    Uniform( BAlt, m, n );
+
+    DistMatrix<F,STAR,STAR> A_STAR_STAR(A), B_STAR_STAR(B),
+      AAlt_STAR_STAR(AAlt);
+    AAlt_STAR_STAR.Matrix() -= A_STAR_STAR.Matrix();
+    BAlt.Matrix() -= B_STAR_STAR.Matrix();
+    if( MaxNorm(AAlt_STAR_STAR.Matrix()) != Base<F>(0) )
+        LogicError("Gaussian matrices differed between distributions");
+    if( MaxNorm(BAlt.Matrix()) != Base<F>(0) )
+        LogicError("Uniform matrices differed between distributions");
+
+    // A subsequent fill should use a new stream
+    DistMatrix<F> C(g1);
+    Gaussian( C, m, n );
+    DistMatrix<F,STAR,STAR> C_STAR_STAR(C);
+    C_STAR_STAR.Matrix() -= A_STAR_STAR.Matrix();
+    if( MaxNorm(C_STAR_STAR.Matrix()) == Base<F>(0) )
+        LogicError("Successive Gaussian matrices were identical");
+
+    const Base<F> frobA = FrobeniusNorm( A );
+    if( root )
+        Output("  || A ||_F / sqrt(m n) = ",frobA/Sqrt(Base<F>(m*n)));
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrices",200);
+        const Int n = Input("--n","width of matrices",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g1( comm ), g2( comm, 1 );
+        TestGridIndependence<float>( g1, g2, m, n );
+        TestGridIndependence<double>( g1, g2, m, n );
+        TestGridIndependence<Complex<double>>( g1, g2, m, n );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,132 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Every entry of the matrices is determined by its global index so that the
+// results can be checked locally
+template<typename T>
+T EntryValue( Int i, Int j, Int height )
+{ return T(i+j*height); }
+
+template<typename T>
+void CheckEntries( const string& label, const AbstractDistMatrix<T>& A )
+{
+    const Int height = A.Height();
+    Int numWrong = 0;
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            if( A.GetLocal(iLoc,jLoc) != EntryValue<T>(i,j,height) )
+                ++numWrong;
+        }
+    }
+    numWrong = mpi::AllReduce( numWrong, A.Grid().ViewingComm() );
+    if( numWrong != 0 )
+        LogicError(label," had ",numWrong," incorrect entries");
+}
+
+template<typename T,Dist U,Dist V>
+void TestBlock( const DistMatrix<T>& A, Int mb, Int nb )
+{
+    const Grid& g = A.Grid();
+    const string label =
+      BuildString("[",DistToString(U),",",DistToString(V),"]");
+
+    // Elemental to block-cyclic (with cuts) and back again
+    DistMatrix<T,U,V,BLOCK> B(g,mb,nb);
+    B.Align( mb, nb, 0, 0, mb/2, nb/3 );
+    B = A;
+    CheckEntries( "Block "+label, B );
+
+    DistMatrix<T,U,V> C(g);
+    C.Align( C.ColStride()-1, C.RowStride()-1 );
+    C = B;
+    CheckEntries( "Elemental "+label, C );
+
+    // A change of datatype
+    DistMatrix<float,U,V> CSingle(g);
+    Copy( B, CSingle );
+    CheckEntries( "Single-precision "+label, CSingle );
+    DistMatrix<float,STAR,STAR> CSingle_STAR_STAR(g);
+    Copy( C, CSingle_STAR_STAR );
+    CheckEntries
+    ( "Single-precision [STAR,STAR] from "+label, CSingle_STAR_STAR );
+    DistMatrix<float,STAR,VR,BLOCK> BSingle_STAR_VR(g,mb,nb);
+    Copy( B, BSingle_STAR_VR );
+    CheckEntries( "Single-precision [STAR,VR] from "+label, BSingle_STAR_VR );
+
+    // Transmitting in a reduced precision (which is exact for these entries)
+    DistMatrix<T,VC,STAR> CReduced(g);
+    ReducedPrecisionCopy( B, CReduced );
+    CheckEntries( "Reduced-precision "+label, CReduced );
+}
+
+template<typename T>
+void TestGeneralPurposeCopy( Int m, Int n, Int mb, Int nb, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+    DistMatrix<T> A(m,n,g);
+    IndexDependentFill
+    ( A, function<T(Int,Int)>
+         ( [=]( Int i, Int j ) { return EntryValue<T>(i,j,m); } ) );
+
+    TestBlock<T,MC,  MR  >( A, mb, nb );
+    TestBlock<T,MR,  MC  >( A, mb, nb );
+    TestBlock<T,MC,  STAR>( A, mb, nb );
+    TestBlock<T,STAR,MR  >( A, mb, nb );
+    TestBlock<T,VC,  STAR>( A, mb, nb );
+    TestBlock<T,STAR,VR  >( A, mb, nb );
+    TestBlock<T,STAR,STAR>( A, mb, nb );
+    TestBlock<T,CIRC,CIRC>( A, mb, nb );
+
+    // Between grids of different orderings
+    const GridOrder otherOrder =
+      ( g.Order() == COLUMN_MAJOR ? ROW_MAJOR : COLUMN_MAJOR );
+    const Grid gOther( g.Comm(), g.Height(), otherOrder );
+    DistMatrix<T> AOther(gOther);
+    AOther = A;
+    CheckEntries( "Translation between grids", AOther );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int mb = Input("--mb","height of distribution blocks",7);
+        const Int nb = Input("--nb","width of distribution blocks",5);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        TestGeneralPurposeCopy<float>( m, n, mb, nb, g );
+        TestGeneralPurposeCopy<double>( m, n, mb, nb, g );
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Ensure that the local entries of B match the replicated matrix
+template<typename T,Dist U,Dist V>
+void CheckEntries
+( const string& label, const DistMatrix<T,U,V>& B, const Matrix<T>& AFull )
+{
+    Int myErrorFlag = 0;
+    for( Int jLoc=0; jLoc<B.LocalWidth(); ++jLoc )
+    {
+        const Int j = B.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+            if( B.GetLocal(iLoc,jLoc) != AFull.Get(B.GlobalRow(iLoc),j) )
+                myErrorFlag = 1;
+    }
+    const Int errorFlag = mpi::AllReduce( myErrorFlag, B.Grid().Comm() );
+    if( errorFlag != 0 )
+        LogicError(label," did not match the original matrix");
+}
+
+// Redistribute A into a randomly aligned [U,V] matrix and back again
+template<typename T,Dist U,Dist V>
+void RoundTrip( const DistMatrix<T>& A, const Matrix<T>& AFull )
+{
+    const Grid& g = A.Grid();
+    DistMatrix<T,U,V> B(g);
+    Int colAlign = SampleUniform<Int>(0,B.ColStride());
+    Int rowAlign = SampleUniform<Int>(0,B.RowStride());
+    mpi::Broadcast( colAlign, 0, g.Comm() );
+    mpi::Broadcast( rowAlign, 0, g.Comm() );
+    B.Align( colAlign, rowAlign );
+    B = A;
+
+    const string label =
+      BuildString
+      ("[",DistToString(U),",",DistToString(V),"] <- [MC,MR] (",
+       A.Height()," x ",A.Width(),")");
+    CheckEntries( label, B, AFull );
+
+    DistMatrix<T> C(g);
+    colAlign = SampleUniform<Int>(0,C.ColStride());
+    rowAlign = SampleUniform<Int>(0,C.RowStride());
+    mpi::Broadcast( colAlign, 0, g.Comm() );
+    mpi::Broadcast( rowAlign, 0, g.Comm() );
+    C.Align( colAlign, rowAlign );
+    C = B;
+    CheckEntries( label+" and back", C, AFull );
+}
+
+template<typename T>
+void TestRedistributions( Int m, Int n, const Grid& g )
+{
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    const Matrix<T>& AFull = A_STAR_STAR.LockedMatrix();
+
+    RoundTrip<T,CIRC,CIRC>( A, AFull );
+    RoundTrip<T,MC,  STAR>( A, AFull );
+    RoundTrip<T,MD,  STAR>( A, AFull );
+    RoundTrip<T,MR,  MC  >( A, AFull );
+    RoundTrip<T,MR,  STAR>( A, AFull );
+    RoundTrip<T,STAR,MC  >( A, AFull );
+    RoundTrip<T,STAR,MD  >( A, AFull );
+    RoundTrip<T,STAR,MR  >( A, AFull );
+    RoundTrip<T,STAR,STAR>( A, AFull );
+    RoundTrip<T,STAR,VC  >( A, AFull );
+    RoundTrip<T,STAR,VR  >( A, AFull );
+    RoundTrip<T,VC,  STAR>( A, AFull );
+    RoundTrip<T,VR,  STAR>( A, AFull );
+}
+
+template<typename T>
+void TestPacking( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+    for( const Int numThreads : { Int(1), Int(2), Int(4), Int(0) } )
+    {
+        SetPackingThreads( numThreads );
+        if( g.Rank() == 0 )
+            Output("  packing with ",PackingThreads()," threads");
+        TestRedistributions<T>( m, n, g );
+        // Column and row vectors take separate paths (e.g., in TransposeDist)
+        TestRedistributions<T>( m*n, 1, g );
+        TestRedistributions<T>( 1, m*n, g );
+    }
+    SetPackingThreads( 0 );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",300);
+        const Int n = Input("--n","width of matrix",200);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        TestPacking<double>( m, n, g );
+        TestPacking<Complex<double>>( m, n, g );
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
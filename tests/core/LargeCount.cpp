@@ -0,0 +1,128 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// The messages are artificially limited to a handful of entries so that the
+// code paths for more than 2^31 entries can be exercised with small matrices.
+// The large-count collectives (and hence the chunked exchanges beneath the
+// general-purpose copies) only exist with 64-bit Int, so only the chunked
+// exchanges of RedistPlan are tested otherwise.
+
+template<typename T>
+T EntryValue( Int i, Int j, Int height )
+{ return T(i+j*height); }
+
+template<typename T>
+void CheckEntries( const string& label, const AbstractDistMatrix<T>& A )
+{
+    const Int height = A.Height();
+    Int numWrong = 0;
+    if( A.Participating() )
+    {
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                if( A.GetLocal(iLoc,jLoc) != EntryValue<T>(i,j,height) )
+                    ++numWrong;
+            }
+        }
+    }
+    numWrong = mpi::AllReduce( numWrong, A.Grid().ViewingComm() );
+    if( numWrong != 0 )
+        LogicError(label," had ",numWrong," incorrect entries");
+}
+
+template<typename T>
+void TestLargeCount( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+    DistMatrix<T> A(m,n,g);
+    IndexDependentFill
+    ( A, function<T(Int,Int)>
+         ( [=]( Int i, Int j ) { return EntryValue<T>(i,j,m); } ) );
+
+    DistMatrix<T,STAR,VR,BLOCK> ABlock(g,3,4);
+    DistMatrix<T,MR,MC> A_MR_MC(g);
+    RedistPlan<T> blockPlan( A, ABlock );
+    blockPlan.Execute( A, ABlock );
+    CheckEntries( "RedistPlan Block [STAR,VR]", ABlock );
+    RedistPlan<T> plan( ABlock, A_MR_MC );
+    plan.Execute( ABlock, A_MR_MC );
+    CheckEntries( "RedistPlan [MR,MC]", A_MR_MC );
+
+#ifdef EL_USE_64BIT_INTS
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC(g);
+    A_CIRC_CIRC = A;
+    CheckEntries( "[CIRC,CIRC]", A_CIRC_CIRC );
+
+    ABlock = A;
+    CheckEntries( "Block [STAR,VR]", ABlock );
+
+    DistMatrix<T,VC,STAR> A_VC_STAR(g);
+    {
+        auto req = ICopy( ABlock, A_VC_STAR );
+        req.Wait();
+    }
+    CheckEntries( "ICopy [VC,STAR]", A_VC_STAR );
+
+    DistMultiVec<T> X(m,n,g.Comm());
+    for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+        for( Int j=0; j<n; ++j )
+            X.SetLocal( iLoc, j, EntryValue<T>(X.GlobalRow(iLoc),j,m) );
+    Matrix<T> XRoot;
+    if( g.Rank() == 0 )
+    {
+        CopyFromRoot( X, XRoot );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( XRoot.Get(i,j) != EntryValue<T>(i,j,m) )
+                    LogicError("CopyFromRoot had an incorrect entry");
+    }
+    else
+        CopyFromNonRoot( X, 0 );
+#endif
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",30);
+        const Int maxCount = Input("--maxCount","maximum message size",7);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+#ifndef EL_USE_64BIT_INTS
+        if( g.Rank() == 0 )
+            Output
+            ("Skipping the large-count collectives, which require 64-bit Int");
+#endif
+        mpi::SetMaxCount( maxCount );
+        TestLargeCount<float>( m, n, g );
+        TestLargeCount<Complex<double>>( m, n, g );
+        mpi::SetMaxCount( std::numeric_limits<int>::max() );
+
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -41,6 +41,27 @@ void TestMatrix( Int m, Int n, Int ldim )
         Output("passed");
 }
 
+template<typename T>
+void TestAlignment( Int m, Int n )
+{
+    if( mpi::Rank() == 0 )
+        Output("Testing buffer alignment with ",TypeName<T>());
+
+    // Repeatedly create and destroy matrices so that cached blocks are reused
+    for( Int k=0; k<3; ++k )
+    {
+        Matrix<T> A( m+k, n );
+        const size_t address = reinterpret_cast<size_t>(A.LockedBuffer());
+        if( address % EL_MEMORY_ALIGNMENT != 0 )
+            LogicError("Matrix buffer was not properly aligned");
+        Zeros( A, m, n+k );
+    }
+
+    const Int commRank = mpi::Rank( mpi::COMM_WORLD );
+    if( commRank == 0 )
+        Output("passed");
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -59,6 +80,10 @@ main( int argc, char* argv[] )
         TestMatrix<double>( m, n, ldim );
         TestMatrix<Complex<double>>( m, n, ldim );
 
+        TestAlignment<float>( m, n );
+        TestAlignment<double>( m, n );
+        TestAlignment<Complex<double>>( m, n );
+
 #ifdef EL_HAVE_QD
         TestMatrix<DoubleDouble>( m, n, ldim );
         TestMatrix<QuadDouble>( m, n, ldim );
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",100);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        DistMatrix<double> A(g), B(g), C(g);
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+
+        mpi::ResetTrafficCounters();
+        mpi::EnableTrafficCounters();
+        Gemm( NORMAL, NORMAL, 1., A, B, C );
+
+        // A broadcast of a known size over a labelled communicator
+        const int count = 10;
+        vector<double> buf( count, commRank );
+        mpi::Broadcast( buf.data(), count, 0, g.VCComm() );
+        mpi::DisableTrafficCounters();
+
+        const auto bcast = mpi::TrafficCounters( mpi::TRAFFIC_BROADCAST, "VC" );
+        if( bcast.numCalls != 1 )
+            LogicError("Recorded ",bcast.numCalls," broadcasts over VC");
+        const long long bcastBytes = count*sizeof(double);
+        if( commRank == 0 && bcast.bytesSent != bcastBytes )
+            LogicError("Root sent ",bcast.bytesSent," bytes");
+        if( commRank != 0 && bcast.bytesRecv != bcastBytes )
+            LogicError("Non-root received ",bcast.bytesRecv," bytes");
+
+        // Disabled counters should not record anything
+        mpi::Broadcast( buf.data(), count, 0, g.VCComm() );
+        if( mpi::TrafficCounters(mpi::TRAFFIC_BROADCAST,"VC").numCalls != 1 )
+            LogicError("Traffic was recorded while the counters were disabled");
+
+#ifdef EL_HAVE_MPI3_RMA
+        // One-sided accumulations count the bytes sent by their origin
+        vector<double> windowBuf( count, 0 );
+        vector<Int> offsets( count );
+        for( int k=0; k<count; ++k )
+            offsets[k] = k;
+        mpi::Window window;
+        mpi::WindowCreate( windowBuf.data(), count, comm, window );
+        mpi::EnableTrafficCounters();
+        mpi::WindowLockAll( window );
+        mpi::Accumulate
+        ( buf.data(), offsets.data(), count, (commRank+1) % commSize, window );
+        mpi::WindowUnlockAll( window );
+        mpi::DisableTrafficCounters();
+        mpi::Barrier( comm );
+        mpi::WindowFree( window );
+        const auto accum = mpi::TrafficCounters( mpi::TRAFFIC_ACCUMULATE, "" );
+        if( accum.numCalls != 1 || accum.bytesSent != bcastBytes )
+            LogicError
+            ("Recorded ",accum.numCalls," accumulations of ",accum.bytesSent,
+             " bytes");
+        if( mpi::TrafficCounters(mpi::TRAFFIC_WINDOW_SYNC,"").numCalls != 2 )
+            LogicError("Did not record the window synchronizations");
+#endif
+
+        mpi::PrintTrafficCounters( comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+T EntryValue( Int i, Int j )
+{ return T(1+i+2*j); }
+
+// Emulate nodes by coloring the processes of a duplicate of 'comm' so that
+// the hierarchical collectives can be tested on a single node
+template<typename T>
+void TestCollectives
+( const string& label, mpi::Comm comm, int nodeColor, Int count )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    mpi::Comm hierComm;
+    mpi::Dup( comm, hierComm );
+    mpi::CreateHierarchy( hierComm, nodeColor );
+
+    vector<T> buf( count );
+    for( int root=0; root<commSize; ++root )
+    {
+        for( Int k=0; k<count; ++k )
+            buf[k] = ( commRank == root ? EntryValue<T>(k,root) : T(0) );
+        mpi::Broadcast( buf.data(), count, root, hierComm );
+        for( Int k=0; k<count; ++k )
+            if( buf[k] != EntryValue<T>(k,root) )
+                LogicError(label,": Broadcast from ",root," failed");
+    }
+
+    vector<T> sendBuf( count ), recvBuf( count*commSize );
+    for( Int k=0; k<count; ++k )
+        sendBuf[k] = EntryValue<T>(k,commRank);
+    mpi::AllGather( sendBuf.data(), count, recvBuf.data(), count, hierComm );
+    for( int q=0; q<commSize; ++q )
+        for( Int k=0; k<count; ++k )
+            if( recvBuf[k+q*count] != EntryValue<T>(k,q) )
+                LogicError(label,": AllGather failed");
+
+    mpi::FreeHierarchy( hierComm );
+    mpi::Free( hierComm );
+}
+
+template<typename T>
+void TestNodeAwareGrid( Int m, Int n, Int k, const Grid& g, const Grid& gNode )
+{
+    auto fill = function<T(Int,Int)>( EntryValue<T> );
+    DistMatrix<T> A(m,k,g), B(k,n,g), C(g);
+    DistMatrix<T> ANode(m,k,gNode), BNode(k,n,gNode), CNode(gNode);
+    IndexDependentFill( A, fill );
+    IndexDependentFill( B, fill );
+    IndexDependentFill( ANode, fill );
+    IndexDependentFill( BNode, fill );
+    Gemm( NORMAL, NORMAL, T(1), A, B, C );
+    Gemm( NORMAL, NORMAL, T(1), ANode, BNode, CNode );
+
+    DistMatrix<T,STAR,STAR> C_STAR_STAR( C ), CNode_STAR_STAR( CNode );
+    CNode_STAR_STAR.Matrix() -= C_STAR_STAR.Matrix();
+    const Base<T> errorNorm = FrobeniusNorm( CNode_STAR_STAR.Matrix() );
+    if( errorNorm != Base<T>(0) )
+        LogicError("Gemm over the node-aware grid had error ",errorNorm);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int count = Input("--count","entries per process",13);
+        const Int m = Input("--m","height of result",50);
+        const Int n = Input("--n","width of result",40);
+        const Int k = Input("--k","inner dimension",30);
+        ProcessInput();
+        PrintInputReport();
+
+        // Contiguous and interleaved nodes of (at most) two processes
+        TestCollectives<double>( "Contiguous", comm, commRank/2, count );
+        TestCollectives<Complex<double>>
+        ( "Contiguous", comm, commRank/2, count );
+        TestCollectives<double>( "Interleaved", comm, commRank%2, count );
+        TestCollectives<Complex<float>>
+        ( "Interleaved", comm, commRank%2, count );
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        const Grid gNode( comm, r, order, true );
+        if( !gNode.NodeAware() )
+            LogicError("The grid was not node-aware");
+        TestNodeAwareGrid<double>( m, n, k, g, gNode );
+        TestNodeAwareGrid<Complex<double>>( m, n, k, g, gNode );
+
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+void CheckPolicy
+( const string& label, const Matrix<double>& A, NumaPolicy policy )
+{
+    if( A.NumaPolicy() != policy )
+        LogicError(label," had the wrong NUMA policy");
+}
+
+void CheckEntries
+( const string& label, const Matrix<double>& A, const Matrix<double>& B )
+{
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," had the wrong dimensions");
+    for( Int j=0; j<A.Width(); ++j )
+        for( Int i=0; i<A.Height(); ++i )
+            if( A.Get(i,j) != B.Get(i,j) )
+                LogicError(label," had the wrong entries");
+}
+
+void TestPolicy( NumaPolicy policy, Int m, Int n )
+{
+    Matrix<double> A;
+    A.SetNumaPolicy( policy );
+    Uniform( A, m, n );
+    CheckPolicy( "A", A, policy );
+
+    // Resizing reallocates under the same policy
+    Matrix<double> ACopy( A );
+    A.Resize( 2*m, 2*n );
+    CheckPolicy( "A after a resize", A, policy );
+    A = ACopy;
+
+    // A copy-constructed matrix inherits the policy, whereas copy assignment
+    // preserves that of the destination
+    CheckPolicy( "A copy", ACopy, policy );
+    CheckEntries( "A copy", ACopy, A );
+    Matrix<double> B;
+    B.SetNumaPolicy( NUMA_DEFAULT );
+    B = A;
+    CheckPolicy( "A copy-assigned", B, NUMA_DEFAULT );
+    CheckEntries( "A copy-assigned", B, A );
+    B.SetNumaPolicy( policy );
+    B = A;
+    CheckPolicy( "A copy-assigned with a policy", B, policy );
+    CheckEntries( "A copy-assigned with a policy", B, A );
+
+    // Moves carry the policy along with the pages
+    Matrix<double> C( std::move(ACopy) );
+    CheckPolicy( "A move-constructed", C, policy );
+    CheckEntries( "A move-constructed", C, A );
+    Matrix<double> D;
+    D.SetNumaPolicy( NUMA_DEFAULT );
+    D = std::move(C);
+    CheckPolicy( "A move-assigned", D, policy );
+    CheckEntries( "A move-assigned", D, A );
+    D.Resize( m+1, n+1 );
+    CheckPolicy( "A move-assigned and resized", D, policy );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    const int commRank = mpi::Rank( mpi::COMM_WORLD );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",200);
+        const Int n = Input("--n","width of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        TestPolicy( NUMA_FIRST_TOUCH, m, n );
+        TestPolicy( NUMA_INTERLEAVE, m, n );
+
+        // The process-wide default only applies to newly constructed matrices
+        const NumaPolicy oldDefault = DefaultNumaPolicy();
+        Matrix<double> A;
+        SetDefaultNumaPolicy( NUMA_FIRST_TOUCH );
+        Matrix<double> B;
+        CheckPolicy( "A default-constructed matrix", B, NUMA_FIRST_TOUCH );
+        CheckPolicy( "An older matrix", A, oldDefault );
+        SetDefaultNumaPolicy( oldDefault );
+
+        if( commRank == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
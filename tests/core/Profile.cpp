@@ -0,0 +1,186 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename F>
+void ProfiledMultiply( const DistMatrix<F>& A, DistMatrix<F>& B, Int numIts )
+{
+    ProfileRegion region("ProfiledMultiply");
+    DistMatrix<F> C(A.Grid());
+    for( Int it=0; it<numIts; ++it )
+    {
+        ProfileRegion iterRegion("Iteration");
+
+        PushProfileRegion("Gemm");
+        Gemm( NORMAL, NORMAL, F(1), A, B, C );
+        PopProfileRegion();
+
+        // Only the root process enters this region
+        if( A.Grid().Rank() == 0 )
+        {
+            PushProfileRegion("Root-only");
+            B = C;
+            PopProfileRegion();
+        }
+        else
+            B = C;
+    }
+}
+
+// Return the number of lines of the report for the given region at the given
+// depth (storing the call count of the last one)
+Int FindRegion
+( const string& report, const string& name, Int depth, Int& calls )
+{
+    const string label = string(2*depth,' ') + name;
+    std::istringstream stream( report );
+    string line;
+    Int numMatches = 0;
+    while( std::getline( stream, line ) )
+    {
+        if( line.compare( 0, label.size(), label ) != 0 ||
+            line.size() == label.size() || line[label.size()] != ' ' )
+            continue;
+        std::istringstream lineStream( line.substr(label.size()) );
+        lineStream >> calls;
+        ++numMatches;
+    }
+    return numMatches;
+}
+
+void CheckRegion
+( const string& report, const string& name, Int depth, Int expectedCalls )
+{
+    Int calls = -1;
+    const Int numMatches = FindRegion( report, name, depth, calls );
+    if( numMatches != 1 )
+        LogicError
+        ("Found ",numMatches," entries for ",name," at depth ",depth);
+    if( calls != expectedCalls )
+        LogicError
+        ("Expected ",expectedCalls," calls of ",name," but found ",calls);
+}
+
+string ReadFile( const string& filename )
+{
+    std::ifstream file( filename.c_str() );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+    std::ostringstream os;
+    os << file.rdbuf();
+    return os.str();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of matrices",100);
+        const Int numIts = Input("--numIts","number of iterations",3);
+        ProcessInput();
+        PrintInputReport();
+
+        // ctest runs from the source tree, so write into a temporary
+        // directory instead
+        const char* tmpDir = std::getenv("TMPDIR");
+        const string prefix =
+          string(tmpDir==nullptr ? "/tmp" : tmpDir) + "/El-Profile";
+        const string jsonFile = prefix + ".json";
+        const string traceFile = prefix + "-trace.json";
+
+        const Grid g( comm );
+        DistMatrix<double> A(g), B(g);
+        Uniform( A, n, n );
+        Uniform( B, n, n );
+
+        // Entering regions while profiling is disabled should record nothing
+        ResetProfile();
+        ProfiledMultiply( A, B, 1 );
+        std::ostringstream disabledReport;
+        PrintProfile( comm, disabledReport );
+        if( commRank == 0 )
+        {
+            Int calls;
+            if( FindRegion(disabledReport.str(),"ProfiledMultiply",0,calls) )
+                LogicError("Regions were recorded while profiling was off");
+        }
+
+        ResetProfile();
+        EnableProfiling( true );
+        ProfiledMultiply( A, B, numIts );
+        DisableProfiling();
+
+        // Only the root outputs the (aggregated) report, in which the maximum
+        // number of calls over the processes is listed
+        std::ostringstream report;
+        PrintProfile( comm, report );
+        if( commRank == 0 )
+        {
+            Output( report.str() );
+            CheckRegion( report.str(), "ProfiledMultiply", 0, 1 );
+            CheckRegion( report.str(), "Iteration", 1, numIts );
+            CheckRegion( report.str(), "Gemm", 2, numIts );
+            CheckRegion( report.str(), "Root-only", 2, numIts );
+        }
+        else if( !report.str().empty() )
+            LogicError("A non-root process printed a report");
+
+        // The statistics should show that only the root entered Root-only,
+        // and so should the timeline
+        WriteProfile( jsonFile, PROFILE_JSON, comm );
+        WriteProfile( traceFile, PROFILE_CHROME_TRACE, comm );
+        if( commRank == 0 )
+        {
+            const string json = ReadFile( jsonFile );
+            const auto entry =
+              json.find("\"path\": \"ProfiledMultiply/Iteration/Root-only\"");
+            if( entry == string::npos )
+                LogicError("Root-only was not nested within Iteration");
+            const string callsKey = "\"calls\": {\"min\": ";
+            const auto callsPos = json.find( callsKey, entry );
+            if( callsPos == string::npos )
+                LogicError("Root-only did not list its calls");
+            std::istringstream callsStream
+            ( json.substr(callsPos+callsKey.size()) );
+            double minCalls;
+            callsStream >> minCalls;
+            if( minCalls != (commSize==1 ? numIts : 0) )
+                LogicError("Unexpected minimum calls of Root-only: ",minCalls);
+
+            std::istringstream trace( ReadFile(traceFile) );
+            string line;
+            Int numEvents = 0;
+            while( std::getline( trace, line ) )
+            {
+                if( line.find("\"name\": \"Root-only\"") == string::npos )
+                    continue;
+                if( line.find("\"pid\": 0,") == string::npos )
+                    LogicError("A non-root process entered Root-only");
+                ++numEvents;
+            }
+            if( numEvents != numIts )
+                LogicError
+                ("Expected ",numIts," Root-only events but found ",numEvents);
+
+            std::remove( jsonFile.c_str() );
+            std::remove( traceFile.c_str() );
+        }
+        ResetProfile();
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
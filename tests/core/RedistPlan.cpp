@@ -0,0 +1,127 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+void CheckEqual
+( const string& label,
+  const AbstractDistMatrix<T>& B, const AbstractDistMatrix<T>& BCheck )
+{
+    DistMatrix<T,STAR,STAR> B_STAR_STAR( B ), BCheck_STAR_STAR( BCheck );
+    BCheck_STAR_STAR.Matrix() -= B_STAR_STAR.Matrix();
+    const Base<T> errorNorm = FrobeniusNorm( BCheck_STAR_STAR.Matrix() );
+    if( errorNorm != Base<T>(0) )
+        LogicError(label," had error ",errorNorm);
+}
+
+// Redistribute a sequence of same-shaped panels of A with a single plan
+template<typename T>
+void TestPanels
+( const string& label,
+  const DistMatrix<T>& A, AbstractDistMatrix<T>& B, Int nb )
+{
+    const Int n = A.Width();
+    RedistPlan<T> plan;
+    for( Int k=0; k<n; k+=nb )
+    {
+        auto A1 = A( ALL, IR(k,Min(k+nb,n)) );
+        plan.Execute( A1, B );
+        if( !plan.Matches( A1, B ) )
+            LogicError("The plan did not match after executing it");
+        CheckEqual( label, B, A1 );
+    }
+}
+
+// Execute a single plan on many distinct, default-aligned matrices of the
+// same shape and distributions as A and B
+template<typename T>
+void TestReuse
+( const string& label,
+  const DistMatrix<T>& A, AbstractDistMatrix<T>& B, Int numReps )
+{
+    RedistPlan<T> plan( A, B );
+    if( !plan.Matches( A, B ) )
+        LogicError("A newly constructed plan did not match");
+    for( Int rep=0; rep<numReps; ++rep )
+    {
+        DistMatrix<T> ARep(A.Grid());
+        Uniform( ARep, A.Height(), A.Width() );
+        unique_ptr<AbstractDistMatrix<T>>
+          BRep( B.Construct(B.Grid(),B.Root()) );
+        if( !plan.Matches( ARep, *BRep ) )
+            LogicError(label," plan did not match repetition ",rep);
+        plan.Execute( ARep, *BRep );
+        CheckEqual( label+" repetition "+std::to_string(rep), *BRep, ARep );
+    }
+}
+
+template<typename T>
+void TestRedistPlan( Int m, Int n, Int nb, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+
+    DistMatrix<T,STAR,VR> A1_STAR_VR(g);
+    TestPanels( "[STAR,VR]", A, A1_STAR_VR, nb );
+    DistMatrix<T,STAR,MR> A1_STAR_MR(g);
+    TestPanels( "[STAR,MR]", A, A1_STAR_MR, nb );
+    DistMatrix<T,VC,STAR> A1_VC_STAR(g);
+    TestPanels( "[VC,STAR]", A, A1_VC_STAR, nb );
+    DistMatrix<T,MC,MR,BLOCK> A1Block(g,7,5);
+    TestPanels( "Block [MC,MR]", A, A1Block, nb );
+    DistMatrix<T,STAR,STAR> A1_STAR_STAR(g);
+    TestPanels( "[STAR,STAR]", A, A1_STAR_STAR, nb );
+
+    // Between grids of different orderings
+    const GridOrder otherOrder =
+      ( g.Order() == COLUMN_MAJOR ? ROW_MAJOR : COLUMN_MAJOR );
+    const Grid gOther( g.Comm(), g.Height(), otherOrder );
+    DistMatrix<T> AOther(gOther);
+    TestPanels( "Between grids", A, AOther, nb );
+
+    // Reusing a plan constructed up front
+    DistMatrix<T,MR,MC> B(g);
+    TestReuse( "[MR,MC]", A, B, 20 );
+    DistMatrix<T,VR,STAR> B_VR_STAR(g);
+    TestReuse( "[VR,STAR]", A, B_VR_STAR, 20 );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",100);
+        const Int n = Input("--n","width of matrix",100);
+        const Int nb = Input("--nb","width of panels",16);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        TestRedistPlan<float>( m, n, nb, g );
+        TestRedistPlan<Complex<double>>( m, n, nb, g );
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Every process twice adds (its rank+1) times the value of each entry, so
+// that the result should be p(p+1) times the value of every entry
+template<typename T>
+T EntryValue( Int i, Int j, Int height )
+{ return T(i+j*height+1); }
+
+template<typename T>
+void TestAccumulation
+( const string& label, AbstractDistMatrix<T>& A, Int capacity )
+{
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int commRank = g.Rank();
+    const Int commSize = g.Size();
+    Zero( A );
+
+    {
+        RemoteAccumulator<T> accum( A, capacity );
+        // Half of the rows are updated in each pass
+        for( Int pass=0; pass<2; ++pass )
+        {
+            for( Int i=(commRank+pass)%2; i<m; i+=2 )
+                for( Int j=0; j<n; ++j )
+                    accum.QueueUpdate
+                    ( i, j, T(commRank+1)*EntryValue<T>(i,j,m) );
+            accum.Flush();
+        }
+        for( Int i=(commRank+1)%2; i<m; i+=2 )
+            for( Int j=0; j<n; ++j )
+                accum.QueueUpdate( i, j, T(commRank+1)*EntryValue<T>(i,j,m) );
+        for( Int i=commRank%2; i<m; i+=2 )
+            for( Int j=0; j<n; ++j )
+                accum.QueueUpdate( i, j, T(commRank+1)*EntryValue<T>(i,j,m) );
+        accum.Fence();
+        accum.Close();
+        if( accum.Open() )
+            LogicError("The accumulator was still open after closing it");
+    }
+
+    const T scale = T(commSize*(commSize+1));
+    Int numWrong = 0;
+    if( A.Participating() )
+    {
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                if( A.GetLocal(iLoc,jLoc) != scale*EntryValue<T>(i,j,m) )
+                    ++numWrong;
+            }
+        }
+    }
+    numWrong = mpi::AllReduce( numWrong, g.ViewingComm() );
+    if( numWrong != 0 )
+        LogicError(label," had ",numWrong," incorrect entries");
+}
+
+template<typename T>
+void TestRemoteAccumulator( Int m, Int n, Int capacity, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+
+    DistMatrix<T> A(m,n,g);
+    TestAccumulation( "[MC,MR]", A, capacity );
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(m,n,g);
+    TestAccumulation( "[STAR,STAR]", A_STAR_STAR, capacity );
+    DistMatrix<T,VR,STAR> A_VR_STAR(m,n,g);
+    TestAccumulation( "[VR,STAR]", A_VR_STAR, capacity );
+    DistMatrix<T,MC,MR,BLOCK> ABlock(m,n,g,5,3);
+    TestAccumulation( "Block [MC,MR]", ABlock, capacity );
+    DistMatrix<T,CIRC,CIRC> A_CIRC_CIRC(m,n,g);
+    TestAccumulation( "[CIRC,CIRC]", A_CIRC_CIRC, capacity );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",30);
+        const Int n = Input("--n","width of matrix",20);
+        const Int capacity = Input("--capacity","updates per message",17);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        TestRemoteAccumulator<double>( m, n, capacity, g );
+        TestRemoteAccumulator<Complex<double>>( m, n, capacity, g );
+
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
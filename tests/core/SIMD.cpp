@@ -0,0 +1,126 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename F>
+void CheckClose( const string& msg, F value, F expected, Int n )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    const Real tol = 10*(n+1)*eps*Max(Abs(expected),Real(1));
+    if( Abs(value-expected) > tol )
+        LogicError(msg,": expected ",expected," but found ",value);
+}
+
+// Compare the vectorized kernels against the scalar implementations
+template<typename F>
+void TestKernels( Int n )
+{
+    typedef Base<F> Real;
+    Matrix<F> x, y, z;
+    Uniform( x, n, 1 );
+    Uniform( y, n, 1 );
+    if( n > 2 )
+    {
+        // Ensure that the first of several maxima is returned
+        x.Set( n/2, 0, F(2) );
+        x.Set( n-1, 0, F(-2) );
+    }
+
+    simd::SetInstructionSet( simd::SCALAR_INSTRUCTIONS );
+    const F dotScalar = simd::Dot( n, x.LockedBuffer(), y.LockedBuffer() );
+    const Real nrm2Scalar = simd::Nrm2( n, x.LockedBuffer() );
+    const Int maxIndScalar = simd::MaxAbsInd( n, x.LockedBuffer() );
+    Matrix<F> hadamardScalar( n, 1 );
+    simd::Hadamard
+    ( n, x.LockedBuffer(), y.LockedBuffer(), hadamardScalar.Buffer() );
+    Matrix<F> a1Scalar( x ), a2Scalar( y );
+    const F gamma11=F(2), gamma12=F(-1), gamma21=F(1)/F(3), gamma22=F(4);
+    simd::Transform2x2
+    ( n, gamma11, gamma12, gamma21, gamma22,
+      a1Scalar.Buffer(), a2Scalar.Buffer() );
+
+    simd::SetInstructionSet( simd::DetectedInstructionSet() );
+    CheckClose
+    ( "Dot", simd::Dot(n,x.LockedBuffer(),y.LockedBuffer()), dotScalar, n );
+    CheckClose( "Nrm2", simd::Nrm2(n,x.LockedBuffer()), nrm2Scalar, n );
+    if( simd::MaxAbsInd(n,x.LockedBuffer()) != maxIndScalar )
+        LogicError("MaxAbsInd did not match the scalar implementation");
+    z.Resize( n, 1 );
+    simd::Hadamard( n, x.LockedBuffer(), y.LockedBuffer(), z.Buffer() );
+    z -= hadamardScalar;
+    CheckClose( "Hadamard", FrobeniusNorm(z), Real(0), n );
+    Matrix<F> a1( x ), a2( y );
+    simd::Transform2x2
+    ( n, gamma11, gamma12, gamma21, gamma22, a1.Buffer(), a2.Buffer() );
+    a1 -= a1Scalar;
+    a2 -= a2Scalar;
+    CheckClose
+    ( "Transform2x2", FrobeniusNorm(a1)+FrobeniusNorm(a2), Real(0), n );
+
+    // Norms which would overflow without scaling
+    if( n > 0 )
+    {
+        const Real alpha = limits::Max<Real>()/4;
+        Scale( alpha, x );
+        CheckClose
+        ( "Nrm2 near overflow", simd::Nrm2(n,x.LockedBuffer())/alpha,
+          nrm2Scalar, n );
+    }
+}
+
+template<typename F>
+void TestSIMD( Int n, bool print )
+{
+    if( mpi::Rank() == 0 )
+        Output("Testing with ",TypeName<F>());
+    for( Int k : { Int(0), Int(1), Int(7), Int(31), n } )
+        TestKernels<F>( k );
+
+    // The level-1 routines which are built upon the kernels
+    Matrix<F> A;
+    Uniform( A, n, n );
+    A.Set( n/3, n/2, F(3) );
+    const Entry<Base<F>> pivot = MaxAbsLoc( A );
+    if( pivot.i != n/3 || pivot.j != n/2 )
+        LogicError("MaxAbsLoc returned (",pivot.i,",",pivot.j,")");
+    Matrix<Base<F>> norms;
+    ColumnMaxNorms( A, norms );
+    if( norms.Get(n/2,0) != Base<F>(3) )
+        LogicError("ColumnMaxNorms returned ",norms.Get(n/2,0));
+    if( print )
+        Print( norms, "column max norms" );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int n = Input("--n","size of vectors",1000);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank() == 0 )
+            Output
+            ("Using ",simd::InstructionSetName(simd::DetectedInstructionSet()),
+             " kernels");
+        TestSIMD<float>( n, print );
+        TestSIMD<Complex<float>>( n, print );
+        TestSIMD<double>( n, print );
+        TestSIMD<Complex<double>>( n, print );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+template<typename T>
+void CheckReplica
+( const string& label,
+  const SharedReplica<T>& replica, const AbstractDistMatrix<T>& A )
+{
+    const auto& B = replica.Matrix();
+    if( B.Height() != A.Height() || B.Width() != A.Width() )
+        LogicError(label," had the wrong dimensions");
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    E -= B.LockedMatrix();
+    const Base<T> errorNorm = FrobeniusNorm( E );
+    if( errorNorm != Base<T>(0) )
+        LogicError(label," had error ",errorNorm);
+}
+
+template<typename T>
+void TestSharedReplica( Int m, Int n, const Grid& g )
+{
+    if( g.Rank() == 0 )
+        Output("Testing with ",TypeName<T>());
+
+    SharedReplica<T> replica( g );
+    DistMatrix<T> A(g);
+    Uniform( A, m, n );
+    replica.Set( A );
+    CheckReplica( "[MC,MR]", replica, A );
+
+    // Growing, shrinking, and empty matrices
+    DistMatrix<T,VR,STAR> A_VR_STAR(g);
+    Uniform( A_VR_STAR, 2*m, n+3 );
+    replica.Set( A_VR_STAR );
+    CheckReplica( "[VR,STAR]", replica, A_VR_STAR );
+    DistMatrix<T,STAR,MR,BLOCK> ABlock(g,4,3);
+    Uniform( ABlock, m/2, n/3 );
+    replica.Set( ABlock );
+    CheckReplica( "Block [STAR,MR]", replica, ABlock );
+    DistMatrix<T,STAR,STAR> AEmpty( 0, n, g );
+    replica.Set( AEmpty );
+    CheckReplica( "Empty", replica, AEmpty );
+
+    // Fewer columns than processes
+    DistMatrix<T,MC,STAR> AThin(g);
+    Uniform( AThin, m, 1 );
+    const SharedReplica<T> thinReplica( AThin );
+    CheckReplica( "[MC,STAR]", thinReplica, AThin );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",40);
+        const bool nodeAware = Input("--nodeAware","node-aware grid?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g
+        ( comm, Grid::FindFactor(mpi::Size(comm)), COLUMN_MAJOR, nodeAware );
+        TestSharedReplica<double>( m, n, g );
+        TestSharedReplica<Complex<float>>( m, n, g );
+
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+void CheckEqual( const string& msg, double value, double expected )
+{
+    if( Abs(value-expected) > 1e-12*Max(Abs(expected),1.) )
+        LogicError(msg,": expected ",expected," but found ",value);
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--n","size of the 2D Laplacian grid",20);
+        ProcessInput();
+        PrintInputReport();
+
+        mpi::Comm subComm;
+        mpi::Split( comm, commRank % 2, commRank, subComm );
+
+        // Sequential sparse matrices and graphs
+        SparseMatrix<double> A;
+        Laplacian( A, n, n );
+        const double ANorm = FrobeniusNorm( A );
+        const Int numNonzeros = A.NumEntries();
+        SparseMatrix<double> B( std::move(A) );
+        if( A.NumEntries() != 0 || A.Height() != 0 )
+            LogicError("Moved-from SparseMatrix was not empty");
+        CheckEqual( "SparseMatrix move construction", FrobeniusNorm(B), ANorm );
+        A = std::move(B);
+        if( A.NumEntries() != numNonzeros || B.NumEntries() != 0 )
+            LogicError("SparseMatrix move assignment lost entries");
+
+        Graph G( A.LockedGraph() );
+        Graph H;
+        H = std::move(G);
+        if( H.NumEdges() != numNonzeros || G.NumEdges() != 0 )
+            LogicError("Graph move assignment lost edges");
+        H.AssertConsistent();
+
+        // Distributed sparse matrices over a subcommunicator
+        DistSparseMatrix<double> ADist(subComm);
+        Laplacian( ADist, n, n );
+        const double ADistNorm = FrobeniusNorm( ADist );
+        DistSparseMatrix<double> BDist( std::move(ADist) );
+        if( ADist.NumLocalEntries() != 0 || ADist.Comm() != mpi::COMM_SELF )
+            LogicError("Moved-from DistSparseMatrix was not reset");
+        if( mpi::Size(BDist.Comm()) != mpi::Size(subComm) )
+            LogicError("DistSparseMatrix move lost its communicator");
+        CheckEqual
+        ( "DistSparseMatrix move construction", FrobeniusNorm(BDist),
+          ADistNorm );
+
+        // Multiplication relies upon the moved communication metadata
+        DistMultiVec<double> X(subComm), Y(subComm);
+        Ones( X, n*n, 1 );
+        Multiply( NORMAL, 1., BDist, X, 0., Y );
+        const double YNorm = FrobeniusNorm( Y );
+        ADist = std::move(BDist);
+        Multiply( NORMAL, 1., ADist, X, 0., Y );
+        CheckEqual( "DistSparseMatrix move assignment", FrobeniusNorm(Y), YNorm );
+
+        // Distributed multivectors
+        DistMultiVec<double> Z( std::move(Y) );
+        if( Y.Height() != 0 || Z.Height() != n*n )
+            LogicError("DistMultiVec move construction failed");
+        CheckEqual( "DistMultiVec move construction", FrobeniusNorm(Z), YNorm );
+        // A moved-from multivector remains usable (over mpi::COMM_SELF)
+        Y.Resize( n, 1 );
+        if( Y.LocalHeight() != n )
+            LogicError("Moved-from DistMultiVec was not over mpi::COMM_SELF");
+        Y = std::move(Z);
+        CheckEqual( "DistMultiVec move assignment", FrobeniusNorm(Y), YNorm );
+        Y += X;
+
+        DistGraph GDist( ADist.LockedDistGraph() ), HDist;
+        HDist = std::move(GDist);
+        if( HDist.NumEdges() != ADist.NumEntries() || GDist.NumEdges() != 0 )
+            LogicError("DistGraph move assignment lost edges");
+
+        mpi::Free( subComm );
+        if( commRank == 0 )
+            Output("Passed move semantics tests");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
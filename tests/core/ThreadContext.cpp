@@ -0,0 +1,108 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <thread>
+using namespace El;
+
+// Factor a random HPD matrix using a thread-specific blocksize and return the
+// relative residual of the factorization
+template<typename F>
+void FactorOnThread( Int n, Int blocksize, Base<F>& relError, bool& consistent )
+{
+    PushBlocksizeStack( blocksize );
+
+    Matrix<F> X, A, L;
+    Uniform( X, n, n );
+    Identity( A, n, n );
+    Herk( LOWER, ADJOINT, Base<F>(1), X, Base<F>(n), A );
+    MakeHermitian( LOWER, A );
+    L = A;
+    Cholesky( LOWER, L );
+    MakeTrapezoidal( LOWER, L );
+
+    const Base<F> frobA = FrobeniusNorm( A );
+    Gemm( NORMAL, ADJOINT, F(-1), L, L, F(1), A );
+    relError = FrobeniusNorm( A ) / frobA;
+
+    // No other thread should have been able to modify our blocksize stack
+    consistent = ( Blocksize() == blocksize );
+    PopBlocksizeStack();
+}
+
+template<typename F>
+void TestThreadContexts( Int n, Int numThreads )
+{
+    typedef Base<F> Real;
+    if( mpi::Rank() == 0 )
+        Output("Testing with ",TypeName<F>());
+
+    const Int mainBlocksize = Blocksize();
+    vector<Real> relErrors(numThreads);
+    vector<int> consistent(numThreads,0);
+    vector<std::thread> threads;
+    for( Int t=0; t<numThreads; ++t )
+    {
+        threads.push_back
+        ( std::thread
+          ( [=,&relErrors,&consistent]()
+            {
+                bool threadConsistent;
+                FactorOnThread<F>
+                ( n, 8*(t+1), relErrors[t], threadConsistent );
+                consistent[t] = threadConsistent;
+            } ) );
+    }
+    for( auto& thread : threads )
+        thread.join();
+
+    const Real tol = 100*n*limits::Epsilon<Real>();
+    for( Int t=0; t<numThreads; ++t )
+    {
+        if( !consistent[t] )
+            LogicError("Thread ",t," saw a modified blocksize stack");
+        if( relErrors[t] > tol )
+            LogicError
+            ("Thread ",t," had relative residual ",relErrors[t]," > ",tol);
+    }
+    if( Blocksize() != mainBlocksize )
+        LogicError("The main thread's blocksize was modified");
+
+    // An explicitly installed context should shadow the thread's own
+    Context context;
+    context.SetBlocksize( mainBlocksize+1 );
+    SetThreadContext( &context );
+    const bool usedExplicit = ( Blocksize() == mainBlocksize+1 );
+    SetThreadContext( nullptr );
+    if( !usedExplicit || Blocksize() != mainBlocksize )
+        LogicError("Explicit context was not properly installed");
+
+    if( mpi::Rank() == 0 )
+        Output("passed");
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try 
+    {
+        const Int n = Input("--n","size of the matrices",100);
+        const Int numThreads = Input("--numThreads","number of threads",4);
+        ProcessInput();
+        PrintInputReport();
+
+        TestThreadContexts<float>( n, numThreads );
+        TestThreadContexts<Complex<float>>( n, numThreads );
+        TestThreadContexts<double>( n, numThreads );
+        TestThreadContexts<Complex<double>>( n, numThreads );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
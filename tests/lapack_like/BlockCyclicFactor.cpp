@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Compare the block-cyclic factorization B against the element-cyclic one, A
+template<typename F>
+void CheckAgainst
+( const string& label,
+  const ElementalMatrix<F>& A, const AbstractDistMatrix<F>& B )
+{
+    typedef Base<F> Real;
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        LogicError(label," had the wrong dimensions");
+    DistMatrix<F> E( B );
+    E -= A;
+    const Real errorNorm = FrobeniusNorm( E );
+    const Real scale = Max( FrobeniusNorm(A), Real(1) );
+    const Real tol =
+      100*limits::Epsilon<Real>()*Max(A.Height(),A.Width())*scale;
+    if( errorNorm > tol )
+        LogicError(label," had error ",errorNorm," > ",tol);
+}
+
+template<typename F>
+void TestCholesky( Int n, Int bsize, const Grid& g )
+{
+    const vector<UpperOrLower> uplos = {LOWER,UPPER};
+    for( auto uplo : uplos )
+    {
+        const string label = "Cholesky"+string(1,UpperOrLowerToChar(uplo));
+        DistMatrix<F> A(g);
+        HermitianUniformSpectrum( A, n, 1, 10 );
+        DistMatrix<F,MC,MR,BLOCK> ABlock(g,bsize,bsize);
+        ABlock = A;
+        Cholesky( uplo, A );
+        Cholesky( uplo, ABlock );
+        CheckAgainst( label, A, ABlock );
+
+        // A trailing submatrix, which has a nonzero cut and nonzero alignments
+        HermitianUniformSpectrum( A, n, 1, 10 );
+        ABlock = A;
+        const Int offset = bsize+bsize/2;
+        auto ASub = A( IR(offset,n), IR(offset,n) );
+        auto ABlockSub = ABlock( IR(offset,n), IR(offset,n) );
+        Cholesky( uplo, ASub );
+        Cholesky( uplo, ABlockSub );
+        CheckAgainst( label+" of a submatrix", A, ABlock );
+
+        // A matrix which is only indefinite in its trailing blocks should
+        // raise an exception on every process
+        HermitianUniformSpectrum( A, n, 1, 10 );
+        A.Set( n-1, n-1, F(-100) );
+        ABlock = A;
+        bool threw = false;
+        try { Cholesky( uplo, ABlock ); }
+        catch( std::exception& e ) { threw = true; }
+        if( !threw )
+            LogicError(label," did not detect an indefinite matrix");
+    }
+}
+
+template<typename F>
+void TestLU( Int m, Int n, Int bsize, const Grid& g )
+{
+    const vector<pair<Int,Int>> sizes = {{m,n},{n,m}};
+    for( const auto& size : sizes )
+    {
+        const string dims =
+          " of a "+std::to_string(size.first)+" x "+
+          std::to_string(size.second)+" matrix";
+        DistMatrix<F> A(g);
+        Uniform( A, size.first, size.second );
+        DistMatrix<F,MC,MR,BLOCK> ABlock(g,bsize,bsize);
+        ABlock = A;
+        DistPermutation P(g), PBlock(g);
+        LU( A, P );
+        LU( ABlock, PBlock );
+        CheckAgainst( "LU"+dims, A, ABlock );
+
+        // The row permutations should also match
+        DistMatrix<F> X(g), XBlock(g);
+        Uniform( X, size.first, 3 );
+        XBlock = X;
+        P.PermuteRows( X );
+        PBlock.PermuteRows( XBlock );
+        CheckAgainst( "LU permutation"+dims, X, XBlock );
+
+        // Without pivoting (on a diagonally dominant matrix)
+        Uniform( A, size.first, size.second );
+        ShiftDiagonal( A, F(2*Max(size.first,size.second)) );
+        ABlock = A;
+        LU( A );
+        LU( ABlock );
+        CheckAgainst( "Unpivoted LU"+dims, A, ABlock );
+    }
+
+    // A singular matrix should raise an exception on every process
+    DistMatrix<F,MC,MR,BLOCK> ABlock(g,bsize,bsize);
+    Zeros( ABlock, m, n );
+    DistPermutation PBlock(g);
+    bool threw = false;
+    try { LU( ABlock, PBlock ); }
+    catch( SingularMatrixException& e ) { threw = true; }
+    if( !threw )
+        LogicError("LU did not detect a singular matrix");
+}
+
+template<typename F>
+void TestQR( Int m, Int n, const Grid& g )
+{
+    typedef Base<F> Real;
+    const vector<pair<Int,Int>> sizes = {{m,n},{n,m}};
+    for( const auto& size : sizes )
+    {
+        const string dims =
+          " of a "+std::to_string(size.first)+" x "+
+          std::to_string(size.second)+" matrix";
+        DistMatrix<F> A(g);
+        Uniform( A, size.first, size.second );
+        // Deliberately non-square blocks with a nonzero alignment
+        DistMatrix<F,MC,MR,BLOCK> ABlock(g,5,3);
+        ABlock.Align( 5, 3, g.Height()-1, 0, 2, 1 );
+        ABlock = A;
+        DistMatrix<F,MD,STAR> t(g), tBlock(g);
+        DistMatrix<Real,MD,STAR> d(g), dBlock(g);
+        QR( A, t, d );
+        QR( ABlock, tBlock, dBlock );
+        CheckAgainst( "QR"+dims, A, ABlock );
+        CheckAgainst( "QR scalars"+dims, t, tBlock );
+        CheckAgainst( "QR signs"+dims, d, dBlock );
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--m","height of matrix",50);
+        const Int n = Input("--n","width of matrix",40);
+        const Int bsize = Input("--bsize","distribution blocksize",4);
+        const Int nb = Input("--nb","algorithmic blocksize",8);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( mpi::Size(comm) );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+
+        TestCholesky<double>( m, bsize, g );
+        TestCholesky<Complex<double>>( m, bsize, g );
+        TestLU<double>( m, n, bsize, g );
+        TestLU<Complex<double>>( m, n, bsize, g );
+        TestQR<double>( m, n, g );
+        TestQR<Complex<double>>( m, n, g );
+
+        if( g.Rank() == 0 )
+            Output("PASSED");
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}